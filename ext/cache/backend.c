@@ -249,3 +249,56 @@ PHP_METHOD(Phalcon_Cache_Backend, getLastKey){
 	RETURN_MEMBER(this_ptr, "_lastKey");
 }
 
+/**
+ * Returns the cached contents of several keys at once, keys not found in the cache are returned with a null value.
+ * Backends able to read many keys in a single request override this method
+ *
+ *<code>
+ * $fragments = $cache->getMany(array('header', 'footer'));
+ *</code>
+ *
+ * @param array $keys
+ * @param long $lifetime
+ * @return array
+ */
+PHP_METHOD(Phalcon_Cache_Backend, getMany){
+
+	zval *keys, *lifetime = NULL, *key_name = NULL, *content = NULL;
+	HashTable *ah0;
+	HashPosition hp0;
+	zval **hd;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &keys, &lifetime) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!lifetime) {
+		PHALCON_INIT_VAR(lifetime);
+	}
+	
+	if (Z_TYPE_P(keys) != IS_ARRAY) { 
+		PHALCON_THROW_EXCEPTION_STR(phalcon_cache_exception_ce, "Keys must be an array");
+		return;
+	}
+	
+	array_init(return_value);
+	
+	if (!phalcon_is_iterable(keys, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_VALUE(key_name);
+	
+		PHALCON_INIT_NVAR(content);
+		PHALCON_CALL_METHOD_PARAMS_2(content, this_ptr, "get", key_name, lifetime);
+		phalcon_array_update_zval(&return_value, key_name, &content, PH_COPY TSRMLS_CC);
+	
+		zend_hash_move_forward_ex(ah0, &hp0);
+	}
+	
+	PHALCON_MM_RESTORE();
+}
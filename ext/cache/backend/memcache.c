@@ -233,6 +233,102 @@ PHP_METHOD(Phalcon_Cache_Backend_Memcache, get){
 	RETURN_CCTOR(content);
 }
 
+/**
+ * Returns the cached contents of several keys reading all of them in a single request to the server
+ *
+ * @param array $keys
+ * @param long $lifetime
+ * @return array
+ */
+PHP_METHOD(Phalcon_Cache_Backend_Memcache, getMany){
+
+	zval *keys, *lifetime = NULL, *memcache = NULL, *frontend, *prefix;
+	zval *prefixed_keys, *key_name = NULL, *prefixed_key = NULL;
+	zval *cached_contents, *cached_content = NULL, *content = NULL;
+	HashTable *ah0, *ah1;
+	HashPosition hp0, hp1;
+	zval **hd;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &keys, &lifetime) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (Z_TYPE_P(keys) != IS_ARRAY) { 
+		PHALCON_THROW_EXCEPTION_STR(phalcon_cache_exception_ce, "Keys must be an array");
+		return;
+	}
+	
+	PHALCON_OBS_VAR(memcache);
+	phalcon_read_property(&memcache, this_ptr, SL("_memcache"), PH_NOISY_CC);
+	if (Z_TYPE_P(memcache) != IS_OBJECT) {
+		PHALCON_CALL_METHOD_NORETURN(this_ptr, "_connect");
+	
+		PHALCON_OBS_NVAR(memcache);
+		phalcon_read_property(&memcache, this_ptr, SL("_memcache"), PH_NOISY_CC);
+	}
+	
+	PHALCON_OBS_VAR(frontend);
+	phalcon_read_property(&frontend, this_ptr, SL("_frontend"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(prefix);
+	phalcon_read_property(&prefix, this_ptr, SL("_prefix"), PH_NOISY_CC);
+	
+	PHALCON_INIT_VAR(prefixed_keys);
+	array_init_size(prefixed_keys, zend_hash_num_elements(Z_ARRVAL_P(keys)));
+	
+	if (!phalcon_is_iterable(keys, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_VALUE(key_name);
+	
+		PHALCON_INIT_NVAR(prefixed_key);
+		PHALCON_CONCAT_VV(prefixed_key, prefix, key_name);
+		phalcon_array_append(&prefixed_keys, prefixed_key, PH_SEPARATE TSRMLS_CC);
+	
+		zend_hash_move_forward_ex(ah0, &hp0);
+	}
+	
+	/** 
+	 * Memcache returns only the keys found
+	 */
+	PHALCON_INIT_VAR(cached_contents);
+	PHALCON_CALL_METHOD_PARAMS_1(cached_contents, memcache, "get", prefixed_keys);
+	
+	array_init(return_value);
+	
+	if (!phalcon_is_iterable(keys, &ah1, &hp1, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah1, (void**) &hd, &hp1) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_VALUE(key_name);
+	
+		PHALCON_INIT_NVAR(prefixed_key);
+		PHALCON_CONCAT_VV(prefixed_key, prefix, key_name);
+	
+		PHALCON_INIT_NVAR(content);
+		if (Z_TYPE_P(cached_contents) == IS_ARRAY) { 
+			if (phalcon_array_isset(cached_contents, prefixed_key)) {
+				PHALCON_OBS_NVAR(cached_content);
+				phalcon_array_fetch(&cached_content, cached_contents, prefixed_key, PH_NOISY_CC);
+				PHALCON_CALL_METHOD_PARAMS_1(content, frontend, "afterretrieve", cached_content);
+			}
+		}
+	
+		phalcon_array_update_zval(&return_value, key_name, &content, PH_COPY TSRMLS_CC);
+	
+		zend_hash_move_forward_ex(ah1, &hp1);
+	}
+	
+	PHALCON_MM_RESTORE();
+}
+
 /**
  * Stores cached content into the Memcached backend and stops the frontend
  *
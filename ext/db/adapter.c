@@ -64,6 +64,9 @@ PHALCON_INIT_CLASS(Phalcon_Db_Adapter){
 	zend_declare_property_null(phalcon_db_adapter_ce, SL("_sqlStatement"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_db_adapter_ce, SL("_sqlVariables"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_db_adapter_ce, SL("_sqlBindTypes"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_bool(phalcon_db_adapter_ce, SL("_useSchemaCache"), 0, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_db_adapter_ce, SL("_schemaCache"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_db_adapter_ce, SL("_schemaRows"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_long(phalcon_db_adapter_ce, SL("_connectionConsecutive"), 0, ZEND_ACC_PROTECTED|ZEND_ACC_STATIC TSRMLS_CC);
 
 	zend_class_implements(phalcon_db_adapter_ce TSRMLS_CC, 1, phalcon_events_eventsawareinterface_ce);
@@ -792,7 +795,7 @@ PHP_METHOD(Phalcon_Db_Adapter, limit){
 PHP_METHOD(Phalcon_Db_Adapter, tableExists){
 
 	zval *table_name, *schema_name = NULL, *dialect, *sql;
-	zval *fetch_num, *num, *first;
+	zval *fetch_num, *num, *first, *cached;
 
 	PHALCON_MM_GROW();
 
@@ -804,6 +807,10 @@ PHP_METHOD(Phalcon_Db_Adapter, tableExists){
 		PHALCON_INIT_VAR(schema_name);
 	}
 	
+	if (phalcon_db_adapter_schema_cache_fetch(&cached, this_ptr, "exists", table_name, schema_name TSRMLS_CC)) {
+		RETURN_CTOR(cached);
+	}
+	
 	PHALCON_OBS_VAR(dialect);
 	phalcon_read_property(&dialect, this_ptr, SL("_dialect"), PH_NOISY_CC);
 	
@@ -818,6 +825,8 @@ PHP_METHOD(Phalcon_Db_Adapter, tableExists){
 	
 	PHALCON_OBS_VAR(first);
 	phalcon_array_fetch_long(&first, num, 0, PH_NOISY_CC);
+	phalcon_db_adapter_schema_cache_store(this_ptr, "exists", table_name, schema_name, first TSRMLS_CC);
+	
 	RETURN_CCTOR(first);
 }
 
@@ -945,6 +954,7 @@ PHP_METHOD(Phalcon_Db_Adapter, createTable){
 	
 	PHALCON_INIT_VAR(success);
 	PHALCON_CALL_METHOD_PARAMS_1(success, this_ptr, "execute", sql);
+	phalcon_db_adapter_schema_cache_clear(this_ptr, table_name TSRMLS_CC);
 	
 	RETURN_CCTOR(success);
 }
@@ -981,6 +991,8 @@ PHP_METHOD(Phalcon_Db_Adapter, dropTable){
 	
 	PHALCON_INIT_VAR(success);
 	PHALCON_CALL_METHOD_PARAMS_1(success, this_ptr, "execute", sql);
+	phalcon_db_adapter_schema_cache_clear(this_ptr, table_name TSRMLS_CC);
+	
 	RETURN_CCTOR(success);
 }
 
@@ -1011,6 +1023,8 @@ PHP_METHOD(Phalcon_Db_Adapter, addColumn){
 	
 	PHALCON_INIT_VAR(success);
 	PHALCON_CALL_METHOD_PARAMS_1(success, this_ptr, "execute", sql);
+	phalcon_db_adapter_schema_cache_clear(this_ptr, table_name TSRMLS_CC);
+	
 	RETURN_CCTOR(success);
 }
 
@@ -1041,6 +1055,8 @@ PHP_METHOD(Phalcon_Db_Adapter, modifyColumn){
 	
 	PHALCON_INIT_VAR(success);
 	PHALCON_CALL_METHOD_PARAMS_1(success, this_ptr, "execute", sql);
+	phalcon_db_adapter_schema_cache_clear(this_ptr, table_name TSRMLS_CC);
+	
 	RETURN_CCTOR(success);
 }
 
@@ -1071,6 +1087,8 @@ PHP_METHOD(Phalcon_Db_Adapter, dropColumn){
 	
 	PHALCON_INIT_VAR(success);
 	PHALCON_CALL_METHOD_PARAMS_1(success, this_ptr, "execute", sql);
+	phalcon_db_adapter_schema_cache_clear(this_ptr, table_name TSRMLS_CC);
+	
 	RETURN_CCTOR(success);
 }
 
@@ -1101,6 +1119,8 @@ PHP_METHOD(Phalcon_Db_Adapter, addIndex){
 	
 	PHALCON_INIT_VAR(success);
 	PHALCON_CALL_METHOD_PARAMS_1(success, this_ptr, "execute", sql);
+	phalcon_db_adapter_schema_cache_clear(this_ptr, table_name TSRMLS_CC);
+	
 	RETURN_CCTOR(success);
 }
 
@@ -1131,6 +1151,8 @@ PHP_METHOD(Phalcon_Db_Adapter, dropIndex){
 	
 	PHALCON_INIT_VAR(success);
 	PHALCON_CALL_METHOD_PARAMS_1(success, this_ptr, "execute", sql);
+	phalcon_db_adapter_schema_cache_clear(this_ptr, table_name TSRMLS_CC);
+	
 	RETURN_CCTOR(success);
 }
 
@@ -1160,6 +1182,8 @@ PHP_METHOD(Phalcon_Db_Adapter, addPrimaryKey){
 	
 	PHALCON_INIT_VAR(success);
 	PHALCON_CALL_METHOD_PARAMS_1(success, this_ptr, "execute", sql);
+	phalcon_db_adapter_schema_cache_clear(this_ptr, table_name TSRMLS_CC);
+	
 	RETURN_CCTOR(success);
 }
 
@@ -1189,6 +1213,8 @@ PHP_METHOD(Phalcon_Db_Adapter, dropPrimaryKey){
 	
 	PHALCON_INIT_VAR(success);
 	PHALCON_CALL_METHOD_PARAMS_1(success, this_ptr, "execute", sql);
+	phalcon_db_adapter_schema_cache_clear(this_ptr, table_name TSRMLS_CC);
+	
 	RETURN_CCTOR(success);
 }
 
@@ -1219,6 +1245,8 @@ PHP_METHOD(Phalcon_Db_Adapter, addForeignKey){
 	
 	PHALCON_INIT_VAR(success);
 	PHALCON_CALL_METHOD_PARAMS_1(success, this_ptr, "execute", sql);
+	phalcon_db_adapter_schema_cache_clear(this_ptr, table_name TSRMLS_CC);
+	
 	RETURN_CCTOR(success);
 }
 
@@ -1249,6 +1277,8 @@ PHP_METHOD(Phalcon_Db_Adapter, dropForeignKey){
 	
 	PHALCON_INIT_VAR(success);
 	PHALCON_CALL_METHOD_PARAMS_1(success, this_ptr, "execute", sql);
+	phalcon_db_adapter_schema_cache_clear(this_ptr, table_name TSRMLS_CC);
+	
 	RETURN_CCTOR(success);
 }
 
@@ -1347,6 +1377,390 @@ PHP_METHOD(Phalcon_Db_Adapter, listTables){
 	RETURN_CTOR(all_tables);
 }
 
+/**
+ * Builds the key of an entry in the schema cache
+ */
+static int phalcon_db_adapter_schema_key(char **key, char *kind, zval *table, zval *schema){
+
+	return spprintf(key, 0, "%s:%s.%s", kind,
+		schema && Z_TYPE_P(schema) == IS_STRING ? Z_STRVAL_P(schema) : "",
+		Z_TYPE_P(table) == IS_STRING ? Z_STRVAL_P(table) : "");
+}
+
+/**
+ * Looks up an entry in an array property of the schema cache
+ */
+static int phalcon_db_adapter_schema_find(zval **value, zval *adapter, char *property, unsigned int property_length, char *kind, zval *table, zval *schema TSRMLS_DC){
+
+	zval *entries, **entry;
+	char *key;
+	int key_length, found = 0;
+
+	entries = zend_read_property(phalcon_db_adapter_ce, adapter, property, property_length, 1 TSRMLS_CC);
+	if (Z_TYPE_P(entries) != IS_ARRAY) {
+		return 0;
+	}
+
+	key_length = phalcon_db_adapter_schema_key(&key, kind, table, schema);
+	if (zend_hash_find(Z_ARRVAL_P(entries), key, key_length + 1, (void**) &entry) == SUCCESS) {
+		*value = *entry;
+		found = 1;
+	}
+	efree(key);
+
+	return found;
+}
+
+/**
+ * Returns a describe result stored in the schema cache of the connection
+ */
+int phalcon_db_adapter_schema_cache_fetch(zval **value, zval *adapter, char *kind, zval *table, zval *schema TSRMLS_DC){
+
+	zval *use_cache;
+
+	use_cache = zend_read_property(phalcon_db_adapter_ce, adapter, SL("_useSchemaCache"), 1 TSRMLS_CC);
+	if (!zend_is_true(use_cache)) {
+		return 0;
+	}
+
+	return phalcon_db_adapter_schema_find(value, adapter, SL("_schemaCache"), kind, table, schema TSRMLS_CC);
+}
+
+/**
+ * Returns the catalog rows of a table prefetched by Phalcon\Db\Adapter::loadSchema
+ */
+int phalcon_db_adapter_schema_rows(zval **rows, zval *adapter, char *kind, zval *table, zval *schema TSRMLS_DC){
+
+	return phalcon_db_adapter_schema_find(rows, adapter, SL("_schemaRows"), kind, table, schema TSRMLS_CC);
+}
+
+/**
+ * Stores a describe result in the schema cache of the connection
+ */
+void phalcon_db_adapter_schema_cache_store(zval *adapter, char *kind, zval *table, zval *schema, zval *value TSRMLS_DC){
+
+	zval *use_cache, *cache_key, *rows;
+	char *key;
+	int key_length;
+
+	use_cache = zend_read_property(phalcon_db_adapter_ce, adapter, SL("_useSchemaCache"), 1 TSRMLS_CC);
+	if (!zend_is_true(use_cache)) {
+		return;
+	}
+
+	key_length = phalcon_db_adapter_schema_key(&key, kind, table, schema);
+
+	/**
+	 * The prefetched rows aren't needed anymore
+	 */
+	rows = zend_read_property(phalcon_db_adapter_ce, adapter, SL("_schemaRows"), 1 TSRMLS_CC);
+	if (Z_TYPE_P(rows) == IS_ARRAY && Z_REFCOUNT_P(rows) == 1) {
+		zend_hash_del(Z_ARRVAL_P(rows), key, key_length + 1);
+	}
+
+	MAKE_STD_ZVAL(cache_key);
+	ZVAL_STRINGL(cache_key, key, key_length, 0);
+	phalcon_update_property_array(adapter, SL("_schemaCache"), cache_key, value TSRMLS_CC);
+	zval_ptr_dtor(&cache_key);
+}
+
+/**
+ * Removes from an array property the schema entries of a table, or all of them
+ */
+static void phalcon_db_adapter_schema_remove(zval *adapter, char *property, unsigned int property_length, zval *table TSRMLS_DC){
+
+	zval *entries, *remaining, **entry;
+	char *key, *suffix;
+	uint key_length;
+	ulong num_key;
+	int suffix_length;
+	HashPosition hp;
+
+	entries = zend_read_property(phalcon_db_adapter_ce, adapter, property, property_length, 1 TSRMLS_CC);
+	if (Z_TYPE_P(entries) != IS_ARRAY) {
+		return;
+	}
+
+	if (!table || Z_TYPE_P(table) != IS_STRING) {
+		zend_update_property_null(phalcon_db_adapter_ce, adapter, property, property_length TSRMLS_CC);
+		return;
+	}
+
+	suffix_length = spprintf(&suffix, 0, ".%s", Z_STRVAL_P(table));
+
+	MAKE_STD_ZVAL(remaining);
+	array_init(remaining);
+
+	zend_hash_internal_pointer_reset_ex(Z_ARRVAL_P(entries), &hp);
+	while (zend_hash_get_current_data_ex(Z_ARRVAL_P(entries), (void**) &entry, &hp) == SUCCESS) {
+		if (zend_hash_get_current_key_ex(Z_ARRVAL_P(entries), &key, &key_length, &num_key, 0, &hp) == HASH_KEY_IS_STRING) {
+			if ((int) key_length - 1 < suffix_length || memcmp(key + key_length - 1 - suffix_length, suffix, suffix_length)) {
+				Z_ADDREF_PP(entry);
+				add_assoc_zval_ex(remaining, key, key_length, *entry);
+			}
+		}
+		zend_hash_move_forward_ex(Z_ARRVAL_P(entries), &hp);
+	}
+
+	efree(suffix);
+
+	zend_update_property(phalcon_db_adapter_ce, adapter, property, property_length, remaining TSRMLS_CC);
+	zval_ptr_dtor(&remaining);
+}
+
+/**
+ * Invalidates the schema cache of a table after a DDL statement, or the whole cache if no table is passed
+ */
+void phalcon_db_adapter_schema_cache_clear(zval *adapter, zval *table TSRMLS_DC){
+
+	phalcon_db_adapter_schema_remove(adapter, SL("_schemaCache"), table TSRMLS_CC);
+	phalcon_db_adapter_schema_remove(adapter, SL("_schemaRows"), table TSRMLS_CC);
+}
+
+/**
+ * Enables/disables the schema cache of the connection. When enabled, the results of describeColumns,
+ * describeIndexes, describeReferences and tableExists are kept until a DDL method changes the table
+ *
+ *<code>
+ * $connection->useSchemaCache(true);
+ *</code>
+ *
+ * @param boolean $useCache
+ */
+PHP_METHOD(Phalcon_Db_Adapter, useSchemaCache){
+
+	zval *use_cache;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &use_cache) == FAILURE) {
+		RETURN_NULL();
+	}
+
+	if (!zend_is_true(use_cache)) {
+		phalcon_db_adapter_schema_cache_clear(this_ptr, NULL TSRMLS_CC);
+	}
+
+	phalcon_update_property_bool(this_ptr, SL("_useSchemaCache"), zend_is_true(use_cache) TSRMLS_CC);
+	
+}
+
+/**
+ * Clears the schema cache of a table or the whole cache. Use it after changing the schema without
+ * using the DDL methods of the adapter
+ *
+ *<code>
+ * $connection->execute("ALTER TABLE robots ADD COLUMN weight INT");
+ * $connection->clearSchemaCache("robots");
+ *</code>
+ *
+ * @param string $tableName
+ */
+PHP_METHOD(Phalcon_Db_Adapter, clearSchemaCache){
+
+	zval *table_name = NULL;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|z", &table_name) == FAILURE) {
+		RETURN_NULL();
+	}
+
+	phalcon_db_adapter_schema_cache_clear(this_ptr, table_name TSRMLS_CC);
+	
+}
+
+/**
+ * Loads the columns, indexes and references of every table in a schema with one query per
+ * catalog and enables the schema cache. The describe methods are then served from memory.
+ * Returns the tables loaded
+ *
+ *<code>
+ * $connection->loadSchema();
+ * $columns = $connection->describeColumns("robots"); //No query is executed
+ *</code>
+ *
+ * @param string $schemaName
+ * @return array
+ */
+PHP_METHOD(Phalcon_Db_Adapter, loadSchema){
+
+	zval *schema_name = NULL, *dialect, *fetch_num, *tables = NULL;
+	zval *table = NULL, *result = NULL, *one = NULL, *kinds, *kind = NULL;
+	zval *method = NULL, *sql = NULL, *rows = NULL, *grouped = NULL;
+	zval *group = NULL, *row = NULL, *schema_rows, *empty_rows;
+	zval *table_name = NULL, **last, **group_ptr, *new_group;
+	char *key;
+	int key_length;
+	HashTable *ah0, *ah1, *ah2;
+	HashPosition hp0, hp1, hp2;
+	zval **hd;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|z", &schema_name) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!schema_name) {
+		PHALCON_INIT_VAR(schema_name);
+	}
+	
+	phalcon_update_property_bool(this_ptr, SL("_useSchemaCache"), 1 TSRMLS_CC);
+	
+	PHALCON_INIT_VAR(one);
+	ZVAL_LONG(one, 1);
+	
+	PHALCON_OBS_VAR(dialect);
+	phalcon_read_property(&dialect, this_ptr, SL("_dialect"), PH_NOISY_CC);
+	
+	/** 
+	 * Dialects without catalog queries are loaded table by table
+	 */
+	if (phalcon_method_exists_ex(dialect, SS("describeschemacolumns") TSRMLS_CC) == FAILURE) {
+	
+		PHALCON_INIT_VAR(tables);
+		PHALCON_CALL_METHOD_PARAMS_1(tables, this_ptr, "listtables", schema_name);
+	
+		if (!phalcon_is_iterable(tables, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+			return;
+		}
+	
+		while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+			PHALCON_GET_FOREACH_VALUE(table);
+	
+			PHALCON_INIT_NVAR(result);
+			PHALCON_CALL_METHOD_PARAMS_2(result, this_ptr, "describecolumns", table, schema_name);
+	
+			PHALCON_INIT_NVAR(result);
+			PHALCON_CALL_METHOD_PARAMS_2(result, this_ptr, "describeindexes", table, schema_name);
+	
+			PHALCON_INIT_NVAR(result);
+			PHALCON_CALL_METHOD_PARAMS_2(result, this_ptr, "describereferences", table, schema_name);
+	
+			phalcon_db_adapter_schema_cache_store(this_ptr, "exists", table, schema_name, one TSRMLS_CC);
+	
+			zend_hash_move_forward_ex(ah0, &hp0);
+		}
+	
+		RETURN_CCTOR(tables);
+	}
+	
+	PHALCON_INIT_VAR(fetch_num);
+	ZVAL_LONG(fetch_num, 3);
+	
+	PHALCON_INIT_VAR(kinds);
+	array_init_size(kinds, 3);
+	add_assoc_stringl_ex(kinds, SS("columns"), SL("describeschemacolumns"), 1);
+	add_assoc_stringl_ex(kinds, SS("indexes"), SL("describeschemaindexes"), 1);
+	add_assoc_stringl_ex(kinds, SS("references"), SL("describeschemareferences"), 1);
+	
+	PHALCON_INIT_VAR(schema_rows);
+	array_init(schema_rows);
+	
+	PHALCON_INIT_NVAR(tables);
+	array_init(tables);
+	
+	phalcon_is_iterable(kinds, &ah0, &hp0, 0, 0 TSRMLS_CC);
+	
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_KEY(kind, ah0, hp0);
+		PHALCON_GET_FOREACH_VALUE(method);
+	
+		PHALCON_INIT_NVAR(sql);
+		PHALCON_CALL_METHOD_PARAMS_1(sql, dialect, Z_STRVAL_P(method), schema_name);
+	
+		PHALCON_INIT_NVAR(rows);
+		PHALCON_CALL_METHOD_PARAMS_2(rows, this_ptr, "fetchall", sql, fetch_num);
+	
+		/** 
+		 * The catalog queries return the name of the table in the last column
+		 */
+		PHALCON_INIT_NVAR(grouped);
+		array_init(grouped);
+	
+		if (phalcon_is_iterable(rows, &ah1, &hp1, 0, 0 TSRMLS_CC)) {
+	
+			while (zend_hash_get_current_data_ex(ah1, (void**) &hd, &hp1) == SUCCESS) {
+	
+				PHALCON_GET_FOREACH_VALUE(row);
+	
+				if (Z_TYPE_P(row) == IS_ARRAY) {
+					zend_hash_internal_pointer_end(Z_ARRVAL_P(row));
+					if (zend_hash_get_current_data(Z_ARRVAL_P(row), (void**) &last) == SUCCESS && Z_TYPE_PP(last) == IS_STRING) {
+						if (zend_hash_find(Z_ARRVAL_P(grouped), Z_STRVAL_PP(last), Z_STRLEN_PP(last) + 1, (void**) &group_ptr) != SUCCESS) {
+							MAKE_STD_ZVAL(new_group);
+							array_init(new_group);
+							zend_hash_update(Z_ARRVAL_P(grouped), Z_STRVAL_PP(last), Z_STRLEN_PP(last) + 1, (void*) &new_group, sizeof(zval*), (void**) &group_ptr);
+						}
+						Z_ADDREF_P(row);
+						add_next_index_zval(*group_ptr, row);
+					}
+				}
+	
+				zend_hash_move_forward_ex(ah1, &hp1);
+			}
+		}
+	
+		phalcon_is_iterable(grouped, &ah2, &hp2, 0, 0 TSRMLS_CC);
+	
+		while (zend_hash_get_current_data_ex(ah2, (void**) &hd, &hp2) == SUCCESS) {
+	
+			PHALCON_GET_FOREACH_KEY(table_name, ah2, hp2);
+			PHALCON_GET_FOREACH_VALUE(group);
+	
+			key_length = phalcon_db_adapter_schema_key(&key, Z_STRVAL_P(kind), table_name, schema_name);
+			Z_ADDREF_P(group);
+			add_assoc_zval_ex(schema_rows, key, key_length + 1, group);
+			efree(key);
+	
+			/** 
+			 * Every table has columns so they give the list of tables loaded
+			 */
+			if (PHALCON_IS_STRING(kind, "columns")) {
+				phalcon_array_append(&tables, table_name, PH_SEPARATE TSRMLS_CC);
+			}
+	
+			zend_hash_move_forward_ex(ah2, &hp2);
+		}
+	
+		zend_hash_move_forward_ex(ah0, &hp0);
+	}
+	
+	/** 
+	 * Tables without indexes or references get empty results and every loaded table exists
+	 */
+	PHALCON_INIT_VAR(empty_rows);
+	array_init(empty_rows);
+	
+	phalcon_is_iterable(tables, &ah0, &hp0, 0, 0 TSRMLS_CC);
+	
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_VALUE(table);
+	
+		key_length = phalcon_db_adapter_schema_key(&key, "indexes", table, schema_name);
+		if (!zend_hash_exists(Z_ARRVAL_P(schema_rows), key, key_length + 1)) {
+			Z_ADDREF_P(empty_rows);
+			add_assoc_zval_ex(schema_rows, key, key_length + 1, empty_rows);
+		}
+		efree(key);
+	
+		key_length = phalcon_db_adapter_schema_key(&key, "references", table, schema_name);
+		if (!zend_hash_exists(Z_ARRVAL_P(schema_rows), key, key_length + 1)) {
+			Z_ADDREF_P(empty_rows);
+			add_assoc_zval_ex(schema_rows, key, key_length + 1, empty_rows);
+		}
+		efree(key);
+	
+		phalcon_db_adapter_schema_cache_store(this_ptr, "exists", table, schema_name, one TSRMLS_CC);
+	
+		zend_hash_move_forward_ex(ah0, &hp0);
+	}
+	
+	phalcon_update_property_zval(this_ptr, SL("_schemaRows"), schema_rows TSRMLS_CC);
+	
+	RETURN_CTOR(tables);
+}
+
 /**
  * Return descriptor used to connect to the active database
  *
@@ -19,6 +19,11 @@
 
 extern zend_class_entry *phalcon_db_adapter_ce;
 
+extern int phalcon_db_adapter_schema_cache_fetch(zval **value, zval *adapter, char *kind, zval *table, zval *schema TSRMLS_DC);
+extern int phalcon_db_adapter_schema_rows(zval **rows, zval *adapter, char *kind, zval *table, zval *schema TSRMLS_DC);
+extern void phalcon_db_adapter_schema_cache_store(zval *adapter, char *kind, zval *table, zval *schema, zval *value TSRMLS_DC);
+extern void phalcon_db_adapter_schema_cache_clear(zval *adapter, zval *table TSRMLS_DC);
+
 PHALCON_INIT_CLASS(Phalcon_Db_Adapter);
 
 PHP_METHOD(Phalcon_Db_Adapter, __construct);
@@ -48,6 +53,9 @@ PHP_METHOD(Phalcon_Db_Adapter, addForeignKey);
 PHP_METHOD(Phalcon_Db_Adapter, dropForeignKey);
 PHP_METHOD(Phalcon_Db_Adapter, getColumnDefinition);
 PHP_METHOD(Phalcon_Db_Adapter, listTables);
+PHP_METHOD(Phalcon_Db_Adapter, useSchemaCache);
+PHP_METHOD(Phalcon_Db_Adapter, clearSchemaCache);
+PHP_METHOD(Phalcon_Db_Adapter, loadSchema);
 PHP_METHOD(Phalcon_Db_Adapter, getDescriptor);
 PHP_METHOD(Phalcon_Db_Adapter, getConnectionId);
 PHP_METHOD(Phalcon_Db_Adapter, getSQLStatement);
@@ -198,6 +206,18 @@ ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_db_adapter_listtables, 0, 0, 0)
 	ZEND_ARG_INFO(0, schemaName)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_db_adapter_useschemacache, 0, 0, 1)
+	ZEND_ARG_INFO(0, useCache)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_db_adapter_clearschemacache, 0, 0, 0)
+	ZEND_ARG_INFO(0, tableName)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_db_adapter_loadschema, 0, 0, 0)
+	ZEND_ARG_INFO(0, schemaName)
+ZEND_END_ARG_INFO()
+
 PHALCON_INIT_FUNCS(phalcon_db_adapter_method_entry){
 	PHP_ME(Phalcon_Db_Adapter, __construct, NULL, ZEND_ACC_PROTECTED|ZEND_ACC_CTOR) 
 	PHP_ME(Phalcon_Db_Adapter, setEventsManager, arginfo_phalcon_db_adapter_seteventsmanager, ZEND_ACC_PUBLIC) 
@@ -226,6 +246,9 @@ PHALCON_INIT_FUNCS(phalcon_db_adapter_method_entry){
 	PHP_ME(Phalcon_Db_Adapter, dropForeignKey, arginfo_phalcon_db_adapter_dropforeignkey, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Db_Adapter, getColumnDefinition, arginfo_phalcon_db_adapter_getcolumndefinition, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Db_Adapter, listTables, arginfo_phalcon_db_adapter_listtables, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Db_Adapter, useSchemaCache, arginfo_phalcon_db_adapter_useschemacache, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Db_Adapter, clearSchemaCache, arginfo_phalcon_db_adapter_clearschemacache, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Db_Adapter, loadSchema, arginfo_phalcon_db_adapter_loadschema, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Db_Adapter, getDescriptor, NULL, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Db_Adapter, getConnectionId, NULL, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Db_Adapter, getSQLStatement, NULL, ZEND_ACC_PUBLIC) 
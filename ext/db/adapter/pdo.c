@@ -41,6 +41,7 @@
 #include "kernel/string.h"
 #include "kernel/operators.h"
 #include "kernel/file.h"
+#include "kernel/persistent.h"
 
 /**
  * Phalcon\Db\Adapter\Pdo
@@ -69,10 +70,42 @@ PHALCON_INIT_CLASS(Phalcon_Db_Adapter_Pdo){
 	zend_declare_property_null(phalcon_db_adapter_pdo_ce, SL("_pdo"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_db_adapter_pdo_ce, SL("_affectedRows"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_long(phalcon_db_adapter_pdo_ce, SL("_transactionLevel"), 0, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_db_adapter_pdo_ce, SL("_boundParamsCache"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_db_adapter_pdo_ce, SL("_poolKey"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_long(phalcon_db_adapter_pdo_ce, SL("_poolSlot"), -1, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_db_adapter_pdo_ce, SL("_commitCallbacks"), ZEND_ACC_PROTECTED TSRMLS_CC);
 
 	return SUCCESS;
 }
 
+/**
+ * Returns the pooled connection of an adapter to its pool, a transaction left open is rolled
+ * back first. The slot is always released, even if the connection fails while rolling back
+ */
+static void phalcon_db_adapter_pdo_release(zval *this_ptr TSRMLS_DC){
+
+	zval *pool_key, *pool_slot, *pdo;
+	int rolled_back = 0;
+
+	pool_key = zend_read_property(phalcon_db_adapter_pdo_ce, this_ptr, SL("_poolKey"), 1 TSRMLS_CC);
+	if (Z_TYPE_P(pool_key) != IS_STRING) {
+		return;
+	}
+
+	pdo = zend_read_property(phalcon_db_adapter_pdo_ce, this_ptr, SL("_pdo"), 1 TSRMLS_CC);
+	if (Z_TYPE_P(pdo) == IS_OBJECT) {
+		rolled_back = phalcon_persistent_rollback(pdo TSRMLS_CC);
+	}
+
+	pool_slot = zend_read_property(phalcon_db_adapter_pdo_ce, this_ptr, SL("_poolSlot"), 1 TSRMLS_CC);
+	phalcon_persistent_release(Z_STRVAL_P(pool_key), Z_STRLEN_P(pool_key), phalcon_get_intval(pool_slot), rolled_back TSRMLS_CC);
+
+	phalcon_update_property_null(this_ptr, SL("_poolKey") TSRMLS_CC);
+	phalcon_update_property_long(this_ptr, SL("_poolSlot"), -1 TSRMLS_CC);
+	phalcon_update_property_long(this_ptr, SL("_transactionLevel"), 0 TSRMLS_CC);
+	phalcon_update_property_null(this_ptr, SL("_commitCallbacks") TSRMLS_CC);
+}
+
 /**
  * Constructor for Phalcon\Db\Adapter\Pdo
  *
@@ -122,8 +155,13 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, connect){
 
 	zval *descriptor = NULL, *username = NULL, *password = NULL, *dsn_parts;
 	zval *value = NULL, *key = NULL, *dsn_attribute = NULL, *dsn_attributes = NULL;
-	zval *pdo_type, *dsn, *options = NULL, *persistent, *pdo;
+	zval *pdo_type, *dsn, *options = NULL, *persistent = NULL, *pool_size = NULL;
+	zval *ping_interval = NULL, *persistent_id = NULL;
+	zval *pdo = NULL;
 	zend_class_entry *ce;
+	char key[33], *handler_key;
+	int handler_key_length;
+	long slot = -1, idle = -1, generation = 0;
 	HashTable *ah0;
 	HashPosition hp0;
 	zval **hd;
@@ -167,6 +205,42 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, connect){
 		PHALCON_INIT_NVAR(password);
 	}
 
+	/**
+	 * Persistent connections are taken from a pool of the worker, 'poolSize' limits the
+	 * number of connections of the pool and 'pingInterval' the idle seconds before a
+	 * reused connection is validated
+	 */
+	if (phalcon_array_isset_string(descriptor, SS("persistent"))) {
+		PHALCON_OBS_NVAR(persistent);
+		phalcon_array_fetch_string(&persistent, descriptor, SL("persistent"), PH_NOISY_CC);
+		phalcon_array_unset_string(&descriptor, SS("persistent"), PH_SEPARATE);
+	} else {
+		PHALCON_INIT_NVAR(persistent);
+	}
+
+	if (phalcon_array_isset_string(descriptor, SS("poolSize"))) {
+		PHALCON_OBS_NVAR(pool_size);
+		phalcon_array_fetch_string(&pool_size, descriptor, SL("poolSize"), PH_NOISY_CC);
+		phalcon_array_unset_string(&descriptor, SS("poolSize"), PH_SEPARATE);
+	} else {
+		PHALCON_INIT_NVAR(pool_size);
+		ZVAL_LONG(pool_size, 4);
+	}
+
+	if (phalcon_array_isset_string(descriptor, SS("pingInterval"))) {
+		PHALCON_OBS_NVAR(ping_interval);
+		phalcon_array_fetch_string(&ping_interval, descriptor, SL("pingInterval"), PH_NOISY_CC);
+		phalcon_array_unset_string(&descriptor, SS("pingInterval"), PH_SEPARATE);
+	} else {
+		PHALCON_INIT_NVAR(ping_interval);
+		ZVAL_LONG(ping_interval, 30);
+	}
+
+	/**
+	 * A previous pooled connection is returned to the pool
+	 */
+	phalcon_db_adapter_pdo_release(this_ptr TSRMLS_CC);
+
 	/**
 	 * Check if the user has defined a custom dsn
 	 */
@@ -220,14 +294,22 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, connect){
 	phalcon_array_update_long_long(&options, PDO_ATTR_CURSOR, PDO_CURSOR_SCROLL, PH_SEPARATE TSRMLS_CC);
 
 	/**
-	 * Check if the connection must be persistent
+	 * Check if the connection must be persistent, every slot of the pool is an unique PDO
+	 * persistent connection. If every slot is busy a non-persistent connection is opened
 	 */
-	if (phalcon_array_isset_string(descriptor, SS("persistent"))) {
+	if (zend_is_true(persistent)) {
 
-		PHALCON_OBS_VAR(persistent);
-		phalcon_array_fetch_string(&persistent, descriptor, SL("persistent"), PH_NOISY_CC);
-		if (zend_is_true(persistent)) {
-			phalcon_array_update_long_bool(&options, PDO_ATTR_PERSISTENT, 1, PH_SEPARATE TSRMLS_CC);
+		phalcon_persistent_hash(key, dsn, username, password);
+
+		slot = phalcon_persistent_acquire(key, 32, phalcon_get_intval(pool_size), &idle, &generation TSRMLS_CC);
+		if (slot >= 0) {
+			phalcon_update_property_string(this_ptr, SL("_poolKey"), key, 32 TSRMLS_CC);
+			phalcon_update_property_long(this_ptr, SL("_poolSlot"), slot TSRMLS_CC);
+
+			PHALCON_INIT_NVAR(persistent_id);
+			Z_STRLEN_P(persistent_id) = spprintf(&Z_STRVAL_P(persistent_id), 0, "phalcon:%s:%ld:%ld", key, slot, generation);
+			Z_TYPE_P(persistent_id) = IS_STRING;
+			phalcon_array_update_long(&options, PDO_ATTR_PERSISTENT, &persistent_id, PH_COPY | PH_SEPARATE TSRMLS_CC);
 		}
 	}
 
@@ -236,10 +318,40 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, connect){
 	 */
 	ce = zend_fetch_class(SL("PDO"), ZEND_FETCH_CLASS_AUTO TSRMLS_CC);
 
-	PHALCON_INIT_VAR(pdo);
+	PHALCON_INIT_NVAR(pdo);
 	object_init_ex(pdo, ce);
 	PHALCON_CALL_METHOD_PARAMS_4_NORETURN(pdo, "__construct", dsn, username, password, options);
 
+	if (slot >= 0) {
+
+		/**
+		 * Connections reused after being idle too long are validated, a dead connection
+		 * is dropped from the persistent list and opened again
+		 */
+		if (idle >= 0 && idle >= phalcon_get_intval(ping_interval)) {
+			if (phalcon_persistent_ping(key, 32, pdo TSRMLS_CC) == FAILURE) {
+
+				handler_key_length = spprintf(&handler_key, 0, "PDO:DBH:DSN=%s:%s:%s:%s", Z_STRVAL_P(dsn),
+					Z_TYPE_P(username) == IS_STRING ? Z_STRVAL_P(username) : "",
+					Z_TYPE_P(password) == IS_STRING ? Z_STRVAL_P(password) : "",
+					Z_STRVAL_P(persistent_id));
+
+				PHALCON_INIT_NVAR(pdo);
+				generation = phalcon_persistent_discard(key, 32, slot, handler_key, handler_key_length TSRMLS_CC);
+				efree(handler_key);
+
+				PHALCON_INIT_NVAR(persistent_id);
+				Z_STRLEN_P(persistent_id) = spprintf(&Z_STRVAL_P(persistent_id), 0, "phalcon:%s:%ld:%ld", key, slot, generation);
+				Z_TYPE_P(persistent_id) = IS_STRING;
+				phalcon_array_update_long(&options, PDO_ATTR_PERSISTENT, &persistent_id, PH_COPY | PH_SEPARATE TSRMLS_CC);
+
+				PHALCON_INIT_NVAR(pdo);
+				object_init_ex(pdo, ce);
+				PHALCON_CALL_METHOD_PARAMS_4_NORETURN(pdo, "__construct", dsn, username, password, options);
+			}
+		}
+	}
+
 	phalcon_update_property_zval(this_ptr, SL("_pdo"), pdo TSRMLS_CC);
 
 	PHALCON_MM_RESTORE();}
@@ -381,23 +493,35 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, executePrepared){
  *	//Querying data
  *	$resultset = $connection->query("SELECT * FROM robots WHERE type='mechanical'");
  *	$resultset = $connection->query("SELECT * FROM robots WHERE type=?", array("mechanical"));
+ *
+ *	//Streaming a big result without buffering it on the client
+ *	$result = $connection->query("SELECT * FROM robots", null, null, true);
+ *	while ($robots = $result->fetchBatch(500)) {
+ *		foreach ($robots as $robot) {
+ *			//...
+ *		}
+ *	}
  *</code>
  *
+ * Unbuffered results keep the connection busy until all the rows are fetched,
+ * no other statement must be sent to the same connection in the meantime
+ *
  * @param  string $sqlStatement
  * @param  array $bindParams
  * @param  array $bindTypes
+ * @param  boolean $unbuffered
  * @return Phalcon\Db\ResultInterface
  */
 PHP_METHOD(Phalcon_Db_Adapter_Pdo, query){
 
 	zval *sql_statement, *bind_params = NULL, *bind_types = NULL;
-	zval *events_manager, *event_name = NULL, *status, *pdo;
-	zval *statement = NULL, *pdo_result;
+	zval *unbuffered = NULL, *events_manager, *event_name = NULL, *status;
+	zval *pdo, *type, *driver_options, *statement = NULL, *pdo_result;
 	zval *r0 = NULL;
 
 	PHALCON_MM_GROW();
 
-	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|zz", &sql_statement, &bind_params, &bind_types) == FAILURE) {
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|zzz", &sql_statement, &bind_params, &bind_types, &unbuffered) == FAILURE) {
 		RETURN_MM_NULL();
 	}
 
@@ -409,6 +533,11 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, query){
 		PHALCON_INIT_VAR(bind_types);
 	}
 	
+	if (!unbuffered) {
+		PHALCON_INIT_VAR(unbuffered);
+		ZVAL_BOOL(unbuffered, 0);
+	}
+	
 	PHALCON_OBS_VAR(events_manager);
 	phalcon_read_property(&events_manager, this_ptr, SL("_eventsManager"), PH_NOISY_CC);
 	
@@ -432,18 +561,46 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, query){
 	
 	PHALCON_OBS_VAR(pdo);
 	phalcon_read_property(&pdo, this_ptr, SL("_pdo"), PH_NOISY_CC);
-	if (Z_TYPE_P(bind_params) == IS_ARRAY) { 
+	if (zend_is_true(unbuffered)) {
+	
+		/** 
+		 * Only MySQL buffers the whole resultset on the client by default, the statement
+		 * is prepared asking the driver to stream the rows from the server instead
+		 */
+		PHALCON_OBS_VAR(type);
+		phalcon_read_property(&type, this_ptr, SL("_type"), PH_NOISY_CC);
+	
+		PHALCON_INIT_VAR(driver_options);
+		array_init_size(driver_options, 1);
+		if (PHALCON_IS_STRING(type, "mysql")) {
+			phalcon_array_update_long_bool(&driver_options, PDO_MYSQL_ATTR_USE_BUFFERED_QUERY, 0, PH_SEPARATE TSRMLS_CC);
+		}
 	
 		PHALCON_INIT_VAR(statement);
-		PHALCON_CALL_METHOD_PARAMS_1(statement, pdo, "prepare", sql_statement);
+		PHALCON_CALL_METHOD_PARAMS_2(statement, pdo, "prepare", sql_statement, driver_options);
 		if (Z_TYPE_P(statement) == IS_OBJECT) {
-			PHALCON_INIT_VAR(r0);
-			PHALCON_CALL_METHOD_PARAMS_3(r0, this_ptr, "executeprepared", statement, bind_params, bind_types);
-			PHALCON_CPY_WRT(statement, r0);
+			if (Z_TYPE_P(bind_params) == IS_ARRAY) { 
+				PHALCON_INIT_VAR(r0);
+				PHALCON_CALL_METHOD_PARAMS_3(r0, this_ptr, "executeprepared", statement, bind_params, bind_types);
+				PHALCON_CPY_WRT(statement, r0);
+			} else {
+				PHALCON_CALL_METHOD_NORETURN(statement, "execute");
+			}
 		}
 	} else {
-		PHALCON_INIT_NVAR(statement);
-		PHALCON_CALL_METHOD_PARAMS_1(statement, pdo, "query", sql_statement);
+		if (Z_TYPE_P(bind_params) == IS_ARRAY) { 
+	
+			PHALCON_INIT_VAR(statement);
+			PHALCON_CALL_METHOD_PARAMS_1(statement, pdo, "prepare", sql_statement);
+			if (Z_TYPE_P(statement) == IS_OBJECT) {
+				PHALCON_INIT_VAR(r0);
+				PHALCON_CALL_METHOD_PARAMS_3(r0, this_ptr, "executeprepared", statement, bind_params, bind_types);
+				PHALCON_CPY_WRT(statement, r0);
+			}
+		} else {
+			PHALCON_INIT_NVAR(statement);
+			PHALCON_CALL_METHOD_PARAMS_1(statement, pdo, "query", sql_statement);
+		}
 	}
 	
 	/** 
@@ -586,16 +743,35 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, close){
 
 	PHALCON_MM_GROW();
 
+	/** 
+	 * Pooled connections are returned to the pool rolling back any open transaction
+	 */
+	phalcon_db_adapter_pdo_release(this_ptr TSRMLS_CC);
+	
 	PHALCON_OBS_VAR(pdo);
 	phalcon_read_property(&pdo, this_ptr, SL("_pdo"), PH_NOISY_CC);
 	if (Z_TYPE_P(pdo) == IS_OBJECT) {
 		phalcon_update_property_null(this_ptr, SL("_pdo") TSRMLS_CC);
+		phalcon_update_property_null(this_ptr, SL("_commitCallbacks") TSRMLS_CC);
 		RETURN_MM_TRUE;
 	}
 	
 	RETURN_MM_TRUE;
 }
 
+/**
+ * Returns the pooled connection to its pool when the adapter is destroyed without being closed
+ */
+PHP_METHOD(Phalcon_Db_Adapter_Pdo, __destruct){
+
+
+	PHALCON_MM_GROW();
+
+	phalcon_db_adapter_pdo_release(this_ptr TSRMLS_CC);
+
+	PHALCON_MM_RESTORE();
+}
+
 /**
  * Escapes a column/table/schema name
  *
@@ -764,6 +940,9 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, bindParams){
 /**
  * Converts bound parameters such as :name: or ?1 into PDO bind params ?
  *
+ * The SQL is scanned once, placeholders inside quoted strings, quoted identifiers
+ * and comments are ignored. The rewritten SQL is cached per SQL statement
+ *
  *<code>
  * print_r($connection->convertBoundParams('SELECT * FROM robots WHERE name = :name:', array('Bender')));
  *</code>
@@ -774,12 +953,9 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, bindParams){
  */
 PHP_METHOD(Phalcon_Db_Adapter_Pdo, convertBoundParams){
 
-	zval *sql, *params, *query_params = NULL, *placeholders;
-	zval *matches, *set_order, *bind_pattern, *status = NULL;
-	zval *place_match = NULL, *numeric_place = NULL, *value = NULL, *str_place = NULL;
-	zval *question, *bound_sql = NULL;
-	zval *r0 = NULL;
-	zval *p0[] = { NULL, NULL, NULL, NULL };
+	zval *sql, *params, *query_params, *placeholders;
+	zval *bound_params_cache = NULL, *bound = NULL, *bound_sql = NULL;
+	zval *names = NULL, *name = NULL, *value = NULL, *type;
 	HashTable *ah0;
 	HashPosition hp0;
 	zval **hd;
@@ -790,80 +966,82 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, convertBoundParams){
 		RETURN_MM_NULL();
 	}
 
-	PHALCON_INIT_VAR(query_params);
-	array_init(query_params);
+	PHALCON_OBS_VAR(bound_params_cache);
+	phalcon_read_property(&bound_params_cache, this_ptr, SL("_boundParamsCache"), PH_NOISY_CC);
 	
-	PHALCON_INIT_VAR(placeholders);
-	array_init(placeholders);
+	/** 
+	 * Check if the statement was already rewritten
+	 */
+	if (phalcon_array_isset(bound_params_cache, sql)) {
+		PHALCON_OBS_VAR(bound);
+		phalcon_array_fetch(&bound, bound_params_cache, sql, PH_NOISY_CC);
 	
-	PHALCON_INIT_VAR(matches);
+		PHALCON_OBS_VAR(bound_sql);
+		phalcon_array_fetch_long(&bound_sql, bound, 0, PH_NOISY_CC);
 	
-	PHALCON_INIT_VAR(set_order);
-	ZVAL_LONG(set_order, 2);
+		PHALCON_OBS_VAR(names);
+		phalcon_array_fetch_long(&names, bound, 1, PH_NOISY_CC);
+	} else {
+		PHALCON_INIT_NVAR(names);
+		array_init(names);
 	
-	PHALCON_INIT_VAR(bind_pattern);
-	ZVAL_STRING(bind_pattern, "/\\?([0-9]+)|:([a-zA-Z0-9_]+):/", 1);
-	p0[0] = bind_pattern;
-	p0[1] = sql;
-	Z_SET_ISREF_P(matches);
-	p0[2] = matches;
-	p0[3] = set_order;
+		/** 
+		 * Only MySQL escapes quotes in string literals with backslashes
+		 */
+		PHALCON_OBS_VAR(type);
+		phalcon_read_property(&type, this_ptr, SL("_type"), PH_NOISY_CC);
 	
-	PHALCON_INIT_VAR(r0);
-	PHALCON_CALL_FUNC_PARAMS(r0, "preg_match_all", 4, p0);
-	Z_UNSET_ISREF_P(p0[2]);
-	PHALCON_CPY_WRT(status, r0);
-	if (zend_is_true(status)) {
+		PHALCON_INIT_NVAR(bound_sql);
+		phalcon_convert_bound_params(bound_sql, names, sql, PHALCON_IS_STRING(type, "mysql"));
 	
-		if (!phalcon_is_iterable(matches, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
-			return;
+		/** 
+		 * The cache is emptied when it is full to keep the memory bounded
+		 */
+		if (Z_TYPE_P(bound_params_cache) == IS_ARRAY) { 
+			if (zend_hash_num_elements(Z_ARRVAL_P(bound_params_cache)) >= 512) {
+				phalcon_update_property_null(this_ptr, SL("_boundParamsCache") TSRMLS_CC);
+			}
 		}
 	
-		while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+		if (Z_TYPE_P(sql) == IS_STRING) {
+			PHALCON_INIT_NVAR(bound);
+			array_init_size(bound, 2);
+			phalcon_array_append(&bound, bound_sql, PH_SEPARATE TSRMLS_CC);
+			phalcon_array_append(&bound, names, PH_SEPARATE TSRMLS_CC);
+			phalcon_update_property_array(this_ptr, SL("_boundParamsCache"), sql, bound TSRMLS_CC);
+		}
+	}
 	
-			PHALCON_GET_FOREACH_VALUE(place_match);
+	/** 
+	 * Order the values according to the placeholders
+	 */
+	PHALCON_INIT_VAR(placeholders);
+	array_init(placeholders);
 	
-			PHALCON_OBS_NVAR(numeric_place);
-			phalcon_array_fetch_long(&numeric_place, place_match, 1, PH_NOISY_CC);
-			if (phalcon_array_isset(params, numeric_place)) {
-				PHALCON_OBS_NVAR(value);
-				phalcon_array_fetch(&value, params, numeric_place, PH_NOISY_CC);
-			} else {
-				if (phalcon_array_isset_long(place_match, 2)) {
+	if (!phalcon_is_iterable(names, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+		return;
+	}
 	
-					PHALCON_OBS_NVAR(str_place);
-					phalcon_array_fetch_long(&str_place, place_match, 2, PH_NOISY_CC);
-					if (phalcon_array_isset(params, str_place)) {
-						PHALCON_OBS_NVAR(value);
-						phalcon_array_fetch(&value, params, str_place, PH_NOISY_CC);
-					} else {
-						PHALCON_THROW_EXCEPTION_STR(phalcon_db_exception_ce, "Matched parameter wasn't found in parameters list");
-						return;
-					}
-				} else {
-					PHALCON_THROW_EXCEPTION_STR(phalcon_db_exception_ce, "Matched parameter wasn't found in parameters list");
-					return;
-				}
-			}
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
 	
-			phalcon_array_append(&placeholders, value, PH_SEPARATE TSRMLS_CC);
+		PHALCON_GET_FOREACH_VALUE(name);
 	
-			zend_hash_move_forward_ex(ah0, &hp0);
+		if (!phalcon_array_isset(params, name)) {
+			PHALCON_THROW_EXCEPTION_STR(phalcon_db_exception_ce, "Matched parameter wasn't found in parameters list");
+			return;
 		}
 	
-		PHALCON_INIT_VAR(question);
-		ZVAL_STRING(question, "?", 1);
+		PHALCON_OBS_NVAR(value);
+		phalcon_array_fetch(&value, params, name, PH_NOISY_CC);
+		phalcon_array_append(&placeholders, value, PH_SEPARATE TSRMLS_CC);
 	
-		PHALCON_INIT_VAR(bound_sql);
-		PHALCON_CALL_FUNC_PARAMS_3(bound_sql, "preg_replace", bind_pattern, question, sql);
-	} else {
-		PHALCON_CPY_WRT(bound_sql, sql);
+		zend_hash_move_forward_ex(ah0, &hp0);
 	}
 	
 	/** 
 	 * Returns an array with the processed SQL and paramters
 	 */
-	PHALCON_INIT_NVAR(query_params);
+	PHALCON_INIT_VAR(query_params);
 	array_init_size(query_params, 2);
 	phalcon_array_update_string(&query_params, SL("sql"), &bound_sql, PH_COPY | PH_SEPARATE TSRMLS_CC);
 	phalcon_array_update_string(&query_params, SL("params"), &placeholders, PH_COPY | PH_SEPARATE TSRMLS_CC);
@@ -1007,6 +1185,11 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, rollback){
 		PHALCON_CALL_METHOD_PARAMS_2_NORETURN(events_manager, "fire", event_name, this_ptr);
 	}
 	
+	/** 
+	 * The callbacks waiting for the commit are discarded
+	 */
+	phalcon_update_property_null(this_ptr, SL("_commitCallbacks") TSRMLS_CC);
+	
 	PHALCON_INIT_VAR(status);
 	PHALCON_CALL_METHOD(status, pdo, "rollback");
 	
@@ -1022,6 +1205,11 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, commit){
 
 	zval *pdo, *transaction_level, *events_manager;
 	zval *event_name, *status;
+	zval *commit_callbacks, *commit_callback = NULL, *callback = NULL;
+	zval *parameters = NULL, *result = NULL;
+	HashTable *ah0;
+	HashPosition hp0;
+	zval **hd;
 
 	PHALCON_MM_GROW();
 
@@ -1060,6 +1248,37 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, commit){
 	PHALCON_INIT_VAR(status);
 	PHALCON_CALL_METHOD(status, pdo, "commit");
 	
+	/** 
+	 * Run the callbacks registered during the transaction once it's committed
+	 */
+	PHALCON_OBS_VAR(commit_callbacks);
+	phalcon_read_property(&commit_callbacks, this_ptr, SL("_commitCallbacks"), PH_NOISY_CC);
+	if (Z_TYPE_P(commit_callbacks) == IS_ARRAY) {
+	
+		phalcon_update_property_null(this_ptr, SL("_commitCallbacks") TSRMLS_CC);
+	
+		if (!phalcon_is_iterable(commit_callbacks, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+			return;
+		}
+	
+		while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+			PHALCON_GET_FOREACH_VALUE(commit_callback);
+	
+			PHALCON_OBS_NVAR(callback);
+			phalcon_array_fetch_long(&callback, commit_callback, 0, PH_NOISY_CC);
+	
+			PHALCON_OBS_NVAR(parameters);
+			phalcon_array_fetch_long(&parameters, commit_callback, 1, PH_NOISY_CC);
+	
+			PHALCON_INIT_NVAR(result);
+			PHALCON_CALL_USER_FUNC_ARRAY(result, callback, parameters);
+	
+			zend_hash_move_forward_ex(ah0, &hp0);
+		}
+	
+	}
+	
 	RETURN_CCTOR(status);
 }
 
@@ -1090,6 +1309,70 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, isUnderTransaction){
 	RETURN_MM_FALSE;
 }
 
+/**
+ * Registers a callback executed after the current transaction is committed. Callbacks
+ * registered with the same key are executed only once and all of them are discarded if the
+ * transaction is rolled back. Without an active transaction the callback is executed at once
+ *
+ *<code>
+ * $connection->begin();
+ * $connection->onCommit(function($id) {
+ *	echo 'robot ', $id, ' committed';
+ * }, array(10), 'robot-10');
+ * $connection->commit();
+ *</code>
+ *
+ * @param callable $callback
+ * @param array $parameters
+ * @param string $key
+ */
+PHP_METHOD(Phalcon_Db_Adapter_Pdo, onCommit){
+
+	zval *callback, *parameters = NULL, *key = NULL, *under_transaction;
+	zval *result, *commit_callback;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|zz", &callback, &parameters, &key) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!parameters) {
+		PHALCON_INIT_VAR(parameters);
+	} else {
+		PHALCON_SEPARATE_PARAM(parameters);
+	}
+	
+	if (!key) {
+		PHALCON_INIT_VAR(key);
+	}
+	
+	if (Z_TYPE_P(parameters) != IS_ARRAY) { 
+		PHALCON_INIT_NVAR(parameters);
+		array_init(parameters);
+	}
+	
+	PHALCON_INIT_VAR(under_transaction);
+	PHALCON_CALL_METHOD(under_transaction, this_ptr, "isundertransaction");
+	if (!zend_is_true(under_transaction)) {
+		PHALCON_INIT_VAR(result);
+		PHALCON_CALL_USER_FUNC_ARRAY(result, callback, parameters);
+		RETURN_MM_NULL();
+	}
+	
+	PHALCON_INIT_VAR(commit_callback);
+	array_init_size(commit_callback, 2);
+	phalcon_array_append(&commit_callback, callback, PH_SEPARATE TSRMLS_CC);
+	phalcon_array_append(&commit_callback, parameters, PH_SEPARATE TSRMLS_CC);
+	if (Z_TYPE_P(key) != IS_NULL) {
+		phalcon_update_property_array(this_ptr, SL("_commitCallbacks"), key, commit_callback TSRMLS_CC);
+	} else {
+		phalcon_update_property_array_append(this_ptr, SL("_commitCallbacks"), commit_callback TSRMLS_CC);
+	}
+	
+	PHALCON_MM_RESTORE();
+}
+
 /**
  * Return internal PDO handler
  *
@@ -1106,6 +1389,23 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, getInternalHandler){
 	RETURN_CCTOR(pdo);
 }
 
+/**
+ * Returns the statistics of the persistent connection pools of the current worker
+ *
+ *<code>
+ * foreach (Phalcon\Db\Adapter\Pdo::getPoolStats() as $hash => $pool) {
+ *	echo $hash, ' ', $pool['inUse'], '/', $pool['size'], ' ', $pool['pingFailures'], PHP_EOL;
+ * }
+ *</code>
+ *
+ * @return array
+ */
+PHP_METHOD(Phalcon_Db_Adapter_Pdo, getPoolStats){
+
+
+	phalcon_persistent_stats(return_value TSRMLS_CC);
+}
+
 /**
  * Lists table indexes
  *
@@ -1120,6 +1420,7 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, getInternalHandler){
 PHP_METHOD(Phalcon_Db_Adapter_Pdo, describeIndexes){
 
 	zval *table, *schema = NULL, *dialect, *fetch_num, *sql, *describe;
+	zval *cached, *prefetched;
 	zval *indexes, *index = NULL, *key_name = NULL, *empty_arr = NULL, *column_name = NULL;
 	zval *index_objects, *index_columns = NULL, *name = NULL;
 	HashTable *ah0, *ah1;
@@ -1136,6 +1437,13 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, describeIndexes){
 		PHALCON_INIT_VAR(schema);
 	}
 	
+	/** 
+	 * Check the schema cache of the connection
+	 */
+	if (phalcon_db_adapter_schema_cache_fetch(&cached, this_ptr, "indexes", table, schema TSRMLS_CC)) {
+		RETURN_CTOR(cached);
+	}
+	
 	PHALCON_OBS_VAR(dialect);
 	phalcon_read_property(&dialect, this_ptr, SL("_dialect"), PH_NOISY_CC);
 	
@@ -1154,8 +1462,15 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, describeIndexes){
 	/** 
 	 * Cryptic Guide: 2: table, 3: from, 4: to
 	 */
+	/** 
+	 * Use the catalog rows prefetched by loadSchema if they're available
+	 */
 	PHALCON_INIT_VAR(describe);
-	PHALCON_CALL_METHOD_PARAMS_2(describe, this_ptr, "fetchall", sql, fetch_num);
+	if (phalcon_db_adapter_schema_rows(&prefetched, this_ptr, "indexes", table, schema TSRMLS_CC)) {
+		ZVAL_ZVAL(describe, prefetched, 1, 0);
+	} else {
+		PHALCON_CALL_METHOD_PARAMS_2(describe, this_ptr, "fetchall", sql, fetch_num);
+	}
 	
 	PHALCON_INIT_VAR(indexes);
 	array_init(indexes);
@@ -1207,6 +1522,7 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, describeIndexes){
 		zend_hash_move_forward_ex(ah1, &hp1);
 	}
 	
+	phalcon_db_adapter_schema_cache_store(this_ptr, "indexes", table, schema, index_objects TSRMLS_CC);
 	
 	RETURN_CTOR(index_objects);
 }
@@ -1225,6 +1541,7 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, describeIndexes){
 PHP_METHOD(Phalcon_Db_Adapter_Pdo, describeReferences){
 
 	zval *table, *schema = NULL, *dialect, *fetch_num, *sql, *empty_arr;
+	zval *cached, *prefetched;
 	zval *references, *describe, *reference = NULL, *constraint_name = NULL;
 	zval *referenced_schema = NULL, *referenced_table = NULL;
 	zval *reference_array = NULL, *column_name = NULL, *referenced_columns = NULL;
@@ -1244,6 +1561,13 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, describeReferences){
 		PHALCON_INIT_VAR(schema);
 	}
 	
+	/** 
+	 * Check the schema cache of the connection
+	 */
+	if (phalcon_db_adapter_schema_cache_fetch(&cached, this_ptr, "references", table, schema TSRMLS_CC)) {
+		RETURN_CTOR(cached);
+	}
+	
 	PHALCON_OBS_VAR(dialect);
 	phalcon_read_property(&dialect, this_ptr, SL("_dialect"), PH_NOISY_CC);
 	
@@ -1268,8 +1592,15 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, describeReferences){
 	/** 
 	 * Execute the SQL returning the 
 	 */
+	/** 
+	 * Use the catalog rows prefetched by loadSchema if they're available
+	 */
 	PHALCON_INIT_VAR(describe);
-	PHALCON_CALL_METHOD_PARAMS_2(describe, this_ptr, "fetchall", sql, fetch_num);
+	if (phalcon_db_adapter_schema_rows(&prefetched, this_ptr, "references", table, schema TSRMLS_CC)) {
+		ZVAL_ZVAL(describe, prefetched, 1, 0);
+	} else {
+		PHALCON_CALL_METHOD_PARAMS_2(describe, this_ptr, "fetchall", sql, fetch_num);
+	}
 	
 	if (!phalcon_is_iterable(describe, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
 		return;
@@ -1348,6 +1679,7 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo, describeReferences){
 		zend_hash_move_forward_ex(ah1, &hp1);
 	}
 	
+	phalcon_db_adapter_schema_cache_store(this_ptr, "references", table, schema, reference_objects TSRMLS_CC);
 	
 	RETURN_CTOR(reference_objects);
 }
@@ -132,6 +132,7 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Mysql, escapeIdentifier){
 PHP_METHOD(Phalcon_Db_Adapter_Pdo_Mysql, describeColumns){
 
 	zval *table, *schema = NULL, *columns, *dialect, *sql, *fetch_num;
+	zval *cached, *prefetched;
 	zval *describe, *old_column = NULL, *size_pattern, *field = NULL;
 	zval *definition = NULL, *column_type = NULL, *matches = NULL, *pos = NULL;
 	zval *match_one = NULL, *attribute = NULL, *column_name = NULL, *column = NULL;
@@ -149,6 +150,13 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Mysql, describeColumns){
 		PHALCON_INIT_VAR(schema);
 	}
 	
+	/** 
+	 * Check the schema cache of the connection
+	 */
+	if (phalcon_db_adapter_schema_cache_fetch(&cached, this_ptr, "columns", table, schema TSRMLS_CC)) {
+		RETURN_CTOR(cached);
+	}
+	
 	PHALCON_INIT_VAR(columns);
 	array_init(columns);
 	
@@ -164,8 +172,15 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Mysql, describeColumns){
 	PHALCON_INIT_VAR(fetch_num);
 	ZVAL_LONG(fetch_num, 3);
 	
+	/** 
+	 * Use the catalog rows prefetched by loadSchema if they're available
+	 */
 	PHALCON_INIT_VAR(describe);
-	PHALCON_CALL_METHOD_PARAMS_2(describe, this_ptr, "fetchall", sql, fetch_num);
+	if (phalcon_db_adapter_schema_rows(&prefetched, this_ptr, "columns", table, schema TSRMLS_CC)) {
+		ZVAL_ZVAL(describe, prefetched, 1, 0);
+	} else {
+		PHALCON_CALL_METHOD_PARAMS_2(describe, this_ptr, "fetchall", sql, fetch_num);
+	}
 	
 	PHALCON_INIT_VAR(old_column);
 	
@@ -313,6 +328,7 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Mysql, describeColumns){
 		zend_hash_move_forward_ex(ah0, &hp0);
 	}
 	
+	phalcon_db_adapter_schema_cache_store(this_ptr, "columns", table, schema, columns TSRMLS_CC);
 	
 	RETURN_CTOR(columns);
 }
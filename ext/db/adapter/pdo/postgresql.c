@@ -137,6 +137,7 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Postgresql, connect){
 PHP_METHOD(Phalcon_Db_Adapter_Pdo_Postgresql, describeColumns){
 
 	zval *table, *schema = NULL, *columns, *dialect, *sql, *fetch_num;
+	zval *cached, *prefetched;
 	zval *describe, *old_column = NULL, *field = NULL, *definition = NULL;
 	zval *char_size = NULL, *numeric_size = NULL, *column_type = NULL;
 	zval *attribute = NULL, *column_name = NULL, *column = NULL;
@@ -154,6 +155,13 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Postgresql, describeColumns){
 		PHALCON_INIT_VAR(schema);
 	}
 	
+	/** 
+	 * Check the schema cache of the connection
+	 */
+	if (phalcon_db_adapter_schema_cache_fetch(&cached, this_ptr, "columns", table, schema TSRMLS_CC)) {
+		RETURN_CTOR(cached);
+	}
+	
 	PHALCON_INIT_VAR(columns);
 	array_init(columns);
 	
@@ -169,8 +177,15 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Postgresql, describeColumns){
 	PHALCON_INIT_VAR(fetch_num);
 	ZVAL_LONG(fetch_num, 3);
 	
+	/** 
+	 * Use the catalog rows prefetched by loadSchema if they're available
+	 */
 	PHALCON_INIT_VAR(describe);
-	PHALCON_CALL_METHOD_PARAMS_2(describe, this_ptr, "fetchall", sql, fetch_num);
+	if (phalcon_db_adapter_schema_rows(&prefetched, this_ptr, "columns", table, schema TSRMLS_CC)) {
+		ZVAL_ZVAL(describe, prefetched, 1, 0);
+	} else {
+		PHALCON_CALL_METHOD_PARAMS_2(describe, this_ptr, "fetchall", sql, fetch_num);
+	}
 	
 	/** 
 	 * 0:name, 1:type, 2:size, 3:numericsize, 4: null, 5: key, 6: extra, 7: position
@@ -314,6 +329,7 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Postgresql, describeColumns){
 		zend_hash_move_forward_ex(ah0, &hp0);
 	}
 	
+	phalcon_db_adapter_schema_cache_store(this_ptr, "columns", table, schema, columns TSRMLS_CC);
 	
 	RETURN_CTOR(columns);
 }
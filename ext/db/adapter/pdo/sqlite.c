@@ -127,6 +127,7 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Sqlite, connect){
 PHP_METHOD(Phalcon_Db_Adapter_Pdo_Sqlite, describeColumns){
 
 	zval *table, *schema = NULL, *columns, *dialect, *size_pattern;
+	zval *cached;
 	zval *sql, *fetch_num, *describe, *old_column = NULL, *field = NULL;
 	zval *definition = NULL, *column_type = NULL, *pos = NULL, *attribute = NULL;
 	zval *matches = NULL, *match_one = NULL, *column_name = NULL, *column = NULL;
@@ -144,6 +145,13 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Sqlite, describeColumns){
 		PHALCON_INIT_VAR(schema);
 	}
 	
+	/** 
+	 * Check the schema cache of the connection
+	 */
+	if (phalcon_db_adapter_schema_cache_fetch(&cached, this_ptr, "columns", table, schema TSRMLS_CC)) {
+		RETURN_CTOR(cached);
+	}
+	
 	PHALCON_INIT_VAR(columns);
 	array_init(columns);
 	
@@ -299,6 +307,7 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Sqlite, describeColumns){
 		zend_hash_move_forward_ex(ah0, &hp0);
 	}
 	
+	phalcon_db_adapter_schema_cache_store(this_ptr, "columns", table, schema, columns TSRMLS_CC);
 	
 	RETURN_CTOR(columns);
 }
@@ -313,6 +322,7 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Sqlite, describeColumns){
 PHP_METHOD(Phalcon_Db_Adapter_Pdo_Sqlite, describeIndexes){
 
 	zval *table, *schema = NULL, *dialect, *fetch_num, *sql, *describe;
+	zval *cached;
 	zval *indexes, *index = NULL, *key_name = NULL, *empty_arr = NULL, *sql_index_describe = NULL;
 	zval *describe_index = NULL, *index_column = NULL, *column_name = NULL;
 	zval *index_objects, *index_columns = NULL, *name = NULL;
@@ -330,6 +340,13 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Sqlite, describeIndexes){
 		PHALCON_INIT_VAR(schema);
 	}
 	
+	/** 
+	 * Check the schema cache of the connection
+	 */
+	if (phalcon_db_adapter_schema_cache_fetch(&cached, this_ptr, "indexes", table, schema TSRMLS_CC)) {
+		RETURN_CTOR(cached);
+	}
+	
 	PHALCON_OBS_VAR(dialect);
 	phalcon_read_property(&dialect, this_ptr, SL("_dialect"), PH_NOISY_CC);
 	
@@ -413,6 +430,7 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Sqlite, describeIndexes){
 		zend_hash_move_forward_ex(ah2, &hp2);
 	}
 	
+	phalcon_db_adapter_schema_cache_store(this_ptr, "indexes", table, schema, index_objects TSRMLS_CC);
 	
 	RETURN_CTOR(index_objects);
 }
@@ -427,6 +445,7 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Sqlite, describeIndexes){
 PHP_METHOD(Phalcon_Db_Adapter_Pdo_Sqlite, describeReferences){
 
 	zval *table, *schema = NULL, *dialect, *sql, *fetch_num, *describe;
+	zval *cached;
 	zval *reference_objects, *reference_describe = NULL;
 	zval *number = NULL, *constraint_name = NULL, *referenced_table = NULL;
 	zval *from = NULL, *to = NULL, *columns = NULL, *referenced_columns = NULL;
@@ -445,6 +464,13 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Sqlite, describeReferences){
 		PHALCON_INIT_VAR(schema);
 	}
 	
+	/** 
+	 * Check the schema cache of the connection
+	 */
+	if (phalcon_db_adapter_schema_cache_fetch(&cached, this_ptr, "references", table, schema TSRMLS_CC)) {
+		RETURN_CTOR(cached);
+	}
+	
 	PHALCON_OBS_VAR(dialect);
 	phalcon_read_property(&dialect, this_ptr, SL("_dialect"), PH_NOISY_CC);
 	
@@ -520,6 +546,7 @@ PHP_METHOD(Phalcon_Db_Adapter_Pdo_Sqlite, describeReferences){
 		zend_hash_move_forward_ex(ah0, &hp0);
 	}
 	
+	phalcon_db_adapter_schema_cache_store(this_ptr, "references", table, schema, reference_objects TSRMLS_CC);
 	
 	RETURN_CTOR(reference_objects);
 }
@@ -22,6 +22,7 @@
 #define PDO_ATTR_CASE 8
 #define PDO_ATTR_CURSOR 10
 #define PDO_ATTR_PERSISTENT 12
+#define PDO_MYSQL_ATTR_USE_BUFFERED_QUERY 1000
 
 #define PDO_CASE_LOWER 2
 #define PDO_CURSOR_SCROLL 1
@@ -1082,6 +1082,99 @@ PHP_METHOD(Phalcon_Db_Dialect_Mysql, describeReferences){
 	RETURN_CTOR(sql);
 }
 
+/**
+ * Generates SQL to describe the columns of every table in a schema, the rows have the layout of describeColumns followed by the table name
+ *
+ * @param string $schema
+ * @return string
+ */
+PHP_METHOD(Phalcon_Db_Dialect_Mysql, describeSchemaColumns){
+
+	zval *schema = NULL, *sql = NULL;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|z", &schema) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!schema) {
+		PHALCON_INIT_VAR(schema);
+	}
+	
+	if (zend_is_true(schema)) {
+		PHALCON_INIT_VAR(sql);
+		PHALCON_CONCAT_SVS(sql, "SELECT COLUMN_NAME, COLUMN_TYPE, IS_NULLABLE, COLUMN_KEY, COLUMN_DEFAULT, EXTRA, TABLE_NAME FROM INFORMATION_SCHEMA.COLUMNS WHERE TABLE_SCHEMA = \"", schema, "\" ORDER BY TABLE_NAME, ORDINAL_POSITION");
+	} else {
+		PHALCON_INIT_NVAR(sql);
+		ZVAL_STRING(sql, "SELECT COLUMN_NAME, COLUMN_TYPE, IS_NULLABLE, COLUMN_KEY, COLUMN_DEFAULT, EXTRA, TABLE_NAME FROM INFORMATION_SCHEMA.COLUMNS WHERE TABLE_SCHEMA = DATABASE() ORDER BY TABLE_NAME, ORDINAL_POSITION", 1);
+	}
+	
+	RETURN_CTOR(sql);
+}
+
+/**
+ * Generates SQL to query the indexes of every table in a schema, the rows have the layout of describeIndexes followed by the table name
+ *
+ * @param string $schema
+ * @return string
+ */
+PHP_METHOD(Phalcon_Db_Dialect_Mysql, describeSchemaIndexes){
+
+	zval *schema = NULL, *sql = NULL;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|z", &schema) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!schema) {
+		PHALCON_INIT_VAR(schema);
+	}
+	
+	if (zend_is_true(schema)) {
+		PHALCON_INIT_VAR(sql);
+		PHALCON_CONCAT_SVS(sql, "SELECT TABLE_NAME, NON_UNIQUE, INDEX_NAME, SEQ_IN_INDEX, COLUMN_NAME, TABLE_NAME FROM INFORMATION_SCHEMA.STATISTICS WHERE TABLE_SCHEMA = \"", schema, "\" ORDER BY TABLE_NAME, INDEX_NAME, SEQ_IN_INDEX");
+	} else {
+		PHALCON_INIT_NVAR(sql);
+		ZVAL_STRING(sql, "SELECT TABLE_NAME, NON_UNIQUE, INDEX_NAME, SEQ_IN_INDEX, COLUMN_NAME, TABLE_NAME FROM INFORMATION_SCHEMA.STATISTICS WHERE TABLE_SCHEMA = DATABASE() ORDER BY TABLE_NAME, INDEX_NAME, SEQ_IN_INDEX", 1);
+	}
+	
+	RETURN_CTOR(sql);
+}
+
+/**
+ * Generates SQL to query the foreign keys of every table in a schema, the rows have the layout of describeReferences followed by the table name
+ *
+ * @param string $schema
+ * @return string
+ */
+PHP_METHOD(Phalcon_Db_Dialect_Mysql, describeSchemaReferences){
+
+	zval *schema = NULL, *sql = NULL;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|z", &schema) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!schema) {
+		PHALCON_INIT_VAR(schema);
+	}
+	
+	if (zend_is_true(schema)) {
+		PHALCON_INIT_VAR(sql);
+		PHALCON_CONCAT_SVS(sql, "SELECT TABLE_NAME,COLUMN_NAME,CONSTRAINT_NAME,REFERENCED_TABLE_SCHEMA,REFERENCED_TABLE_NAME,REFERENCED_COLUMN_NAME,TABLE_NAME FROM INFORMATION_SCHEMA.KEY_COLUMN_USAGE WHERE REFERENCED_TABLE_NAME IS NOT NULL AND CONSTRAINT_SCHEMA = \"", schema, "\"");
+	} else {
+		PHALCON_INIT_NVAR(sql);
+		ZVAL_STRING(sql, "SELECT TABLE_NAME,COLUMN_NAME,CONSTRAINT_NAME,REFERENCED_TABLE_SCHEMA,REFERENCED_TABLE_NAME,REFERENCED_COLUMN_NAME,TABLE_NAME FROM INFORMATION_SCHEMA.KEY_COLUMN_USAGE WHERE REFERENCED_TABLE_NAME IS NOT NULL AND CONSTRAINT_SCHEMA = DATABASE()", 1);
+	}
+	
+	RETURN_CTOR(sql);
+}
+
 /**
  * Generates the SQL to describe the table creation options
  *
@@ -40,6 +40,9 @@ PHP_METHOD(Phalcon_Db_Dialect_Postgresql, describeColumns);
 PHP_METHOD(Phalcon_Db_Dialect_Postgresql, listTables);
 PHP_METHOD(Phalcon_Db_Dialect_Postgresql, describeIndexes);
 PHP_METHOD(Phalcon_Db_Dialect_Postgresql, describeReferences);
+PHP_METHOD(Phalcon_Db_Dialect_Postgresql, describeSchemaColumns);
+PHP_METHOD(Phalcon_Db_Dialect_Postgresql, describeSchemaIndexes);
+PHP_METHOD(Phalcon_Db_Dialect_Postgresql, describeSchemaReferences);
 PHP_METHOD(Phalcon_Db_Dialect_Postgresql, tableOptions);
 
 ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_db_dialect_postgresql_getcolumndefinition, 0, 0, 1)
@@ -135,6 +138,18 @@ ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_db_dialect_postgresql_describereferences,
 	ZEND_ARG_INFO(0, schema)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_db_dialect_postgresql_describeschemacolumns, 0, 0, 0)
+	ZEND_ARG_INFO(0, schema)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_db_dialect_postgresql_describeschemaindexes, 0, 0, 0)
+	ZEND_ARG_INFO(0, schema)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_db_dialect_postgresql_describeschemareferences, 0, 0, 0)
+	ZEND_ARG_INFO(0, schema)
+ZEND_END_ARG_INFO()
+
 ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_db_dialect_postgresql_tableoptions, 0, 0, 1)
 	ZEND_ARG_INFO(0, table)
 	ZEND_ARG_INFO(0, schema)
@@ -159,6 +174,9 @@ PHALCON_INIT_FUNCS(phalcon_db_dialect_postgresql_method_entry){
 	PHP_ME(Phalcon_Db_Dialect_Postgresql, listTables, arginfo_phalcon_db_dialect_postgresql_listtables, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Db_Dialect_Postgresql, describeIndexes, arginfo_phalcon_db_dialect_postgresql_describeindexes, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Db_Dialect_Postgresql, describeReferences, arginfo_phalcon_db_dialect_postgresql_describereferences, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Db_Dialect_Postgresql, describeSchemaColumns, arginfo_phalcon_db_dialect_postgresql_describeschemacolumns, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Db_Dialect_Postgresql, describeSchemaIndexes, arginfo_phalcon_db_dialect_postgresql_describeschemaindexes, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Db_Dialect_Postgresql, describeSchemaReferences, arginfo_phalcon_db_dialect_postgresql_describeschemareferences, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Db_Dialect_Postgresql, tableOptions, arginfo_phalcon_db_dialect_postgresql_tableoptions, ZEND_ACC_PUBLIC) 
 	PHP_FE_END
 };
@@ -35,6 +35,19 @@
 #include "kernel/object.h"
 #include "kernel/fcall.h"
 #include "kernel/operators.h"
+#include "kernel/array.h"
+#include "kernel/exception.h"
+
+#include "ext/standard/php_smart_str.h"
+
+#include <math.h>
+#include <ctype.h>
+
+#ifdef PHP_WIN32
+#include "win32/time.h"
+#else
+#include <sys/time.h>
+#endif
 
 /**
  * Phalcon\Db\Profiler
@@ -68,9 +81,345 @@
  *
  *</code>
  *
+ * The profiler can also run in a low-overhead mode that keeps the last profiles in a
+ * fixed-size ring buffer and aggregates the statistics per SQL fingerprint
+ *
+ *<code>
+ *
+ *	$profiler = new Phalcon\Db\Profiler();
+ *	$profiler->setRingBuffer(256, 512);
+ *
+ *	//...
+ *
+ *	print_r($profiler->export());
+ *
+ *</code>
  */
 
 
+#define PHALCON_DB_PROFILER_BUCKETS 32
+
+/**
+ * Returns the current time in seconds from a monotonic clock if available
+ */
+static double phalcon_db_profiler_time(void){
+
+#ifdef PHP_WIN32
+	LARGE_INTEGER frequency, counter;
+
+	if (QueryPerformanceFrequency(&frequency) && QueryPerformanceCounter(&counter)) {
+		return (double) counter.QuadPart / (double) frequency.QuadPart;
+	}
+#else
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC)
+	struct timespec ts;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+		return (double) ts.tv_sec + (double) ts.tv_nsec / 1000000000.0;
+	}
+#endif
+#endif
+
+	{
+		struct timeval tv;
+		gettimeofday(&tv, NULL);
+		return (double) tv.tv_sec + (double) tv.tv_usec / 1000000.0;
+	}
+}
+
+/**
+ * Produces the fingerprint of a SQL statement: literals are replaced by ?, lists of
+ * literals are collapsed into a single ? and whitespace is normalized
+ */
+static void phalcon_db_profiler_fingerprint(zval *return_value, zval *sql){
+
+	unsigned int i, j, length, last_placeholder = 0, only_separators;
+	char *str, ch, prev = ' ';
+	smart_str fingerprint = {0};
+
+	if (Z_TYPE_P(sql) != IS_STRING) {
+		ZVAL_EMPTY_STRING(return_value);
+		return;
+	}
+
+	str = Z_STRVAL_P(sql);
+	length = Z_STRLEN_P(sql);
+
+	for (i = 0; i < length; i++) {
+
+		ch = str[i];
+
+		/**
+		 * Whitespace is collapsed into a single space
+		 */
+		if (ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r') {
+			if (fingerprint.len && prev != ' ') {
+				smart_str_appendc(&fingerprint, ' ');
+				prev = ' ';
+			}
+			continue;
+		}
+
+		/**
+		 * Double quotes and backticks delimit identifiers and are kept
+		 */
+		if (ch == '"' || ch == '`') {
+			for (j = i + 1; j < length; j++) {
+				if (str[j] == ch) {
+					break;
+				}
+			}
+			if (j >= length) {
+				j = length - 1;
+			}
+			smart_str_appendl(&fingerprint, str + i, j - i + 1);
+			prev = ch;
+			i = j;
+			continue;
+		}
+
+		/**
+		 * String and numeric literals are replaced by placeholders
+		 */
+		if (ch == '\'' || (ch >= '0' && ch <= '9' && !isalnum((unsigned char) prev) && prev != '_' && prev != '$' && prev != '.')) {
+
+			if (ch == '\'') {
+				for (j = i + 1; j < length; j++) {
+					if (str[j] == '\\') {
+						j++;
+						continue;
+					}
+					if (str[j] == '\'') {
+						if (j + 1 < length && str[j + 1] == '\'') {
+							j++;
+							continue;
+						}
+						break;
+					}
+				}
+			} else {
+				for (j = i + 1; j < length; j++) {
+					if (!((str[j] >= '0' && str[j] <= '9') || str[j] == '.')) {
+						break;
+					}
+				}
+				j--;
+			}
+			i = j;
+			ch = '?';
+		}
+
+		if (ch == '?') {
+
+			/**
+			 * Lists of placeholders are collapsed into the first one
+			 */
+			if (last_placeholder) {
+				only_separators = 1;
+				for (j = last_placeholder; j < fingerprint.len; j++) {
+					if (fingerprint.c[j] != ',' && fingerprint.c[j] != ' ') {
+						only_separators = 0;
+						break;
+					}
+				}
+				if (only_separators) {
+					fingerprint.len = last_placeholder;
+					prev = '?';
+					continue;
+				}
+			}
+
+			smart_str_appendc(&fingerprint, '?');
+			last_placeholder = fingerprint.len;
+			prev = '?';
+			continue;
+		}
+
+		smart_str_appendc(&fingerprint, ch);
+		prev = ch;
+	}
+
+	if (fingerprint.len && prev == ' ') {
+		fingerprint.len--;
+	}
+
+	smart_str_0(&fingerprint);
+
+	if (fingerprint.len) {
+		RETURN_STRINGL(fingerprint.c, fingerprint.len, 0);
+	} else {
+		smart_str_free(&fingerprint);
+		RETURN_EMPTY_STRING();
+	}
+}
+
+/**
+ * Adds 'value' to a number stored in an aggregate, separating it first if it is shared
+ */
+static void phalcon_db_profiler_increment(HashTable *aggregate, char *key, uint key_length, long lvalue, double dvalue){
+
+	zval **slot;
+
+	if (zend_hash_find(aggregate, key, key_length, (void**) &slot) == SUCCESS) {
+		SEPARATE_ZVAL(slot);
+		if (Z_TYPE_PP(slot) == IS_DOUBLE) {
+			Z_DVAL_PP(slot) += dvalue;
+		} else {
+			convert_to_long(*slot);
+			Z_LVAL_PP(slot) += lvalue;
+		}
+	}
+}
+
+/**
+ * Adds a measure to the aggregate of a fingerprint in '_fingerprints'. Existing aggregates
+ * are updated in place. The last slot is reserved to the '(other)' entry, which merges
+ * every new fingerprint once the limit is reached
+ */
+static void phalcon_db_profiler_aggregate(zval *object, zval *fingerprint, double elapsed, long rows TSRMLS_DC){
+
+	zval *fingerprints, *max_fingerprints, *aggregate, *histogram, *copy;
+	zval **aggregate_pp, **slot;
+	long bucket = 0, i;
+	double microseconds;
+	char *key;
+	uint key_length;
+
+	/**
+	 * Bucket i counts the latencies between 2^i and 2^(i+1) microseconds
+	 */
+	microseconds = elapsed * 1000000.0;
+	while (microseconds >= 2.0 && bucket < PHALCON_DB_PROFILER_BUCKETS - 1) {
+		microseconds /= 2.0;
+		bucket++;
+	}
+
+	/**
+	 * The aggregates are modified in place, so a table shared with other variables is copied first
+	 */
+	fingerprints = zend_read_property(phalcon_db_profiler_ce, object, SL("_fingerprints"), 1 TSRMLS_CC);
+	if (Z_TYPE_P(fingerprints) != IS_ARRAY || Z_REFCOUNT_P(fingerprints) > 1) {
+		MAKE_STD_ZVAL(copy);
+		if (Z_TYPE_P(fingerprints) == IS_ARRAY) {
+			ZVAL_ZVAL(copy, fingerprints, 1, 0);
+		} else {
+			array_init(copy);
+		}
+		zend_update_property(phalcon_db_profiler_ce, object, SL("_fingerprints"), copy TSRMLS_CC);
+		zval_ptr_dtor(&copy);
+		fingerprints = zend_read_property(phalcon_db_profiler_ce, object, SL("_fingerprints"), 1 TSRMLS_CC);
+	}
+
+	key = Z_STRVAL_P(fingerprint);
+	key_length = Z_STRLEN_P(fingerprint) + 1;
+	if (zend_hash_find(Z_ARRVAL_P(fingerprints), key, key_length, (void**) &aggregate_pp) != SUCCESS) {
+		max_fingerprints = zend_read_property(phalcon_db_profiler_ce, object, SL("_maxFingerprints"), 1 TSRMLS_CC);
+		if ((long) zend_hash_num_elements(Z_ARRVAL_P(fingerprints)) >= phalcon_get_intval(max_fingerprints) - 1) {
+			key = "(other)";
+			key_length = sizeof("(other)");
+			if (zend_hash_find(Z_ARRVAL_P(fingerprints), key, key_length, (void**) &aggregate_pp) != SUCCESS) {
+				aggregate_pp = NULL;
+			}
+		} else {
+			aggregate_pp = NULL;
+		}
+	}
+
+	if (aggregate_pp) {
+		SEPARATE_ZVAL(aggregate_pp);
+		aggregate = *aggregate_pp;
+
+		phalcon_db_profiler_increment(Z_ARRVAL_P(aggregate), SS("count"), 1, 1);
+		phalcon_db_profiler_increment(Z_ARRVAL_P(aggregate), SS("totalSeconds"), 0, elapsed);
+		phalcon_db_profiler_increment(Z_ARRVAL_P(aggregate), SS("rows"), rows, rows);
+
+		if (zend_hash_find(Z_ARRVAL_P(aggregate), SS("minSeconds"), (void**) &slot) == SUCCESS) {
+			if (elapsed < Z_DVAL_PP(slot)) {
+				SEPARATE_ZVAL(slot);
+				ZVAL_DOUBLE(*slot, elapsed);
+			}
+		}
+		if (zend_hash_find(Z_ARRVAL_P(aggregate), SS("maxSeconds"), (void**) &slot) == SUCCESS) {
+			if (elapsed > Z_DVAL_PP(slot)) {
+				SEPARATE_ZVAL(slot);
+				ZVAL_DOUBLE(*slot, elapsed);
+			}
+		}
+
+		if (zend_hash_find(Z_ARRVAL_P(aggregate), SS("histogram"), (void**) &slot) == SUCCESS) {
+			SEPARATE_ZVAL(slot);
+			if (zend_hash_index_find(Z_ARRVAL_PP(slot), bucket, (void**) &slot) == SUCCESS) {
+				SEPARATE_ZVAL(slot);
+				Z_LVAL_PP(slot)++;
+			}
+		}
+		return;
+	}
+
+	MAKE_STD_ZVAL(histogram);
+	array_init_size(histogram, PHALCON_DB_PROFILER_BUCKETS);
+	for (i = 0; i < PHALCON_DB_PROFILER_BUCKETS; i++) {
+		add_next_index_long(histogram, i == bucket ? 1 : 0);
+	}
+
+	MAKE_STD_ZVAL(aggregate);
+	array_init_size(aggregate, 6);
+	add_assoc_long_ex(aggregate, SS("count"), 1);
+	add_assoc_double_ex(aggregate, SS("totalSeconds"), elapsed);
+	add_assoc_double_ex(aggregate, SS("minSeconds"), elapsed);
+	add_assoc_double_ex(aggregate, SS("maxSeconds"), elapsed);
+	add_assoc_long_ex(aggregate, SS("rows"), rows);
+	add_assoc_zval_ex(aggregate, SS("histogram"), histogram);
+
+	zend_hash_update(Z_ARRVAL_P(fingerprints), key, key_length, (void*) &aggregate, sizeof(zval*), NULL);
+}
+
+/**
+ * Estimates the 95th percentile of an aggregate from its histogram
+ */
+static double phalcon_db_profiler_p95(zval *aggregate){
+
+	long count = 0, rank, cumulative = 0, bucket;
+	double p95, min = 0, max = 0;
+	zval **value, **histogram;
+
+	if (zend_hash_find(Z_ARRVAL_P(aggregate), SS("count"), (void**) &value) == SUCCESS) {
+		count = Z_LVAL_PP(value);
+	}
+	if (zend_hash_find(Z_ARRVAL_P(aggregate), SS("minSeconds"), (void**) &value) == SUCCESS) {
+		min = Z_DVAL_PP(value);
+	}
+	if (zend_hash_find(Z_ARRVAL_P(aggregate), SS("maxSeconds"), (void**) &value) == SUCCESS) {
+		max = Z_DVAL_PP(value);
+	}
+
+	if (count <= 0 || zend_hash_find(Z_ARRVAL_P(aggregate), SS("histogram"), (void**) &histogram) != SUCCESS) {
+		return max;
+	}
+
+	rank = (long) ceil(count * 0.95);
+	p95 = max;
+	for (bucket = 0; bucket < PHALCON_DB_PROFILER_BUCKETS; bucket++) {
+		if (zend_hash_index_find(Z_ARRVAL_PP(histogram), bucket, (void**) &value) == SUCCESS) {
+			cumulative += Z_LVAL_PP(value);
+		}
+		if (cumulative >= rank) {
+			p95 = ldexp(1.0, bucket + 1) / 1000000.0;
+			break;
+		}
+	}
+
+	if (p95 > max) {
+		p95 = max;
+	}
+	if (p95 < min) {
+		p95 = min;
+	}
+
+	return p95;
+}
+
+
 /**
  * Phalcon\Db\Profiler initializer
  */
@@ -81,6 +430,13 @@ PHALCON_INIT_CLASS(Phalcon_Db_Profiler){
 	zend_declare_property_null(phalcon_db_profiler_ce, SL("_allProfiles"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_db_profiler_ce, SL("_activeProfile"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_long(phalcon_db_profiler_ce, SL("_totalSeconds"), 0, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_db_profiler_ce, SL("_ringSize"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_db_profiler_ce, SL("_ring"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_long(phalcon_db_profiler_ce, SL("_ringPosition"), 0, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_db_profiler_ce, SL("_fingerprints"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_long(phalcon_db_profiler_ce, SL("_maxFingerprints"), 512, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_db_profiler_ce, SL("_activeStatement"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_db_profiler_ce, SL("_activeStart"), ZEND_ACC_PROTECTED TSRMLS_CC);
 
 	return SUCCESS;
 }
@@ -103,7 +459,7 @@ PHP_METHOD(Phalcon_Db_Profiler, __construct){
  */
 PHP_METHOD(Phalcon_Db_Profiler, startProfile){
 
-	zval *sql_statement, *active_profile, *micro;
+	zval *sql_statement, *ring_size, *start, *active_profile, *micro;
 	zval *time;
 
 	PHALCON_MM_GROW();
@@ -112,6 +468,20 @@ PHP_METHOD(Phalcon_Db_Profiler, startProfile){
 		RETURN_MM_NULL();
 	}
 
+	/** 
+	 * In ring buffer mode only the statement and a monotonic timestamp are kept
+	 */
+	PHALCON_OBS_VAR(ring_size);
+	phalcon_read_property(&ring_size, this_ptr, SL("_ringSize"), PH_NOISY_CC);
+	if (Z_TYPE_P(ring_size) != IS_NULL) {
+		phalcon_update_property_zval(this_ptr, SL("_activeStatement"), sql_statement TSRMLS_CC);
+	
+		PHALCON_INIT_VAR(start);
+		ZVAL_DOUBLE(start, phalcon_db_profiler_time());
+		phalcon_update_property_zval(this_ptr, SL("_activeStart"), start TSRMLS_CC);
+		RETURN_THIS();
+	}
+	
 	PHALCON_INIT_VAR(active_profile);
 	object_init_ex(active_profile, phalcon_db_profiler_item_ce);
 	PHALCON_CALL_METHOD_PARAMS_1_NORETURN(active_profile, "setsqlstatement", sql_statement);
@@ -134,15 +504,87 @@ PHP_METHOD(Phalcon_Db_Profiler, startProfile){
 /**
  * Stops the active profile
  *
+ * @param int $rows
  * @return Phalcon\Db\Profiler
  */
 PHP_METHOD(Phalcon_Db_Profiler, stopProfile){
 
-	zval *micro, *final_time, *active_profile, *initial_time;
+	zval *rows = NULL, *ring_size, *micro, *final_time, *active_profile, *initial_time;
 	zval *diference, *total_seconds, *new_total_seconds;
+	zval *sql_statement, *start, *elapsed, *fingerprint, *position, *index;
+	zval *profile;
+	double elapsed_seconds;
+	long number_rows = 0;
 
 	PHALCON_MM_GROW();
 
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|z", &rows) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!rows) {
+		PHALCON_INIT_VAR(rows);
+	}
+	
+	PHALCON_OBS_VAR(ring_size);
+	phalcon_read_property(&ring_size, this_ptr, SL("_ringSize"), PH_NOISY_CC);
+	if (Z_TYPE_P(ring_size) != IS_NULL) {
+	
+		PHALCON_OBS_VAR(start);
+		phalcon_read_property(&start, this_ptr, SL("_activeStart"), PH_NOISY_CC);
+		if (Z_TYPE_P(start) != IS_DOUBLE) {
+			RETURN_THIS();
+		}
+	
+		elapsed_seconds = phalcon_db_profiler_time() - Z_DVAL_P(start);
+		if (Z_TYPE_P(rows) != IS_NULL) {
+			number_rows = phalcon_get_intval(rows);
+		}
+	
+		PHALCON_INIT_VAR(elapsed);
+		ZVAL_DOUBLE(elapsed, elapsed_seconds);
+	
+		PHALCON_OBS_VAR(total_seconds);
+		phalcon_read_property(&total_seconds, this_ptr, SL("_totalSeconds"), PH_NOISY_CC);
+	
+		PHALCON_INIT_VAR(new_total_seconds);
+		phalcon_add_function(new_total_seconds, total_seconds, elapsed TSRMLS_CC);
+		phalcon_update_property_zval(this_ptr, SL("_totalSeconds"), new_total_seconds TSRMLS_CC);
+	
+		PHALCON_OBS_VAR(sql_statement);
+		phalcon_read_property(&sql_statement, this_ptr, SL("_activeStatement"), PH_NOISY_CC);
+	
+		PHALCON_INIT_VAR(fingerprint);
+		phalcon_db_profiler_fingerprint(fingerprint, sql_statement);
+	
+		/** 
+		 * The profile overwrites the oldest slot in the ring
+		 */
+		PHALCON_OBS_VAR(position);
+		phalcon_read_property(&position, this_ptr, SL("_ringPosition"), PH_NOISY_CC);
+	
+		PHALCON_INIT_VAR(index);
+		ZVAL_LONG(index, phalcon_get_intval(position) % phalcon_get_intval(ring_size));
+	
+		PHALCON_INIT_VAR(profile);
+		array_init_size(profile, 5);
+		phalcon_array_update_string(&profile, SL("sql"), &sql_statement, PH_COPY | PH_SEPARATE TSRMLS_CC);
+		phalcon_array_update_string(&profile, SL("fingerprint"), &fingerprint, PH_COPY | PH_SEPARATE TSRMLS_CC);
+		phalcon_array_update_string(&profile, SL("initialTime"), &start, PH_COPY | PH_SEPARATE TSRMLS_CC);
+		phalcon_array_update_string(&profile, SL("elapsedSeconds"), &elapsed, PH_COPY | PH_SEPARATE TSRMLS_CC);
+		phalcon_array_update_string(&profile, SL("rows"), &rows, PH_COPY | PH_SEPARATE TSRMLS_CC);
+		phalcon_update_property_array(this_ptr, SL("_ring"), index, profile TSRMLS_CC);
+		phalcon_property_incr(this_ptr, SL("_ringPosition") TSRMLS_CC);
+	
+		/** 
+		 * New fingerprints are merged into a single entry once the limit is reached
+		 */
+		phalcon_db_profiler_aggregate(this_ptr, fingerprint, elapsed_seconds, number_rows TSRMLS_CC);
+	
+		phalcon_update_property_null(this_ptr, SL("_activeStart") TSRMLS_CC);
+		RETURN_THIS();
+	}
+	
 	PHALCON_INIT_VAR(micro);
 	ZVAL_BOOL(micro, 1);
 	
@@ -181,10 +623,18 @@ PHP_METHOD(Phalcon_Db_Profiler, stopProfile){
  */
 PHP_METHOD(Phalcon_Db_Profiler, getNumberTotalStatements){
 
-	zval *all_profiles, *number_profiles;
+	zval *ring_size, *position, *all_profiles, *number_profiles;
 
 	PHALCON_MM_GROW();
 
+	PHALCON_OBS_VAR(ring_size);
+	phalcon_read_property(&ring_size, this_ptr, SL("_ringSize"), PH_NOISY_CC);
+	if (Z_TYPE_P(ring_size) != IS_NULL) {
+		PHALCON_OBS_VAR(position);
+		phalcon_read_property(&position, this_ptr, SL("_ringPosition"), PH_NOISY_CC);
+		RETURN_CCTOR(position);
+	}
+	
 	PHALCON_OBS_VAR(all_profiles);
 	phalcon_read_property(&all_profiles, this_ptr, SL("_allProfiles"), PH_NOISY_CC);
 	
@@ -229,6 +679,9 @@ PHP_METHOD(Phalcon_Db_Profiler, reset){
 	PHALCON_INIT_VAR(empty_arr);
 	array_init(empty_arr);
 	phalcon_update_property_zval(this_ptr, SL("_allProfiles"), empty_arr TSRMLS_CC);
+	phalcon_update_property_null(this_ptr, SL("_ring") TSRMLS_CC);
+	phalcon_update_property_long(this_ptr, SL("_ringPosition"), 0 TSRMLS_CC);
+	phalcon_update_property_null(this_ptr, SL("_fingerprints") TSRMLS_CC);
 	RETURN_THIS();
 }
 
@@ -243,3 +696,148 @@ PHP_METHOD(Phalcon_Db_Profiler, getLastProfile){
 	RETURN_MEMBER(this_ptr, "_activeProfile");
 }
 
+/**
+ * Enables the low-overhead mode: the last profiles are kept in a ring buffer of a fixed size
+ * and the statistics are aggregated per SQL fingerprint. Profiler\Item objects and the
+ * beforeStartProfile/afterEndProfile hooks are not used in this mode. At most $maxFingerprints
+ * entries are kept, including the '(other)' entry that merges the fingerprints beyond the limit
+ *
+ * @param int $size
+ * @param int $maxFingerprints
+ * @return Phalcon\Db\Profiler
+ */
+PHP_METHOD(Phalcon_Db_Profiler, setRingBuffer){
+
+	zval *size, *max_fingerprints = NULL;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &size, &max_fingerprints) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (phalcon_get_intval(size) <= 0) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_db_exception_ce, "The size of the ring buffer must be greater than zero");
+		return;
+	}
+	
+	phalcon_update_property_long(this_ptr, SL("_ringSize"), phalcon_get_intval(size) TSRMLS_CC);
+	if (max_fingerprints && Z_TYPE_P(max_fingerprints) != IS_NULL) {
+		phalcon_update_property_long(this_ptr, SL("_maxFingerprints"), phalcon_get_intval(max_fingerprints) TSRMLS_CC);
+	}
+	
+	phalcon_update_property_null(this_ptr, SL("_ring") TSRMLS_CC);
+	phalcon_update_property_long(this_ptr, SL("_ringPosition"), 0 TSRMLS_CC);
+	phalcon_update_property_null(this_ptr, SL("_fingerprints") TSRMLS_CC);
+	
+	RETURN_THIS();
+}
+
+/**
+ * Exports the profiles kept in the ring buffer, oldest first, and the statistics
+ * aggregated per SQL fingerprint (count, total/min/max/p95 latency and rows)
+ *
+ *<code>
+ * $stats = $profiler->export();
+ * foreach ($stats['fingerprints'] as $fingerprint => $aggregate) {
+ *     echo $fingerprint, ' ', $aggregate['count'], ' ', $aggregate['p95Seconds'], PHP_EOL;
+ * }
+ *</code>
+ *
+ * @return array
+ */
+PHP_METHOD(Phalcon_Db_Profiler, export){
+
+	zval *ring_size, *ring, *position, *total_seconds, *fingerprints;
+	zval *profiles, *statistics, *export;
+	zval **profile, **aggregate, **value;
+	long size, number, first, i;
+	HashTable *ah0;
+	HashPosition hp0;
+	char *key;
+	uint key_length;
+	ulong num_key;
+
+	PHALCON_MM_GROW();
+
+	PHALCON_OBS_VAR(ring_size);
+	phalcon_read_property(&ring_size, this_ptr, SL("_ringSize"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(ring);
+	phalcon_read_property(&ring, this_ptr, SL("_ring"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(position);
+	phalcon_read_property(&position, this_ptr, SL("_ringPosition"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(total_seconds);
+	phalcon_read_property(&total_seconds, this_ptr, SL("_totalSeconds"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(fingerprints);
+	phalcon_read_property(&fingerprints, this_ptr, SL("_fingerprints"), PH_NOISY_CC);
+	
+	/** 
+	 * Profiles in the ring from the oldest to the newest
+	 */
+	PHALCON_INIT_VAR(profiles);
+	array_init(profiles);
+	if (Z_TYPE_P(ring) == IS_ARRAY) { 
+		size = phalcon_get_intval(ring_size);
+		number = phalcon_get_intval(position);
+		first = number > size ? number % size : 0;
+		if (number > size) {
+			number = size;
+		}
+		for (i = 0; i < number; i++) {
+			if (zend_hash_index_find(Z_ARRVAL_P(ring), (first + i) % size, (void**) &profile) == SUCCESS) {
+				Z_ADDREF_PP(profile);
+				add_next_index_zval(profiles, *profile);
+			}
+		}
+	}
+	
+	/** 
+	 * Aggregates per fingerprint with the 95th percentile estimated from the histogram
+	 */
+	PHALCON_INIT_VAR(statistics);
+	array_init(statistics);
+	if (Z_TYPE_P(fingerprints) == IS_ARRAY) { 
+		ah0 = Z_ARRVAL_P(fingerprints);
+		for (zend_hash_internal_pointer_reset_ex(ah0, &hp0); zend_hash_get_current_data_ex(ah0, (void**) &aggregate, &hp0) == SUCCESS; zend_hash_move_forward_ex(ah0, &hp0)) {
+	
+			zval *item;
+	
+			if (zend_hash_get_current_key_ex(ah0, &key, &key_length, &num_key, 0, &hp0) != HASH_KEY_IS_STRING) {
+				continue;
+			}
+	
+			MAKE_STD_ZVAL(item);
+			array_init_size(item, 6);
+			if (zend_hash_find(Z_ARRVAL_PP(aggregate), SS("count"), (void**) &value) == SUCCESS) {
+				add_assoc_long_ex(item, SS("count"), Z_LVAL_PP(value));
+			}
+			if (zend_hash_find(Z_ARRVAL_PP(aggregate), SS("totalSeconds"), (void**) &value) == SUCCESS) {
+				add_assoc_double_ex(item, SS("totalSeconds"), Z_DVAL_PP(value));
+			}
+			if (zend_hash_find(Z_ARRVAL_PP(aggregate), SS("minSeconds"), (void**) &value) == SUCCESS) {
+				add_assoc_double_ex(item, SS("minSeconds"), Z_DVAL_PP(value));
+			}
+			if (zend_hash_find(Z_ARRVAL_PP(aggregate), SS("maxSeconds"), (void**) &value) == SUCCESS) {
+				add_assoc_double_ex(item, SS("maxSeconds"), Z_DVAL_PP(value));
+			}
+			add_assoc_double_ex(item, SS("p95Seconds"), phalcon_db_profiler_p95(*aggregate));
+			if (zend_hash_find(Z_ARRVAL_PP(aggregate), SS("rows"), (void**) &value) == SUCCESS) {
+				add_assoc_long_ex(item, SS("rows"), Z_LVAL_PP(value));
+			}
+			add_assoc_zval_ex(statistics, key, key_length, item);
+		}
+	}
+	
+	PHALCON_INIT_VAR(export);
+	array_init_size(export, 4);
+	phalcon_array_update_string(&export, SL("statements"), &position, PH_COPY | PH_SEPARATE TSRMLS_CC);
+	phalcon_array_update_string(&export, SL("totalSeconds"), &total_seconds, PH_COPY | PH_SEPARATE TSRMLS_CC);
+	phalcon_array_update_string(&export, SL("profiles"), &profiles, PH_COPY | PH_SEPARATE TSRMLS_CC);
+	phalcon_array_update_string(&export, SL("fingerprints"), &statistics, PH_COPY | PH_SEPARATE TSRMLS_CC);
+	
+	RETURN_CTOR(export);
+}
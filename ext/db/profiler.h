@@ -29,20 +29,33 @@ PHP_METHOD(Phalcon_Db_Profiler, getTotalElapsedSeconds);
 PHP_METHOD(Phalcon_Db_Profiler, getProfiles);
 PHP_METHOD(Phalcon_Db_Profiler, reset);
 PHP_METHOD(Phalcon_Db_Profiler, getLastProfile);
+PHP_METHOD(Phalcon_Db_Profiler, setRingBuffer);
+PHP_METHOD(Phalcon_Db_Profiler, export);
 
 ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_db_profiler_startprofile, 0, 0, 1)
 	ZEND_ARG_INFO(0, sqlStatement)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_db_profiler_stopprofile, 0, 0, 0)
+	ZEND_ARG_INFO(0, rows)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_db_profiler_setringbuffer, 0, 0, 1)
+	ZEND_ARG_INFO(0, size)
+	ZEND_ARG_INFO(0, maxFingerprints)
+ZEND_END_ARG_INFO()
+
 PHALCON_INIT_FUNCS(phalcon_db_profiler_method_entry){
 	PHP_ME(Phalcon_Db_Profiler, __construct, NULL, ZEND_ACC_PUBLIC|ZEND_ACC_CTOR) 
 	PHP_ME(Phalcon_Db_Profiler, startProfile, arginfo_phalcon_db_profiler_startprofile, ZEND_ACC_PUBLIC) 
-	PHP_ME(Phalcon_Db_Profiler, stopProfile, NULL, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Db_Profiler, stopProfile, arginfo_phalcon_db_profiler_stopprofile, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Db_Profiler, getNumberTotalStatements, NULL, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Db_Profiler, getTotalElapsedSeconds, NULL, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Db_Profiler, getProfiles, NULL, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Db_Profiler, reset, NULL, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Db_Profiler, getLastProfile, NULL, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Db_Profiler, setRingBuffer, arginfo_phalcon_db_profiler_setringbuffer, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Db_Profiler, export, NULL, ZEND_ACC_PUBLIC) 
 	PHP_FE_END
 };
 
@@ -228,6 +228,60 @@ PHP_METHOD(Phalcon_Db_Result_Pdo, fetchAll){
 	RETURN_CCTOR(rows);
 }
 
+/**
+ * Returns the next batch of rows in the result, up to the number of rows requested.
+ * An empty array is returned once the result is exhausted, this allows to process
+ * big (unbuffered) results keeping a bounded amount of rows in memory
+ * This method is affected by the active fetch flag set using Phalcon\Db\Result\Pdo::setFetchMode
+ *
+ *<code>
+ *	$result = $connection->query("SELECT * FROM robots ORDER BY name", null, null, true);
+ *	while ($robots = $result->fetchBatch(500)) {
+ *		foreach ($robots as $robot) {
+ *			echo $robot['name'];
+ *		}
+ *	}
+ *</code>
+ *
+ * @param int $number
+ * @return array
+ */
+PHP_METHOD(Phalcon_Db_Result_Pdo, fetchBatch){
+
+	long number = 0, n;
+	zval *pdo_statement, *rows, *row = NULL;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "l", &number) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (number < 1) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_db_exception_ce, "The number of rows in a batch must be greater than zero");
+		return;
+	}
+
+	PHALCON_OBS_VAR(pdo_statement);
+	phalcon_read_property(&pdo_statement, this_ptr, SL("_pdoStatement"), PH_NOISY_CC);
+	
+	PHALCON_INIT_VAR(rows);
+	array_init(rows);
+	
+	for (n = 0; n < number; n++) {
+	
+		PHALCON_INIT_NVAR(row);
+		PHALCON_CALL_METHOD(row, pdo_statement, "fetch");
+		if (PHALCON_IS_FALSE(row)) {
+			break;
+		}
+	
+		phalcon_array_append(&rows, row, PH_SEPARATE TSRMLS_CC);
+	}
+	
+	RETURN_CTOR(rows);
+}
+
 /**
  * Gets number of rows returned by a resulset
  *
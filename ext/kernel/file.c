@@ -53,6 +53,25 @@ int phalcon_file_exists(zval *filename TSRMLS_DC){
 	return FAILURE;
 }
 
+/**
+ * Reads the modification time of a file without raising warnings
+ */
+int phalcon_file_mtime(zval *filename, long *mtime TSRMLS_DC){
+
+	php_stream_statbuf statbuffer;
+
+	if (Z_TYPE_P(filename) != IS_STRING) {
+		return FAILURE;
+	}
+
+	if (php_stream_stat_path_ex(Z_STRVAL_P(filename), PHP_STREAM_URL_STAT_QUIET, &statbuffer, NULL)) {
+		return FAILURE;
+	}
+
+	*mtime = (long) statbuffer.sb.st_mtime;
+	return SUCCESS;
+}
+
 /**
  * Compares two file paths returning 1 if the first mtime is greater or equal than the second
  */
@@ -18,6 +18,7 @@
 */
 
 extern int phalcon_file_exists(zval *filename TSRMLS_DC);
+extern int phalcon_file_mtime(zval *filename, long *mtime TSRMLS_DC);
 extern int phalcon_compare_mtime(zval *filename1, zval *filename2 TSRMLS_DC);
 extern void phalcon_fix_path(zval **return_value, zval *path, zval *directory_separator TSRMLS_DC);
 extern void phalcon_prepare_virtual_path(zval *return_value, zval *path, zval *virtual_separator TSRMLS_DC);
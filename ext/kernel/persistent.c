@@ -23,36 +23,560 @@
 
 #include "php.h"
 #include "php_phalcon.h"
+#include "ext/standard/md5.h"
 
-/* represents a connection to a database */
-struct _phalcon_persist_obj {
-	char *data;
-} phalcon_persist_obj;
+#include "kernel/persistent.h"
+
+#include "Zend/zend_exceptions.h"
+
+/**
+ * Pools of persistent connections live in the persistent list of every worker, they are keyed
+ * by a hash of the connection descriptor. Every slot of a pool maps to an unique persistent
+ * connection so two adapters in the same request never share the same handler. Slots only keep
+ * bookkeeping, the handlers belong to the request that opened them
+ */
+typedef struct _phalcon_persistent_slot {
+	zend_bool in_use;
+	zend_bool opened;
+	long generation;
+	time_t released_at;
+} phalcon_persistent_slot;
+
+typedef struct _phalcon_persistent_pool {
+	long size;
+	long allocated;
+	long max_size;
+	long hits;
+	long misses;
+	long pings;
+	long ping_failures;
+	long rollbacks;
+	long overflows;
+	phalcon_persistent_slot *slots;
+} phalcon_persistent_pool;
+
+static int phalcon_persistent_le;
+static int phalcon_persistent_cache_le;
+
+static void phalcon_persistent_pool_dtor(zend_rsrc_list_entry *rsrc TSRMLS_DC){
+
+	phalcon_persistent_pool *pool = (phalcon_persistent_pool *) rsrc->ptr;
+
+	if (pool) {
+		pefree(pool->slots, 1);
+		pefree(pool, 1);
+		rsrc->ptr = NULL;
+	}
+}
+
+static void phalcon_persistent_cache_dtor(zend_rsrc_list_entry *rsrc TSRMLS_DC){
+
+	HashTable *cache = (HashTable *) rsrc->ptr;
+
+	if (cache) {
+		zend_hash_destroy(cache);
+		pefree(cache, 1);
+		rsrc->ptr = NULL;
+	}
+}
+
+static void phalcon_persistent_entry_dtor(void *data){
+
+	phalcon_persistent_entry *entry = (phalcon_persistent_entry *) data;
+
+	if (entry->value) {
+		pefree(entry->value, 1);
+	}
+}
+
+/**
+ * Registers the persistent list entries used by the pools and the caches
+ */
+int phalcon_persistent_init(int module_number TSRMLS_DC){
+
+	phalcon_persistent_le = zend_register_list_destructors_ex(NULL, phalcon_persistent_pool_dtor, "Phalcon persistent pool", module_number);
+	phalcon_persistent_cache_le = zend_register_list_destructors_ex(NULL, phalcon_persistent_cache_dtor, "Phalcon persistent cache", module_number);
+
+	return SUCCESS;
+}
+
+/**
+ * Computes the key of the pool used by a connection descriptor
+ */
+void phalcon_persistent_hash(char *key, zval *dsn, zval *username, zval *password){
+
+	PHP_MD5_CTX context;
+	unsigned char digest[16];
+
+	PHP_MD5Init(&context);
+	if (Z_TYPE_P(dsn) == IS_STRING) {
+		PHP_MD5Update(&context, (unsigned char *) Z_STRVAL_P(dsn), Z_STRLEN_P(dsn));
+	}
+	PHP_MD5Update(&context, (unsigned char *) "\0", 1);
+	if (Z_TYPE_P(username) == IS_STRING) {
+		PHP_MD5Update(&context, (unsigned char *) Z_STRVAL_P(username), Z_STRLEN_P(username));
+	}
+	PHP_MD5Update(&context, (unsigned char *) "\0", 1);
+	if (Z_TYPE_P(password) == IS_STRING) {
+		PHP_MD5Update(&context, (unsigned char *) Z_STRVAL_P(password), Z_STRLEN_P(password));
+	}
+	PHP_MD5Final(digest, &context);
+
+	make_digest(key, digest);
+}
+
+/**
+ * Returns the pool of a key, creating it if it doesn't exist
+ */
+static phalcon_persistent_pool *phalcon_persistent_get_pool(char *key, uint key_length, int create TSRMLS_DC){
+
+	zend_rsrc_list_entry *le, new_le;
+	phalcon_persistent_pool *pool;
+	char *list_key;
+	int list_key_length;
+
+	list_key_length = spprintf(&list_key, 0, "phalcon_pool:%s", key);
+
+	if (zend_hash_find(&EG(persistent_list), list_key, list_key_length + 1, (void **) &le) == SUCCESS) {
+		if (Z_TYPE_P(le) == phalcon_persistent_le) {
+			efree(list_key);
+			return (phalcon_persistent_pool *) le->ptr;
+		}
+	}
+
+	if (!create) {
+		efree(list_key);
+		return NULL;
+	}
+
+	pool = pecalloc(1, sizeof(phalcon_persistent_pool), 1);
+
+	Z_TYPE(new_le) = phalcon_persistent_le;
+	new_le.ptr = pool;
+	if (zend_hash_update(&EG(persistent_list), list_key, list_key_length + 1, (void *) &new_le, sizeof(zend_rsrc_list_entry), NULL) == FAILURE) {
+		pefree(pool, 1);
+		efree(list_key);
+		return NULL;
+	}
+
+	efree(list_key);
+	return pool;
+}
+
+/**
+ * Calls a method of a connection handler, exceptions are cleared and reported as FAILURE
+ */
+static int phalcon_persistent_call(zval *handler, char *method, zval *param, zval **retval TSRMLS_DC){
+
+	zval *function_name, *params[1];
+	int status;
+
+	MAKE_STD_ZVAL(function_name);
+	ZVAL_STRING(function_name, method, 1);
+
+	MAKE_STD_ZVAL(*retval);
+	ZVAL_NULL(*retval);
+
+	params[0] = param;
+	status = call_user_function(NULL, &handler, function_name, *retval, param ? 1 : 0, params TSRMLS_CC);
+	zval_ptr_dtor(&function_name);
+
+	if (EG(exception)) {
+		zend_clear_exception(TSRMLS_C);
+		status = FAILURE;
+	}
+
+	return status;
+}
+
+/**
+ * Marks a slot as free
+ */
+static void phalcon_persistent_release_slot(phalcon_persistent_pool *pool, long slot){
+
+	pool->slots[slot].in_use = 0;
+	pool->slots[slot].released_at = time(NULL);
+}
+
+/**
+ * Takes a free slot from a pool, the warmest connection is preferred. Returns -1 if every slot
+ * is in use and the pool can't grow anymore. 'idle' receives the seconds the connection has been
+ * unused or -1 if it must be opened
+ */
+long phalcon_persistent_acquire(char *key, uint key_length, long max_size, long *idle, long *generation TSRMLS_DC){
+
+	phalcon_persistent_pool *pool;
+	long i, slot = -1;
+
+	*idle = -1;
+	*generation = 0;
+
+	if (max_size < 1) {
+		max_size = 1;
+	}
+
+	pool = phalcon_persistent_get_pool(key, key_length, 1 TSRMLS_CC);
+	if (!pool) {
+		return -1;
+	}
+
+	pool->max_size = max_size;
+
+	for (i = 0; i < pool->size && i < max_size; i++) {
+		if (!pool->slots[i].in_use) {
+			if (slot < 0 || pool->slots[i].released_at > pool->slots[slot].released_at) {
+				slot = i;
+			}
+		}
+	}
+
+	if (slot < 0) {
+
+		if (pool->size >= max_size) {
+			pool->overflows++;
+			return -1;
+		}
+
+		if (pool->size >= pool->allocated) {
+			pool->allocated = max_size;
+			pool->slots = perealloc(pool->slots, sizeof(phalcon_persistent_slot) * pool->allocated, 1);
+		}
+
+		slot = pool->size++;
+		memset(&pool->slots[slot], 0, sizeof(phalcon_persistent_slot));
+	}
+
+	if (pool->slots[slot].opened) {
+		*idle = (long) (time(NULL) - pool->slots[slot].released_at);
+		pool->hits++;
+	} else {
+		pool->misses++;
+	}
+
+	pool->slots[slot].in_use = 1;
+	pool->slots[slot].opened = 1;
+	*generation = pool->slots[slot].generation;
+
+	return slot;
+}
+
+/**
+ * Checks that the handler of a slot is still alive executing a cheap statement
+ */
+int phalcon_persistent_ping(char *key, uint key_length, zval *handler TSRMLS_DC){
+
+	phalcon_persistent_pool *pool;
+	zval *sql, *result = NULL;
+	int status;
+
+	MAKE_STD_ZVAL(sql);
+	ZVAL_STRING(sql, "SELECT 1", 1);
+	status = phalcon_persistent_call(handler, "query", sql, &result TSRMLS_CC);
+	zval_ptr_dtor(&sql);
+	zval_ptr_dtor(&result);
+
+	pool = phalcon_persistent_get_pool(key, key_length, 0 TSRMLS_CC);
+	if (pool) {
+		pool->pings++;
+		if (status == FAILURE) {
+			pool->ping_failures++;
+		}
+	}
+
+	return status;
+}
+
+/**
+ * Rolls back the transaction left open on a handler before its slot is released. Returns 1 if a
+ * transaction was rolled back, 0 if there wasn't one and -1 if the handler failed. Exceptions
+ * thrown by the handler are discarded and an exception already in flight is kept
+ */
+int phalcon_persistent_rollback(zval *handler TSRMLS_DC){
+
+	zval *in_transaction = NULL, *result = NULL;
+	zval *exception;
+	int status;
+
+	exception = EG(exception);
+	EG(exception) = NULL;
+
+	status = phalcon_persistent_call(handler, "inTransaction", NULL, &in_transaction TSRMLS_CC);
+	if (status == FAILURE) {
+		status = -1;
+	} else {
+		if (zend_is_true(in_transaction)) {
+			status = phalcon_persistent_call(handler, "rollBack", NULL, &result TSRMLS_CC) == FAILURE ? -1 : 1;
+			zval_ptr_dtor(&result);
+		} else {
+			status = 0;
+		}
+	}
+	zval_ptr_dtor(&in_transaction);
+
+	EG(exception) = exception;
+
+	return status;
+}
+
+/**
+ * Discards the dead connection of a slot, the next connection opened for the slot uses a new generation
+ */
+long phalcon_persistent_discard(char *key, uint key_length, long slot, char *handler_key, uint handler_key_length TSRMLS_DC){
+
+	phalcon_persistent_pool *pool;
+
+	if (handler_key) {
+		zend_hash_del(&EG(persistent_list), handler_key, handler_key_length + 1);
+	}
+
+	pool = phalcon_persistent_get_pool(key, key_length, 0 TSRMLS_CC);
+	if (!pool || slot < 0 || slot >= pool->size) {
+		return 0;
+	}
+
+	return ++pool->slots[slot].generation;
+}
+
+/**
+ * Returns a slot to its pool, 'rolled_back' is the result of phalcon_persistent_rollback. A slot
+ * whose handler failed is marked as released long ago so it's validated before being reused
+ */
+void phalcon_persistent_release(char *key, uint key_length, long slot, int rolled_back TSRMLS_DC){
+
+	phalcon_persistent_pool *pool;
+
+	pool = phalcon_persistent_get_pool(key, key_length, 0 TSRMLS_CC);
+	if (!pool || slot < 0 || slot >= pool->size) {
+		return;
+	}
+
+	if (rolled_back > 0) {
+		pool->rollbacks++;
+	}
+
+	if (pool->slots[slot].in_use) {
+		phalcon_persistent_release_slot(pool, slot);
+		if (rolled_back < 0) {
+			pool->slots[slot].released_at = 0;
+		}
+	}
+}
+
+/**
+ * Returns to their pools the slots that weren't released during the request. The request
+ * handlers are already gone at this point, PDO rolls back their open transactions itself
+ */
+void phalcon_persistent_release_all(TSRMLS_D){
 
-int phalcon_persistent_fetch(zval *return_value, zval *service TSRMLS_DC){
 	zend_rsrc_list_entry *le;
+	phalcon_persistent_pool *pool;
+	HashPosition pos;
+	long i;
+
+	zend_hash_internal_pointer_reset_ex(&EG(persistent_list), &pos);
+	while (zend_hash_get_current_data_ex(&EG(persistent_list), (void **) &le, &pos) == SUCCESS) {
+		if (Z_TYPE_P(le) == phalcon_persistent_le) {
+			pool = (phalcon_persistent_pool *) le->ptr;
+			for (i = 0; i < pool->size; i++) {
+				if (pool->slots[i].in_use) {
+					phalcon_persistent_release_slot(pool, i);
+				}
+			}
+		}
+		zend_hash_move_forward_ex(&EG(persistent_list), &pos);
+	}
+}
+
+/**
+ * Returns the statistics of the pools of the current worker
+ */
+void phalcon_persistent_stats(zval *return_value TSRMLS_DC){
+
+	zend_rsrc_list_entry *le;
+	phalcon_persistent_pool *pool;
+	HashPosition pos;
+	zval *stats;
+	char *key;
+	uint key_length;
+	ulong num_key;
+	long i, in_use;
+
+	array_init(return_value);
+
+	zend_hash_internal_pointer_reset_ex(&EG(persistent_list), &pos);
+	while (zend_hash_get_current_data_ex(&EG(persistent_list), (void **) &le, &pos) == SUCCESS) {
+		if (Z_TYPE_P(le) == phalcon_persistent_le) {
+
+			pool = (phalcon_persistent_pool *) le->ptr;
 
-	/* try to find if we already have this link in our persistent list */
-	if (zend_hash_find(&EG(persistent_list), Z_STRVAL_P(service), Z_STRLEN_P(service)+1, (void **) &le)==FAILURE) {
+			in_use = 0;
+			for (i = 0; i < pool->size; i++) {
+				if (pool->slots[i].in_use) {
+					in_use++;
+				}
+			}
 
+			MAKE_STD_ZVAL(stats);
+			array_init(stats);
+			add_assoc_long_ex(stats, SS("size"), pool->size);
+			add_assoc_long_ex(stats, SS("maxSize"), pool->max_size);
+			add_assoc_long_ex(stats, SS("inUse"), in_use);
+			add_assoc_long_ex(stats, SS("idle"), pool->size - in_use);
+			add_assoc_long_ex(stats, SS("hits"), pool->hits);
+			add_assoc_long_ex(stats, SS("misses"), pool->misses);
+			add_assoc_long_ex(stats, SS("pings"), pool->pings);
+			add_assoc_long_ex(stats, SS("pingFailures"), pool->ping_failures);
+			add_assoc_long_ex(stats, SS("rollbacks"), pool->rollbacks);
+			add_assoc_long_ex(stats, SS("overflows"), pool->overflows);
+
+			if (zend_hash_get_current_key_ex(&EG(persistent_list), &key, &key_length, &num_key, 0, &pos) == HASH_KEY_IS_STRING) {
+				/* skip the "phalcon_pool:" prefix */
+				add_assoc_zval_ex(return_value, key + 13, key_length - 13, stats);
+			} else {
+				add_next_index_zval(return_value, stats);
+			}
+		}
+		zend_hash_move_forward_ex(&EG(persistent_list), &pos);
+	}
+}
+
+/**
+ * Caches of strings living in the persistent list of every worker, they survive between requests
+ * and are used to avoid repeating filesystem lookups
+ */
+static HashTable *phalcon_persistent_get_cache(char *name, int create TSRMLS_DC){
+
+	zend_rsrc_list_entry *le, new_le;
+	HashTable *cache;
+	char *list_key;
+	int list_key_length;
+
+	list_key_length = spprintf(&list_key, 0, "phalcon_cache:%s", name);
+
+	if (zend_hash_find(&EG(persistent_list), list_key, list_key_length + 1, (void **) &le) == SUCCESS) {
+		if (Z_TYPE_P(le) == phalcon_persistent_cache_le) {
+			efree(list_key);
+			return (HashTable *) le->ptr;
+		}
+	}
+
+	if (!create) {
+		efree(list_key);
+		return NULL;
+	}
+
+	cache = pemalloc(sizeof(HashTable), 1);
+	zend_hash_init(cache, 0, NULL, phalcon_persistent_entry_dtor, 1);
+
+	Z_TYPE(new_le) = phalcon_persistent_cache_le;
+	new_le.ptr = cache;
+	if (zend_hash_update(&EG(persistent_list), list_key, list_key_length + 1, (void *) &new_le, sizeof(zend_rsrc_list_entry), NULL) == FAILURE) {
+		zend_hash_destroy(cache);
+		pefree(cache, 1);
+		efree(list_key);
+		return NULL;
 	}
+
+	efree(list_key);
+	return cache;
 }
 
-int phalcon_persistent_store(zval *service, zval *object TSRMLS_DC){
+/**
+ * Returns an entry of a cache or NULL if it doesn't exist
+ */
+phalcon_persistent_entry *phalcon_persistent_cache_find(char *name, char *key, uint key_length TSRMLS_DC){
+
+	HashTable *cache;
+	phalcon_persistent_entry *entry;
+
+	cache = phalcon_persistent_get_cache(name, 0 TSRMLS_CC);
+	if (!cache) {
+		return NULL;
+	}
 
-	//pdo_dbh_t *dbh = NULL;
+	if (zend_hash_find(cache, key, key_length, (void **) &entry) == SUCCESS) {
+		return entry;
+	}
 
-	//zend_object_store_set_object(object, dbh TSRMLS_CC);
+	return NULL;
+}
 
+/**
+ * Stores an entry in a cache, a NULL value stores a negative entry. Caches are emptied when they
+ * reach PHALCON_PERSISTENT_CACHE_SIZE entries
+ */
+phalcon_persistent_entry *phalcon_persistent_cache_store(char *name, char *key, uint key_length, char *value, uint value_length, long number TSRMLS_DC){
 
-	zend_rsrc_list_entry new_le;
+	HashTable *cache;
+	phalcon_persistent_entry entry, *stored;
+
+	cache = phalcon_persistent_get_cache(name, 1 TSRMLS_CC);
+	if (!cache) {
+		return NULL;
+	}
 
-	Z_TYPE(new_le) = 1;
-	new_le.ptr = pestrdup("hello", 1);
-	if (zend_hash_update(&EG(persistent_list), Z_STRVAL_P(service), Z_STRLEN_P(service)+1, (void *) &new_le, sizeof(zend_rsrc_list_entry), NULL)==FAILURE) {
-		//goto err;
+	if (zend_hash_num_elements(cache) >= PHALCON_PERSISTENT_CACHE_SIZE && !zend_hash_exists(cache, key, key_length)) {
+		zend_hash_clean(cache);
 	}
 
-	//phalcon_persistent_store
+	if (value) {
+		entry.value = pemalloc(value_length + 1, 1);
+		memcpy(entry.value, value, value_length);
+		entry.value[value_length] = '\0';
+	} else {
+		entry.value = NULL;
+	}
+	entry.value_length = value_length;
+	entry.number = number;
+	entry.checked_at = time(NULL);
+
+	if (zend_hash_update(cache, key, key_length, (void *) &entry, sizeof(phalcon_persistent_entry), (void **) &stored) == FAILURE) {
+		if (entry.value) {
+			pefree(entry.value, 1);
+		}
+		return NULL;
+	}
+
+	return stored;
+}
+
+/**
+ * Removes an entry from a cache
+ */
+void phalcon_persistent_cache_delete(char *name, char *key, uint key_length TSRMLS_DC){
+
+	HashTable *cache;
+
+	cache = phalcon_persistent_get_cache(name, 0 TSRMLS_CC);
+	if (cache) {
+		zend_hash_del(cache, key, key_length);
+	}
+}
+
+/**
+ * Removes all the entries of a cache
+ */
+void phalcon_persistent_cache_clear(char *name TSRMLS_DC){
+
+	HashTable *cache;
+
+	cache = phalcon_persistent_get_cache(name, 0 TSRMLS_CC);
+	if (cache) {
+		zend_hash_clean(cache);
+	}
+}
+
+/**
+ * Returns the number of entries of a cache
+ */
+long phalcon_persistent_cache_count(char *name TSRMLS_DC){
+
+	HashTable *cache;
+
+	cache = phalcon_persistent_get_cache(name, 0 TSRMLS_CC);
+	if (cache) {
+		return zend_hash_num_elements(cache);
+	}
 
+	return 0;
 }
@@ -1,3 +1,43 @@
 
-int phalcon_persistent_store(zval *service, zval *object TSRMLS_DC);
-int phalcon_persistent_fetch(zval *return_value, zval *service TSRMLS_DC);
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2013 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+#define PHALCON_PERSISTENT_CACHE_SIZE 4096
+
+typedef struct _phalcon_persistent_entry {
+	char *value;
+	uint value_length;
+	long number;
+	time_t checked_at;
+} phalcon_persistent_entry;
+
+extern int phalcon_persistent_init(int module_number TSRMLS_DC);
+extern void phalcon_persistent_hash(char *key, zval *dsn, zval *username, zval *password);
+extern long phalcon_persistent_acquire(char *key, uint key_length, long max_size, long *idle, long *generation TSRMLS_DC);
+extern int phalcon_persistent_ping(char *key, uint key_length, zval *handler TSRMLS_DC);
+extern int phalcon_persistent_rollback(zval *handler TSRMLS_DC);
+extern long phalcon_persistent_discard(char *key, uint key_length, long slot, char *handler_key, uint handler_key_length TSRMLS_DC);
+extern void phalcon_persistent_release(char *key, uint key_length, long slot, int rolled_back TSRMLS_DC);
+extern void phalcon_persistent_release_all(TSRMLS_D);
+extern void phalcon_persistent_stats(zval *return_value TSRMLS_DC);
+
+extern phalcon_persistent_entry *phalcon_persistent_cache_find(char *name, char *key, uint key_length TSRMLS_DC);
+extern phalcon_persistent_entry *phalcon_persistent_cache_store(char *name, char *key, uint key_length, char *value, uint value_length, long number TSRMLS_DC);
+extern void phalcon_persistent_cache_delete(char *name, char *key, uint key_length TSRMLS_DC);
+extern void phalcon_persistent_cache_clear(char *name TSRMLS_DC);
+extern long phalcon_persistent_cache_count(char *name TSRMLS_DC);
@@ -24,6 +24,7 @@
 #include "ext/standard/php_string.h"
 #include "ext/standard/php_rand.h"
 #include "ext/standard/php_lcg.h"
+#include "ext/standard/md5.h"
 
 #include "kernel/main.h"
 #include "kernel/memory.h"
@@ -1330,4 +1331,182 @@ void phalcon_unique_key(zval *return_value, zval *prefix, zval *value TSRMLS_DC)
 		RETURN_NULL();
 	}
 
-}
\ No newline at end of file
+}
+
+/**
+ * Replaces the :name: and ?N placeholders in a SQL statement by ? in a single pass.
+ * Placeholders inside quoted strings, quoted identifiers and comments are left untouched.
+ * Backslashes escape quotes only if 'backslash_escapes' is set, as in MySQL; PostgreSQL
+ * and SQLite treat them as ordinary characters. The name or number of every replaced
+ * placeholder is appended to 'names' in order
+ */
+void phalcon_convert_bound_params(zval *return_value, zval *names, zval *sql, int backslash_escapes){
+
+	unsigned int i, j, length;
+	char *str, ch, quote;
+	smart_str bound_sql = {0};
+
+	if (Z_TYPE_P(sql) != IS_STRING) {
+		ZVAL_NULL(return_value);
+		return;
+	}
+
+	str = Z_STRVAL_P(sql);
+	length = Z_STRLEN_P(sql);
+
+	for (i = 0; i < length; i++) {
+
+		ch = str[i];
+
+		/**
+		 * Quoted strings and quoted identifiers are copied as they are
+		 */
+		if (ch == '\'' || ch == '"' || ch == '`') {
+			quote = ch;
+			for (j = i + 1; j < length; j++) {
+				if (backslash_escapes && str[j] == '\\' && quote != '`') {
+					j++;
+					continue;
+				}
+				if (str[j] == quote) {
+					if (j + 1 < length && str[j + 1] == quote) {
+						j++;
+						continue;
+					}
+					break;
+				}
+			}
+			if (j >= length) {
+				j = length - 1;
+			}
+			smart_str_appendl(&bound_sql, str + i, j - i + 1);
+			i = j;
+			continue;
+		}
+
+		/**
+		 * Line comments
+		 */
+		if (ch == '-' && i + 1 < length && str[i + 1] == '-') {
+			for (j = i + 2; j < length; j++) {
+				if (str[j] == '\n') {
+					break;
+				}
+			}
+			if (j >= length) {
+				j = length - 1;
+			}
+			smart_str_appendl(&bound_sql, str + i, j - i + 1);
+			i = j;
+			continue;
+		}
+
+		/**
+		 * Block comments
+		 */
+		if (ch == '/' && i + 1 < length && str[i + 1] == '*') {
+			for (j = i + 2; j + 1 < length; j++) {
+				if (str[j] == '*' && str[j + 1] == '/') {
+					break;
+				}
+			}
+			if (j + 1 >= length) {
+				j = length - 1;
+			} else {
+				j++;
+			}
+			smart_str_appendl(&bound_sql, str + i, j - i + 1);
+			i = j;
+			continue;
+		}
+
+		/**
+		 * Numeric placeholders ?N
+		 */
+		if (ch == '?') {
+			for (j = i + 1; j < length; j++) {
+				if (str[j] < '0' || str[j] > '9') {
+					break;
+				}
+			}
+			if (j > i + 1) {
+				add_next_index_long(names, ZEND_STRTOL(str + i + 1, NULL, 10));
+				smart_str_appendc(&bound_sql, '?');
+				i = j - 1;
+				continue;
+			}
+		}
+
+		if (ch == ':') {
+
+			/**
+			 * Casts like ::integer are not placeholders
+			 */
+			if (i + 1 < length && str[i + 1] == ':') {
+				smart_str_appendl(&bound_sql, "::", 2);
+				i++;
+				continue;
+			}
+
+			/**
+			 * Named placeholders :name:
+			 */
+			for (j = i + 1; j < length; j++) {
+				ch = str[j];
+				if (!((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_')) {
+					break;
+				}
+			}
+			if (j > i + 1 && j < length && str[j] == ':') {
+				add_next_index_stringl(names, str + i + 1, j - i - 1, 1);
+				smart_str_appendc(&bound_sql, '?');
+				i = j;
+				continue;
+			}
+
+			ch = ':';
+		}
+
+		smart_str_appendc(&bound_sql, ch);
+	}
+
+	smart_str_0(&bound_sql);
+
+	if (bound_sql.len) {
+		RETURN_STRINGL(bound_sql.c, bound_sql.len, 0);
+	} else {
+		smart_str_free(&bound_sql);
+		RETURN_EMPTY_STRING();
+	}
+
+}
+
+/**
+ * Computes the md5 hash of a string, it's equivalent to md5() in PHP
+ */
+void phalcon_md5(zval *return_value, zval *str){
+
+	PHP_MD5_CTX context;
+	unsigned char digest[16];
+	char hash[33];
+	zval copy;
+	int use_copy = 0;
+
+	if (Z_TYPE_P(str) != IS_STRING) {
+		zend_make_printable_zval(str, &copy, &use_copy);
+		if (use_copy) {
+			str = &copy;
+		}
+	}
+
+	PHP_MD5Init(&context);
+	PHP_MD5Update(&context, (unsigned char *) Z_STRVAL_P(str), Z_STRLEN_P(str));
+	PHP_MD5Final(digest, &context);
+	make_digest(hash, digest);
+
+	if (use_copy) {
+		zval_dtor(str);
+	}
+
+	ZVAL_STRINGL(return_value, hash, 32, 1);
+}
@@ -40,6 +40,9 @@ extern void phalcon_uncamelize(zval *return_value, zval *str TSRMLS_DC);
 extern void phalcon_extract_named_params(zval *return_value, zval *str, zval *matches);
 extern void phalcon_replace_paths(zval *return_value, zval *pattern, zval *paths, zval *uri TSRMLS_DC);
 
+/** Converts :name: and ?N placeholders into PDO placeholders */
+extern void phalcon_convert_bound_params(zval *return_value, zval *names, zval *sql, int backslash_escapes);
+
 /** Starts/Ends with */
 extern int phalcon_start_with(zval *str, zval *compared, zval *ignore_case);
 extern int phalcon_start_with_str(zval *str, char *compared, unsigned int compared_length);
@@ -60,4 +63,7 @@ extern void phalcon_unique_key(zval *return_value, zval *prefix, zval *value TSR
 extern int phalcon_spprintf(char **message, int max_len, char *format, ...);
 
 /* Substr */
-void phalcon_substr(zval *return_value, zval *str, unsigned long from, unsigned long length TSRMLS_DC);
\ No newline at end of file
+void phalcon_substr(zval *return_value, zval *str, unsigned long from, unsigned long length TSRMLS_DC);
+
+/** Hash */
+extern void phalcon_md5(zval *return_value, zval *str);
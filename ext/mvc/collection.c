@@ -63,6 +63,7 @@ PHALCON_INIT_CLASS(Phalcon_Mvc_Collection){
 	zend_declare_property_long(phalcon_mvc_collection_ce, SL("_operationMade"), 0, ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_collection_ce, SL("_connection"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_collection_ce, SL("_errorMessages"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_bool(phalcon_mvc_collection_ce, SL("_partial"), 0, ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_collection_ce, SL("_reserved"), ZEND_ACC_PROTECTED|ZEND_ACC_STATIC TSRMLS_CC);
 	zend_declare_property_bool(phalcon_mvc_collection_ce, SL("_disableEvents"), 0, ZEND_ACC_PROTECTED|ZEND_ACC_STATIC TSRMLS_CC);
 
@@ -299,12 +300,13 @@ PHP_METHOD(Phalcon_Mvc_Collection, getReservedAttributes){
 	phalcon_read_static_property(&reserved, SL("phalcon\\mvc\\collection"), SL("_reserved") TSRMLS_CC);
 	if (Z_TYPE_P(reserved) == IS_NULL) {
 		PHALCON_INIT_NVAR(reserved);
-		array_init_size(reserved, 5);
+		array_init_size(reserved, 6);
 		add_assoc_bool_ex(reserved, SS("_connection"), 1);
 		add_assoc_bool_ex(reserved, SS("_dependencyInjector"), 1);
 		add_assoc_bool_ex(reserved, SS("_source"), 1);
 		add_assoc_bool_ex(reserved, SS("_operationMade"), 1);
 		add_assoc_bool_ex(reserved, SS("_errorMessages"), 1);
+		add_assoc_bool_ex(reserved, SS("_partial"), 1);
 		phalcon_update_static_property(SL("phalcon\\mvc\\collection"), SL("_reserved"), reserved TSRMLS_CC);
 	}
 	
@@ -555,7 +557,7 @@ PHP_METHOD(Phalcon_Mvc_Collection, cloneResult){
  * @param Phalcon\Mvc\Collection $collection
  * @param \MongoDb $connection
  * @param boolean $unique
- * @return array
+ * @return array|Phalcon\Mvc\Collection\Resultset
  */
 PHP_METHOD(Phalcon_Mvc_Collection, _getResultset){
 
@@ -563,6 +565,7 @@ PHP_METHOD(Phalcon_Mvc_Collection, _getResultset){
 	zval *source, *mongo_collection, *conditions = NULL;
 	zval *documents_cursor, *limit, *sort = NULL, *document = NULL;
 	zval *collection_cloned = NULL, *collections, *documents_array;
+	zval *fields = NULL, *batch_size, *use_cursor, *resultset;
 	HashTable *ah0;
 	HashPosition hp0;
 	zval **hd;
@@ -595,11 +598,30 @@ PHP_METHOD(Phalcon_Mvc_Collection, _getResultset){
 		}
 	}
 	
+	/** 
+	 * Check if a 'fields' projection was defined
+	 */
+	if (phalcon_array_isset_string(params, SS("fields"))) {
+		PHALCON_OBS_VAR(fields);
+		phalcon_array_fetch_string(&fields, params, SL("fields"), PH_NOISY_CC);
+	
+		/** 
+		 * Documents hydrated from a projection are incomplete, the base collection is marked
+		 * so every clone made from it refuses to be saved
+		 */
+		if (phalcon_fast_count_ev(fields TSRMLS_CC)) {
+			phalcon_update_property_bool(collection, SL("_partial"), 1 TSRMLS_CC);
+		}
+	} else {
+		PHALCON_INIT_VAR(fields);
+		array_init(fields);
+	}
+	
 	/** 
 	 * Perform the find
 	 */
 	PHALCON_INIT_VAR(documents_cursor);
-	PHALCON_CALL_METHOD_PARAMS_1(documents_cursor, mongo_collection, "find", conditions);
+	PHALCON_CALL_METHOD_PARAMS_2(documents_cursor, mongo_collection, "find", conditions, fields);
 	
 	/** 
 	 * Check if a 'limit' clause was defined
@@ -646,6 +668,31 @@ PHP_METHOD(Phalcon_Mvc_Collection, _getResultset){
 		RETURN_MM_FALSE;
 	}
 	
+	/** 
+	 * Check if a 'batchSize' was defined, this is the number of documents fetched in every round-trip
+	 */
+	if (phalcon_array_isset_string(params, SS("batchSize"))) {
+		PHALCON_OBS_VAR(batch_size);
+		phalcon_array_fetch_string(&batch_size, params, SL("batchSize"), PH_NOISY_CC);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(documents_cursor, "batchsize", batch_size);
+	}
+	
+	/** 
+	 * Requesting a resultset that hydrates the documents while the cursor is traversed
+	 */
+	if (phalcon_array_isset_string(params, SS("cursor"))) {
+	
+		PHALCON_OBS_VAR(use_cursor);
+		phalcon_array_fetch_string(&use_cursor, params, SL("cursor"), PH_NOISY_CC);
+		if (zend_is_true(use_cursor)) {
+			PHALCON_INIT_VAR(resultset);
+			object_init_ex(resultset, phalcon_mvc_collection_resultset_ce);
+			PHALCON_CALL_METHOD_PARAMS_2_NORETURN(resultset, "__construct", collection, documents_cursor);
+	
+			RETURN_CTOR(resultset);
+		}
+	}
+	
 	/** 
 	 * Requesting a complete resultset
 	 */
@@ -1316,12 +1363,23 @@ PHP_METHOD(Phalcon_Mvc_Collection, save){
 	zval *collection, *exists, *empty_array, *disable_events;
 	zval *status = NULL, *data, *reserved, *properties, *value = NULL;
 	zval *key = NULL, *success = NULL, *options, *ok, *id, *post_success;
+	zval *partial;
 	HashTable *ah0;
 	HashPosition hp0;
 	zval **hd;
 
 	PHALCON_MM_GROW();
 
+	/** 
+	 * MongoCollection::save replaces the whole document, saving a projection would drop the missing fields
+	 */
+	PHALCON_OBS_VAR(partial);
+	phalcon_read_property(&partial, this_ptr, SL("_partial"), PH_NOISY_CC);
+	if (zend_is_true(partial)) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_collection_exception_ce, "The document was hydrated using a 'fields' projection and can't be saved");
+		return;
+	}
+
 	PHALCON_OBS_VAR(dependency_injector);
 	phalcon_read_property(&dependency_injector, this_ptr, SL("_dependencyInjector"), PH_NOISY_CC);
 	if (Z_TYPE_P(dependency_injector) != IS_OBJECT) {
@@ -1452,6 +1510,440 @@ PHP_METHOD(Phalcon_Mvc_Collection, save){
 	RETURN_CCTOR(post_success);
 }
 
+/**
+ * Executes a safe write in the MongoCollection, errors reported by the server or thrown
+ * by the driver are returned as FAILURE so the rest of the batch can continue
+ */
+static int phalcon_mvc_collection_try_write(zval *result, zval *mongo_collection, char *method, zval *param1, zval *param2 TSRMLS_DC){
+
+	zval *method_name, *params[2], **ok, **err;
+	int status;
+
+	MAKE_STD_ZVAL(method_name);
+	ZVAL_STRING(method_name, method, 1);
+
+	params[0] = param1;
+	params[1] = param2;
+	status = call_user_function(NULL, &mongo_collection, method_name, result, 2, params TSRMLS_CC);
+	zval_ptr_dtor(&method_name);
+
+	if (EG(exception)) {
+		zend_clear_exception(TSRMLS_C);
+		return FAILURE;
+	}
+
+	if (status == FAILURE || Z_TYPE_P(result) != IS_ARRAY) {
+		return FAILURE;
+	}
+
+	if (zend_hash_find(Z_ARRVAL_P(result), SS("ok"), (void **) &ok) == FAILURE || !zend_is_true(*ok)) {
+		return FAILURE;
+	}
+
+	if (zend_hash_find(Z_ARRVAL_P(result), SS("err"), (void **) &err) == SUCCESS && Z_TYPE_PP(err) != IS_NULL) {
+		return FAILURE;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * Saves a set of documents of the same collection. Every document is validated and the events are fired
+ * as in Phalcon\Mvc\Collection::save, unless the 'events' option is false. New documents are inserted
+ * with MongoCollection::batchInsert in batches of 'batchSize' documents (1000 by default), documents
+ * having an _id are upserted one by one. An array with the success state of every document is returned
+ * using the same keys passed in $collections
+ *
+ *<code>
+ * $robots = array();
+ * foreach ($rows as $row) {
+ *     $robot = new Robots();
+ *     $robot->name = $row['name'];
+ *     $robots[] = $robot;
+ * }
+ * $results = Robots::saveMany($robots, array('events' => false, 'batchSize' => 5000));
+ *</code>
+ *
+ * @param Phalcon\Mvc\Collection[] $collections
+ * @param array $options
+ * @return array
+ */
+PHP_METHOD(Phalcon_Mvc_Collection, saveMany){
+
+	zval *collections, *options = NULL, *class_name, *base_collection;
+	zval *dependency_injector, *source, *connection, *mongo_collection;
+	zval *disable_events = NULL, *events, *batch_size = NULL, *reserved;
+	zval *write_options, *insert_options, *results, *pending;
+	zval *pending_collections, *empty_array, *mongo_id_class;
+	zval *idx = NULL, *document = NULL, *id = NULL, *exists = NULL, *status = NULL;
+	zval *data = NULL, *properties = NULL, *key = NULL, *value = NULL;
+	zval *success = NULL, *result = NULL, *post_success = NULL, *chunks;
+	zval *chunk = NULL, *documents = NULL, *ids = NULL, *in_ids = NULL;
+	zval *query = NULL, *fields = NULL, *cursor = NULL, *found = NULL;
+	zval *document_data = NULL, *document_id = NULL, *id_string = NULL;
+	zval *preserve_keys, *partial = NULL, *upserts;
+	zend_class_entry *ce0, *ce1;
+	HashTable *ah0, *ah1, *ah2, *ah3, *ah4, *ah5;
+	HashPosition hp0, hp1, hp2, hp3, hp4, hp5;
+	zval **hd;
+	int chunk_status;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &collections, &options) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!options) {
+		PHALCON_INIT_VAR(options);
+	}
+	
+	if (Z_TYPE_P(collections) != IS_ARRAY) { 
+		PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_collection_exception_ce, "Collections to save must be an Array");
+		return;
+	}
+	
+	PHALCON_INIT_VAR(class_name);
+	phalcon_get_called_class(class_name  TSRMLS_CC);
+	ce0 = phalcon_fetch_class(class_name TSRMLS_CC);
+	
+	PHALCON_INIT_VAR(base_collection);
+	object_init_ex(base_collection, ce0);
+	if (phalcon_has_constructor(base_collection TSRMLS_CC)) {
+		PHALCON_CALL_METHOD_NORETURN(base_collection, "__construct");
+	}
+	
+	PHALCON_INIT_VAR(dependency_injector);
+	PHALCON_CALL_METHOD(dependency_injector, base_collection, "getdi");
+	if (Z_TYPE_P(dependency_injector) != IS_OBJECT) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_model_exception_ce, "A dependency injector container is required to obtain the services related to the ORM");
+		return;
+	}
+	
+	PHALCON_INIT_VAR(source);
+	PHALCON_CALL_METHOD(source, base_collection, "getsource");
+	
+	PHALCON_INIT_VAR(connection);
+	PHALCON_CALL_METHOD(connection, base_collection, "getconnection");
+	
+	PHALCON_INIT_VAR(mongo_collection);
+	PHALCON_CALL_METHOD_PARAMS_1(mongo_collection, connection, "selectcollection", source);
+	
+	PHALCON_OBS_VAR(disable_events);
+	phalcon_read_static_property(&disable_events, SL("phalcon\\mvc\\collection"), SL("_disableEvents") TSRMLS_CC);
+	
+	PHALCON_INIT_VAR(batch_size);
+	ZVAL_LONG(batch_size, 1000);
+	
+	if (Z_TYPE_P(options) == IS_ARRAY) { 
+		if (phalcon_array_isset_string(options, SS("events"))) {
+			PHALCON_OBS_VAR(events);
+			phalcon_array_fetch_string(&events, options, SL("events"), PH_NOISY_CC);
+			if (!zend_is_true(events)) {
+				PHALCON_INIT_NVAR(disable_events);
+				ZVAL_BOOL(disable_events, 1);
+			}
+		}
+		if (phalcon_array_isset_string(options, SS("batchSize"))) {
+			PHALCON_OBS_NVAR(batch_size);
+			phalcon_array_fetch_string(&batch_size, options, SL("batchSize"), PH_NOISY_CC);
+			if (phalcon_get_intval(batch_size) <= 0) {
+				PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_collection_exception_ce, "The batch size must be greater than zero");
+				return;
+			}
+		}
+	}
+	
+	PHALCON_INIT_VAR(reserved);
+	PHALCON_CALL_METHOD(reserved, base_collection, "getreservedattributes");
+	
+	/** 
+	 * We always use safe stores to get the success state
+	 */
+	PHALCON_INIT_VAR(write_options);
+	array_init_size(write_options, 1);
+	add_assoc_bool_ex(write_options, SS("safe"), 1);
+	
+	PHALCON_INIT_VAR(insert_options);
+	array_init_size(insert_options, 2);
+	add_assoc_bool_ex(insert_options, SS("safe"), 1);
+	add_assoc_bool_ex(insert_options, SS("continueOnError"), 1);
+	
+	PHALCON_INIT_VAR(empty_array);
+	array_init(empty_array);
+	
+	PHALCON_INIT_VAR(mongo_id_class);
+	ZVAL_STRING(mongo_id_class, "MongoId", 1);
+	ce1 = phalcon_fetch_class(mongo_id_class TSRMLS_CC);
+	
+	PHALCON_INIT_VAR(results);
+	array_init(results);
+	
+	PHALCON_INIT_VAR(pending);
+	array_init(pending);
+	
+	PHALCON_INIT_VAR(pending_collections);
+	array_init(pending_collections);
+	
+	PHALCON_INIT_VAR(upserts);
+	array_init(upserts);
+	
+	/** 
+	 * Every document is checked before writing anything, an invalid document in the middle of
+	 * the set must not leave it half-written
+	 */
+	if (!phalcon_is_iterable(collections, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_KEY(idx, ah0, hp0);
+		PHALCON_GET_FOREACH_VALUE(document);
+	
+		if (Z_TYPE_P(document) != IS_OBJECT) {
+			PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_collection_exception_ce, "Invalid collection");
+			return;
+		}
+	
+		PHALCON_OBS_NVAR(partial);
+		phalcon_read_property(&partial, document, SL("_partial"), PH_NOISY_CC);
+		if (zend_is_true(partial)) {
+			PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_collection_exception_ce, "The document was hydrated using a 'fields' projection and can't be saved");
+			return;
+		}
+	
+		/** 
+		 * The results keep the order of the documents passed
+		 */
+		phalcon_array_update_zval_bool(&results, idx, 0, PH_SEPARATE TSRMLS_CC);
+	
+		zend_hash_move_forward_ex(ah0, &hp0);
+	}
+	
+	/** 
+	 * Validate the documents and prepare their data, nothing is written yet
+	 */
+	zend_hash_internal_pointer_reset_ex(ah0, &hp0);
+	
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_KEY(idx, ah0, hp0);
+		PHALCON_GET_FOREACH_VALUE(document);
+	
+		/** 
+		 * Documents with an _id are upserted, the others are inserted without checking their existence
+		 */
+		PHALCON_OBS_NVAR(id);
+		phalcon_read_property(&id, document, SL("_id"), PH_NOISY_CC);
+	
+		PHALCON_INIT_NVAR(exists);
+		ZVAL_BOOL(exists, Z_TYPE_P(id) != IS_NULL);
+		if (zend_is_true(exists)) {
+			phalcon_update_property_long(document, SL("_operationMade"), 2 TSRMLS_CC);
+		} else {
+			phalcon_update_property_long(document, SL("_operationMade"), 1 TSRMLS_CC);
+		}
+	
+		phalcon_update_property_zval(document, SL("_errorMessages"), empty_array TSRMLS_CC);
+	
+		PHALCON_INIT_NVAR(status);
+		PHALCON_CALL_METHOD_PARAMS_3(status, document, "_presave", dependency_injector, disable_events, exists);
+		if (PHALCON_IS_FALSE(status)) {
+			zend_hash_move_forward_ex(ah0, &hp0);
+			continue;
+		}
+	
+		PHALCON_INIT_NVAR(data);
+		array_init(data);
+	
+		PHALCON_INIT_NVAR(properties);
+		PHALCON_CALL_FUNC_PARAMS_1(properties, "get_object_vars", document);
+	
+		/** 
+		 * We only assign values to the public properties
+		 */
+		if (!phalcon_is_iterable(properties, &ah1, &hp1, 0, 0 TSRMLS_CC)) {
+			return;
+		}
+	
+		while (zend_hash_get_current_data_ex(ah1, (void**) &hd, &hp1) == SUCCESS) {
+	
+			PHALCON_GET_FOREACH_KEY(key, ah1, hp1);
+			PHALCON_GET_FOREACH_VALUE(value);
+	
+			if (PHALCON_IS_STRING(key, "_id")) {
+				if (Z_TYPE_P(value) != IS_NULL) {
+					phalcon_array_update_zval(&data, key, &value, PH_COPY | PH_SEPARATE TSRMLS_CC);
+				}
+			} else {
+				if (!phalcon_array_isset(reserved, key)) {
+					phalcon_array_update_zval(&data, key, &value, PH_COPY | PH_SEPARATE TSRMLS_CC);
+				}
+			}
+	
+			zend_hash_move_forward_ex(ah1, &hp1);
+		}
+	
+		if (zend_is_true(exists)) {
+			phalcon_array_update_zval(&upserts, idx, &data, PH_COPY | PH_SEPARATE TSRMLS_CC);
+			phalcon_array_update_zval(&pending_collections, idx, &document, PH_COPY | PH_SEPARATE TSRMLS_CC);
+		} else {
+			/** 
+			 * The ids are generated here, so the inserted documents can be located if a batch fails
+			 */
+			PHALCON_INIT_NVAR(id);
+			object_init_ex(id, ce1);
+			PHALCON_CALL_METHOD_NORETURN(id, "__construct");
+			phalcon_array_update_string(&data, SL("_id"), &id, PH_COPY | PH_SEPARATE TSRMLS_CC);
+			phalcon_update_property_zval(document, SL("_id"), id TSRMLS_CC);
+	
+			phalcon_array_update_zval(&pending, idx, &data, PH_COPY | PH_SEPARATE TSRMLS_CC);
+			phalcon_array_update_zval(&pending_collections, idx, &document, PH_COPY | PH_SEPARATE TSRMLS_CC);
+		}
+	
+		zend_hash_move_forward_ex(ah0, &hp0);
+	}
+	
+	/** 
+	 * Upsert the documents having an _id
+	 */
+	if (!phalcon_is_iterable(upserts, &ah5, &hp5, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah5, (void**) &hd, &hp5) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_KEY(idx, ah5, hp5);
+		PHALCON_GET_FOREACH_VALUE(data);
+	
+		PHALCON_INIT_NVAR(result);
+		PHALCON_INIT_NVAR(success);
+		ZVAL_BOOL(success, phalcon_mvc_collection_try_write(result, mongo_collection, "save", data, write_options TSRMLS_CC) == SUCCESS);
+	
+		PHALCON_OBS_NVAR(document);
+		phalcon_array_fetch(&document, pending_collections, idx, PH_NOISY_CC);
+	
+		PHALCON_INIT_NVAR(exists);
+		ZVAL_BOOL(exists, 1);
+	
+		PHALCON_INIT_NVAR(post_success);
+		PHALCON_CALL_METHOD_PARAMS_3(post_success, document, "_postsave", disable_events, success, exists);
+		phalcon_array_update_zval(&results, idx, &post_success, PH_COPY | PH_SEPARATE TSRMLS_CC);
+	
+		zend_hash_move_forward_ex(ah5, &hp5);
+	}
+	
+	/** 
+	 * Insert the new documents in batches
+	 */
+	PHALCON_INIT_VAR(preserve_keys);
+	ZVAL_BOOL(preserve_keys, 1);
+	
+	PHALCON_INIT_VAR(chunks);
+	PHALCON_CALL_FUNC_PARAMS_3(chunks, "array_chunk", pending, batch_size, preserve_keys);
+	
+	if (!phalcon_is_iterable(chunks, &ah2, &hp2, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah2, (void**) &hd, &hp2) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_VALUE(chunk);
+	
+		PHALCON_INIT_NVAR(documents);
+		PHALCON_CALL_FUNC_PARAMS_1(documents, "array_values", chunk);
+	
+		PHALCON_INIT_NVAR(result);
+		chunk_status = phalcon_mvc_collection_try_write(result, mongo_collection, "batchinsert", documents, insert_options TSRMLS_CC);
+	
+		/** 
+		 * The server only reports the last error of a batch, the documents really inserted are queried by their ids
+		 */
+		PHALCON_INIT_NVAR(found);
+		if (chunk_status == FAILURE) {
+	
+			PHALCON_INIT_NVAR(ids);
+			array_init(ids);
+	
+			if (!phalcon_is_iterable(chunk, &ah3, &hp3, 0, 0 TSRMLS_CC)) {
+				return;
+			}
+	
+			while (zend_hash_get_current_data_ex(ah3, (void**) &hd, &hp3) == SUCCESS) {
+	
+				PHALCON_GET_FOREACH_VALUE(document_data);
+	
+				PHALCON_OBS_NVAR(document_id);
+				phalcon_array_fetch_string(&document_id, document_data, SL("_id"), PH_NOISY_CC);
+				phalcon_array_append(&ids, document_id, PH_SEPARATE TSRMLS_CC);
+	
+				zend_hash_move_forward_ex(ah3, &hp3);
+			}
+	
+			PHALCON_INIT_NVAR(in_ids);
+			array_init_size(in_ids, 1);
+			phalcon_array_update_string(&in_ids, SL("$in"), &ids, PH_COPY | PH_SEPARATE TSRMLS_CC);
+	
+			PHALCON_INIT_NVAR(query);
+			array_init_size(query, 1);
+			phalcon_array_update_string(&query, SL("_id"), &in_ids, PH_COPY | PH_SEPARATE TSRMLS_CC);
+	
+			PHALCON_INIT_NVAR(fields);
+			array_init_size(fields, 1);
+			add_assoc_long_ex(fields, SS("_id"), 1);
+	
+			PHALCON_INIT_NVAR(cursor);
+			PHALCON_CALL_METHOD_PARAMS_2(cursor, mongo_collection, "find", query, fields);
+	
+			PHALCON_INIT_NVAR(found);
+			PHALCON_CALL_FUNC_PARAMS_1(found, "iterator_to_array", cursor);
+		}
+	
+		if (!phalcon_is_iterable(chunk, &ah4, &hp4, 0, 0 TSRMLS_CC)) {
+			return;
+		}
+	
+		while (zend_hash_get_current_data_ex(ah4, (void**) &hd, &hp4) == SUCCESS) {
+	
+			PHALCON_GET_FOREACH_KEY(idx, ah4, hp4);
+			PHALCON_GET_FOREACH_VALUE(document_data);
+	
+			PHALCON_INIT_NVAR(success);
+			if (chunk_status == SUCCESS) {
+				ZVAL_BOOL(success, 1);
+			} else {
+				PHALCON_OBS_NVAR(document_id);
+				phalcon_array_fetch_string(&document_id, document_data, SL("_id"), PH_NOISY_CC);
+	
+				PHALCON_INIT_NVAR(id_string);
+				PHALCON_CALL_METHOD(id_string, document_id, "__tostring");
+				ZVAL_BOOL(success, phalcon_array_isset(found, id_string));
+			}
+	
+			PHALCON_OBS_NVAR(document);
+			phalcon_array_fetch(&document, pending_collections, idx, PH_NOISY_CC);
+			if (!zend_is_true(success)) {
+				phalcon_update_property_null(document, SL("_id") TSRMLS_CC);
+			}
+	
+			PHALCON_INIT_NVAR(exists);
+			ZVAL_BOOL(exists, 0);
+	
+			PHALCON_INIT_NVAR(post_success);
+			PHALCON_CALL_METHOD_PARAMS_3(post_success, document, "_postsave", disable_events, success, exists);
+			phalcon_array_update_zval(&results, idx, &post_success, PH_COPY | PH_SEPARATE TSRMLS_CC);
+	
+			zend_hash_move_forward_ex(ah4, &hp4);
+		}
+	
+		zend_hash_move_forward_ex(ah2, &hp2);
+	}
+	
+	
+	RETURN_CTOR(results);
+}
+
 /**
  * Find a document by its id (_id)
  *
@@ -1624,10 +2116,20 @@ PHP_METHOD(Phalcon_Mvc_Collection, findFirst){
  * foreach ($robots as $robot) {
  *	   echo $robot->name, "\n";
  * }
+ *
+ * //Traverse all the robots fetching only their names in batches of 1000 documents
+ * $robots = Robots::find(array(
+ *     "fields" => array("name" => 1),
+ *     "batchSize" => 1000,
+ *     "cursor" => true
+ * ));
+ * foreach ($robots as $robot) {
+ *	   echo $robot->name, "\n";
+ * }
  * </code>
  *
  * @param 	array $parameters
- * @return  array
+ * @return  array|Phalcon\Mvc\Collection\Resultset
  */
 PHP_METHOD(Phalcon_Mvc_Collection, find){
 
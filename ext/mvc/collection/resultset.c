@@ -0,0 +1,261 @@
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2013 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+#include "php_phalcon.h"
+#include "phalcon.h"
+
+#include "Zend/zend_operators.h"
+#include "Zend/zend_exceptions.h"
+#include "Zend/zend_interfaces.h"
+
+#include "kernel/main.h"
+#include "kernel/memory.h"
+
+#include "kernel/object.h"
+#include "kernel/operators.h"
+#include "kernel/fcall.h"
+#include "kernel/exception.h"
+
+/**
+ * Phalcon\Mvc\Collection\Resultset
+ *
+ * This resultset wraps a MongoCursor and hydrates the documents one by one as the resultset
+ * is traversed, so only the current document and the batch fetched by the driver are kept in memory.
+ * It's returned by Phalcon\Mvc\Collection::find when the 'cursor' parameter is passed. Documents hydrated
+ * using a 'fields' projection can't be saved
+ *
+ *<code>
+ * $robots = Robots::find(array(
+ *     array("type" => "virtual"),
+ *     "fields" => array("name" => 1),
+ *     "batchSize" => 500,
+ *     "cursor" => true
+ * ));
+ * foreach ($robots as $robot) {
+ *	   echo $robot->name, "\n";
+ * }
+ *</code>
+ */
+
+
+/**
+ * Phalcon\Mvc\Collection\Resultset initializer
+ */
+PHALCON_INIT_CLASS(Phalcon_Mvc_Collection_Resultset){
+
+	PHALCON_REGISTER_CLASS(Phalcon\\Mvc\\Collection, Resultset, mvc_collection_resultset, phalcon_mvc_collection_resultset_method_entry, 0);
+
+	zend_declare_property_null(phalcon_mvc_collection_resultset_ce, SL("_collection"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_collection_resultset_ce, SL("_cursor"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_long(phalcon_mvc_collection_resultset_ce, SL("_pointer"), 0, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_collection_resultset_ce, SL("_activeRow"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_collection_resultset_ce, SL("_count"), ZEND_ACC_PROTECTED TSRMLS_CC);
+
+	zend_class_implements(phalcon_mvc_collection_resultset_ce TSRMLS_CC, 2, zend_ce_iterator, spl_ce_Countable);
+
+	return SUCCESS;
+}
+
+/**
+ * Phalcon\Mvc\Collection\Resultset constructor
+ *
+ * @param Phalcon\Mvc\Collection $collection
+ * @param \MongoCursor $cursor
+ */
+PHP_METHOD(Phalcon_Mvc_Collection_Resultset, __construct){
+
+	zval *collection, *cursor;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "zz", &collection, &cursor) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (Z_TYPE_P(collection) != IS_OBJECT) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_collection_exception_ce, "Invalid collection");
+		return;
+	}
+	if (Z_TYPE_P(cursor) != IS_OBJECT) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_collection_exception_ce, "Invalid cursor");
+		return;
+	}
+
+	phalcon_update_property_zval(this_ptr, SL("_collection"), collection TSRMLS_CC);
+	phalcon_update_property_zval(this_ptr, SL("_cursor"), cursor TSRMLS_CC);
+
+	PHALCON_MM_RESTORE();
+}
+
+/**
+ * Rewinds the cursor, this re-executes the query in the server
+ */
+PHP_METHOD(Phalcon_Mvc_Collection_Resultset, rewind){
+
+	zval *cursor;
+
+	PHALCON_MM_GROW();
+
+	PHALCON_OBS_VAR(cursor);
+	phalcon_read_property(&cursor, this_ptr, SL("_cursor"), PH_NOISY_CC);
+	PHALCON_CALL_METHOD_NORETURN(cursor, "rewind");
+
+	phalcon_update_property_long(this_ptr, SL("_pointer"), 0 TSRMLS_CC);
+	phalcon_update_property_null(this_ptr, SL("_activeRow") TSRMLS_CC);
+
+	PHALCON_MM_RESTORE();
+}
+
+/**
+ * Check whether the cursor has a document in the current position
+ *
+ * @return boolean
+ */
+PHP_METHOD(Phalcon_Mvc_Collection_Resultset, valid){
+
+	zval *cursor, *valid;
+
+	PHALCON_MM_GROW();
+
+	PHALCON_OBS_VAR(cursor);
+	phalcon_read_property(&cursor, this_ptr, SL("_cursor"), PH_NOISY_CC);
+
+	PHALCON_INIT_VAR(valid);
+	PHALCON_CALL_METHOD(valid, cursor, "valid");
+
+	RETURN_CCTOR(valid);
+}
+
+/**
+ * Returns the current document hydrated as a collection
+ *
+ * @return Phalcon\Mvc\Collection
+ */
+PHP_METHOD(Phalcon_Mvc_Collection_Resultset, current){
+
+	zval *active_row, *cursor, *document, *collection;
+	zval *collection_cloned;
+
+	PHALCON_MM_GROW();
+
+	/**
+	 * The document in the current position is only hydrated once
+	 */
+	PHALCON_OBS_VAR(active_row);
+	phalcon_read_property(&active_row, this_ptr, SL("_activeRow"), PH_NOISY_CC);
+	if (Z_TYPE_P(active_row) == IS_OBJECT) {
+		RETURN_CCTOR(active_row);
+	}
+
+	PHALCON_OBS_VAR(cursor);
+	phalcon_read_property(&cursor, this_ptr, SL("_cursor"), PH_NOISY_CC);
+
+	PHALCON_INIT_VAR(document);
+	PHALCON_CALL_METHOD(document, cursor, "current");
+	if (Z_TYPE_P(document) != IS_ARRAY) {
+		RETURN_MM_FALSE;
+	}
+
+	PHALCON_OBS_VAR(collection);
+	phalcon_read_property(&collection, this_ptr, SL("_collection"), PH_NOISY_CC);
+
+	PHALCON_INIT_VAR(collection_cloned);
+	PHALCON_CALL_METHOD_PARAMS_2(collection_cloned, collection, "cloneresult", collection, document);
+	phalcon_update_property_zval(this_ptr, SL("_activeRow"), collection_cloned TSRMLS_CC);
+
+	RETURN_CCTOR(collection_cloned);
+}
+
+/**
+ * Returns the position of the current document
+ *
+ * @return int
+ */
+PHP_METHOD(Phalcon_Mvc_Collection_Resultset, key){
+
+
+	RETURN_MEMBER(this_ptr, "_pointer");
+}
+
+/**
+ * Moves the cursor to the next document, the driver fetches a new batch when the current one is exhausted
+ */
+PHP_METHOD(Phalcon_Mvc_Collection_Resultset, next){
+
+	zval *cursor;
+
+	PHALCON_MM_GROW();
+
+	PHALCON_OBS_VAR(cursor);
+	phalcon_read_property(&cursor, this_ptr, SL("_cursor"), PH_NOISY_CC);
+	PHALCON_CALL_METHOD_NORETURN(cursor, "next");
+
+	phalcon_property_incr(this_ptr, SL("_pointer") TSRMLS_CC);
+	phalcon_update_property_null(this_ptr, SL("_activeRow") TSRMLS_CC);
+
+	PHALCON_MM_RESTORE();
+}
+
+/**
+ * Counts the documents matched by the cursor taking the 'limit' and 'skip' parameters into account.
+ * The count is requested to the server only once
+ *
+ * @return int
+ */
+PHP_METHOD(Phalcon_Mvc_Collection_Resultset, count){
+
+	zval *count = NULL, *cursor, *found_only;
+
+	PHALCON_MM_GROW();
+
+	PHALCON_OBS_VAR(count);
+	phalcon_read_property(&count, this_ptr, SL("_count"), PH_NOISY_CC);
+	if (Z_TYPE_P(count) != IS_NULL) {
+		RETURN_CCTOR(count);
+	}
+
+	PHALCON_OBS_VAR(cursor);
+	phalcon_read_property(&cursor, this_ptr, SL("_cursor"), PH_NOISY_CC);
+
+	PHALCON_INIT_VAR(found_only);
+	ZVAL_BOOL(found_only, 1);
+
+	PHALCON_INIT_NVAR(count);
+	PHALCON_CALL_METHOD_PARAMS_1(count, cursor, "count", found_only);
+	phalcon_update_property_zval(this_ptr, SL("_count"), count TSRMLS_CC);
+
+	RETURN_CCTOR(count);
+}
+
+/**
+ * Returns the internal MongoCursor
+ *
+ * @return \MongoCursor
+ */
+PHP_METHOD(Phalcon_Mvc_Collection_Resultset, getCursor){
+
+
+	RETURN_MEMBER(this_ptr, "_cursor");
+}
+
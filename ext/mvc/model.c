@@ -991,6 +991,12 @@ PHP_METHOD(Phalcon_Mvc_Model, cloneResult){
  * foreach ($robots as $robot) {
  *	   echo $robot->name, "\n";
  * }
+ *
+ * //Get the robots and their parts using only two queries
+ * $robots = Robots::find(array("type='virtual'", "with" => "robotsParts"));
+ * foreach ($robots as $robot) {
+ *	   echo $robot->name, " has ", count($robot->robotsParts), " parts\n";
+ * }
  * </code>
  *
  * @param 	array $parameters
@@ -1110,7 +1116,8 @@ PHP_METHOD(Phalcon_Mvc_Model, findFirst){
 
 	zval *parameters = NULL, *model_name, *params = NULL, *builder;
 	zval *one, *query, *bind_params = NULL, *bind_types = NULL, *cache;
-	zval *unique, *resultset;
+	zval *unique, *resultset, *manager;
+	zval *conditions, *record = NULL, *is_model, *no_replace;
 
 	PHALCON_MM_GROW();
 
@@ -1154,6 +1161,28 @@ PHP_METHOD(Phalcon_Mvc_Model, findFirst){
 	PHALCON_INIT_VAR(query);
 	PHALCON_CALL_METHOD(query, builder, "getquery");
 	
+	PHALCON_OBS_VAR(manager);
+	phalcon_read_property(&manager, query, SL("_manager"), PH_NOISY_CC);
+	
+	/** 
+	 * Records requested by primary key could be already in the identity map
+	 */
+	if (zend_hash_num_elements(Z_ARRVAL_P(params)) == 1) {
+		if (phalcon_array_isset_long(params, 0)) {
+	
+			PHALCON_OBS_VAR(conditions);
+			phalcon_array_fetch_long(&conditions, params, 0, PH_NOISY_CC);
+			if (phalcon_is_numeric(conditions)) {
+	
+				PHALCON_INIT_VAR(record);
+				PHALCON_CALL_METHOD_PARAMS_2(record, manager, "getidentityrecord", model_name, conditions);
+				if (Z_TYPE_P(record) == IS_OBJECT) {
+					RETURN_CCTOR(record);
+				}
+			}
+		}
+	}
+	
 	/** 
 	 * Check for bind parameters
 	 */
@@ -1193,6 +1222,24 @@ PHP_METHOD(Phalcon_Mvc_Model, findFirst){
 	PHALCON_INIT_VAR(resultset);
 	PHALCON_CALL_METHOD_PARAMS_2(resultset, query, "execute", bind_params, bind_types);
 	
+	if (Z_TYPE_P(resultset) == IS_OBJECT) {
+	
+		/** 
+		 * The identity map keeps only one instance per record
+		 */
+		PHALCON_INIT_VAR(is_model);
+		phalcon_instance_of(is_model, resultset, phalcon_mvc_modelinterface_ce TSRMLS_CC);
+		if (PHALCON_IS_TRUE(is_model)) {
+	
+			PHALCON_INIT_VAR(no_replace);
+			ZVAL_BOOL(no_replace, 0);
+	
+			PHALCON_INIT_NVAR(record);
+			PHALCON_CALL_METHOD_PARAMS_2(record, manager, "setidentityrecord", resultset, no_replace);
+			PHALCON_CPY_WRT(resultset, record);
+		}
+	}
+	
 	RETURN_CCTOR(resultset);
 }
 
@@ -1469,6 +1516,9 @@ PHP_METHOD(Phalcon_Mvc_Model, _exists){
 /**
  * Generate a PHQL SELECT statement for an aggregate
  *
+ * Ungrouped and uncached aggregates skip the query builder and the resultsets,
+ * the scalar is fetched directly from the SQL generated by the dialect
+ *
  * @param string $function
  * @param string $alias
  * @param array $parameters
@@ -1478,9 +1528,13 @@ PHP_METHOD(Phalcon_Mvc_Model, _groupResult){
 
 	zval *function, *alias, *parameters, *params = NULL, *group_column = NULL;
 	zval *distinct_column, *columns = NULL, *group_columns;
-	zval *model_name, *builder, *query, *bind_params = NULL;
+	zval *model_name, *builder = NULL, *query = NULL, *bind_params = NULL;
 	zval *bind_types = NULL, *resultset, *cache, *number_rows;
-	zval *first_row, *value;
+	zval *first_row, *value = NULL, *is_simple, *key = NULL, *conditions = NULL;
+	zval *phql, *dependency_injector;
+	HashTable *ah0;
+	HashPosition hp0;
+	zval **hd;
 
 	PHALCON_MM_GROW();
 
@@ -1533,19 +1587,6 @@ PHP_METHOD(Phalcon_Mvc_Model, _groupResult){
 	PHALCON_INIT_VAR(model_name);
 	phalcon_get_called_class(model_name  TSRMLS_CC);
 	
-	/** 
-	 * Builds a query with the passed parameters
-	 */
-	PHALCON_INIT_VAR(builder);
-	object_init_ex(builder, phalcon_mvc_model_query_builder_ce);
-	PHALCON_CALL_METHOD_PARAMS_1_NORETURN(builder, "__construct", params);
-	
-	PHALCON_CALL_METHOD_PARAMS_1_NORETURN(builder, "columns", columns);
-	PHALCON_CALL_METHOD_PARAMS_1_NORETURN(builder, "from", model_name);
-	
-	PHALCON_INIT_VAR(query);
-	PHALCON_CALL_METHOD(query, builder, "getquery");
-	
 	/** 
 	 * Check for bind parameters
 	 */
@@ -1563,38 +1604,140 @@ PHP_METHOD(Phalcon_Mvc_Model, _groupResult){
 	}
 	
 	/** 
-	 * Execute the query
+	 * Grouped and cached aggregates need a full resultset
 	 */
-	PHALCON_INIT_VAR(resultset);
-	PHALCON_CALL_METHOD_PARAMS_2(resultset, query, "execute", bind_params, bind_types);
+	if (phalcon_array_isset_string(params, SS("group")) || phalcon_array_isset_string(params, SS("cache"))) {
 	
-	/** 
-	 * Pass the cache options to the query
-	 */
-	if (phalcon_array_isset_string(params, SS("cache"))) {
-		PHALCON_OBS_VAR(cache);
-		phalcon_array_fetch_string(&cache, params, SL("cache"), PH_NOISY_CC);
-		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(query, "cache", cache);
+		PHALCON_INIT_VAR(builder);
+		object_init_ex(builder, phalcon_mvc_model_query_builder_ce);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(builder, "__construct", params);
+	
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(builder, "columns", columns);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(builder, "from", model_name);
+	
+		PHALCON_INIT_VAR(query);
+		PHALCON_CALL_METHOD(query, builder, "getquery");
+	
+		/** 
+		 * Pass the cache options to the query
+		 */
+		if (phalcon_array_isset_string(params, SS("cache"))) {
+			PHALCON_OBS_VAR(cache);
+			phalcon_array_fetch_string(&cache, params, SL("cache"), PH_NOISY_CC);
+			PHALCON_CALL_METHOD_PARAMS_1_NORETURN(query, "cache", cache);
+		}
+	
+		/** 
+		 * Execute the query
+		 */
+		PHALCON_INIT_VAR(resultset);
+		PHALCON_CALL_METHOD_PARAMS_2(resultset, query, "execute", bind_params, bind_types);
+	
+		/** 
+		 * Return the full resultset if the query is grouped
+		 */
+		if (phalcon_array_isset_string(params, SS("group"))) {
+			RETURN_CCTOR(resultset);
+		}
+	
+		/** 
+		 * Return only the value in the first result
+		 */
+		PHALCON_INIT_VAR(number_rows);
+		phalcon_fast_count(number_rows, resultset TSRMLS_CC);
+	
+		PHALCON_INIT_VAR(first_row);
+		PHALCON_CALL_METHOD(first_row, resultset, "getfirst");
+	
+		PHALCON_OBS_VAR(value);
+		phalcon_read_property_zval(&value, first_row, alias, PH_NOISY_CC);
+	
+		RETURN_CCTOR(value);
 	}
 	
 	/** 
-	 * Return the full resultset if the query is grouped
+	 * The PHQL is built here if the parameters only have conditions and bindings
 	 */
-	if (phalcon_array_isset_string(params, SS("group"))) {
-		RETURN_CCTOR(resultset);
+	PHALCON_INIT_VAR(is_simple);
+	ZVAL_BOOL(is_simple, 1);
+	
+	PHALCON_INIT_VAR(conditions);
+	
+	if (!phalcon_is_iterable(params, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_KEY(key, ah0, hp0);
+		PHALCON_GET_FOREACH_VALUE(value);
+	
+		if (Z_TYPE_P(key) == IS_LONG) {
+			if (PHALCON_IS_LONG(key, 0)) {
+				PHALCON_CPY_WRT(conditions, value);
+			} else {
+				ZVAL_BOOL(is_simple, 0);
+			}
+		} else {
+			if (PHALCON_IS_STRING(key, "conditions")) {
+				if (!phalcon_array_isset_long(params, 0)) {
+					PHALCON_CPY_WRT(conditions, value);
+				}
+			} else {
+				if (!PHALCON_IS_STRING(key, "bind")) {
+					if (!PHALCON_IS_STRING(key, "bindTypes")) {
+						if (!PHALCON_IS_STRING(key, "column")) {
+							if (!PHALCON_IS_STRING(key, "distinct")) {
+								ZVAL_BOOL(is_simple, 0);
+							}
+						}
+					}
+				}
+			}
+		}
+	
+		zend_hash_move_forward_ex(ah0, &hp0);
 	}
 	
 	/** 
-	 * Return only the value in the first result
+	 * Numeric conditions are resolved to the primary key by the builder
 	 */
-	PHALCON_INIT_VAR(number_rows);
-	phalcon_fast_count(number_rows, resultset TSRMLS_CC);
+	if (phalcon_is_numeric(conditions)) {
+		ZVAL_BOOL(is_simple, 0);
+	}
 	
-	PHALCON_INIT_VAR(first_row);
-	PHALCON_CALL_METHOD(first_row, resultset, "getfirst");
+	if (PHALCON_IS_TRUE(is_simple)) {
 	
-	PHALCON_OBS_VAR(value);
-	phalcon_read_property_zval(&value, first_row, alias, PH_NOISY_CC);
+		PHALCON_INIT_VAR(phql);
+		PHALCON_CONCAT_SVSVS(phql, "SELECT ", columns, " FROM [", model_name, "]");
+		if (zend_is_true(conditions)) {
+			PHALCON_SCONCAT_SV(phql, " WHERE ", conditions);
+		}
+	
+		PHALCON_INIT_VAR(dependency_injector);
+		PHALCON_CALL_STATIC(dependency_injector, "phalcon\\di", "getdefault");
+	
+		PHALCON_INIT_NVAR(query);
+		object_init_ex(query, phalcon_mvc_model_query_ce);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(query, "__construct", phql);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(query, "setdi", dependency_injector);
+	} else {
+		PHALCON_INIT_NVAR(builder);
+		object_init_ex(builder, phalcon_mvc_model_query_builder_ce);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(builder, "__construct", params);
+	
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(builder, "columns", columns);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(builder, "from", model_name);
+	
+		PHALCON_INIT_NVAR(query);
+		PHALCON_CALL_METHOD(query, builder, "getquery");
+	}
+	
+	/** 
+	 * Fetch the aggregate without building a resultset
+	 */
+	PHALCON_INIT_NVAR(value);
+	PHALCON_CALL_METHOD_PARAMS_2(value, query, "getsinglescalar", bind_params, bind_types);
 	
 	RETURN_CCTOR(value);
 }
@@ -3653,7 +3796,7 @@ PHP_METHOD(Phalcon_Mvc_Model, save){
 	zval *attribute = NULL, *value = NULL, *possible_setter = NULL, *write_connection;
 	zval *related, *status = NULL, *schema, *source, *table = NULL, *read_connection;
 	zval *exists, *empty_array, *identity_field;
-	zval *success = NULL;
+	zval *success = NULL, *models_manager;
 	zval *r0 = NULL;
 	HashTable *ah0;
 	HashPosition hp0;
@@ -3838,6 +3981,20 @@ PHP_METHOD(Phalcon_Mvc_Model, save){
 		PHALCON_CPY_WRT(success, r0);
 	}
 	
+	/** 
+	 * Saved records replace any other instance in the identity map, invalidate the cached queries
+	 * and pin the next reads of the connection service to the primary
+	 */
+	if (zend_is_true(success)) {
+		PHALCON_OBS_VAR(models_manager);
+		phalcon_read_property(&models_manager, this_ptr, SL("_modelsManager"), PH_NOISY_CC);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(models_manager, "setidentityrecord", this_ptr);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(models_manager, "invalidatequerycache", this_ptr);
+		if (phalcon_method_exists_ex(models_manager, SS("pinreads") TSRMLS_CC) == SUCCESS) {
+			PHALCON_CALL_METHOD_PARAMS_1_NORETURN(models_manager, "pinreads", this_ptr);
+		}
+	}
+	
 	if (Z_TYPE_P(related) == IS_ARRAY) { 
 	
 		/** 
@@ -4241,7 +4398,7 @@ PHP_METHOD(Phalcon_Mvc_Model, delete){
 	zval *attribute_field = NULL, *value = NULL, *escaped_field = NULL;
 	zval *primary_condition = NULL, *bind_type = NULL, *delete_conditions;
 	zval *event_name = NULL, *status, *skipped, *schema, *source;
-	zval *table = NULL, *success;
+	zval *table = NULL, *success, *models_manager;
 	HashTable *ah0;
 	HashPosition hp0;
 	zval **hd;
@@ -4418,6 +4575,20 @@ PHP_METHOD(Phalcon_Mvc_Model, delete){
 		}
 	}
 	
+	/** 
+	 * Deleted records are removed from the identity map, invalidate the cached queries
+	 * and pin the next reads of the connection service to the primary
+	 */
+	if (zend_is_true(success)) {
+		PHALCON_OBS_VAR(models_manager);
+		phalcon_read_property(&models_manager, this_ptr, SL("_modelsManager"), PH_NOISY_CC);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(models_manager, "removeidentityrecord", this_ptr);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(models_manager, "invalidatequerycache", this_ptr);
+		if (phalcon_method_exists_ex(models_manager, SS("pinreads") TSRMLS_CC) == SUCCESS) {
+			PHALCON_CALL_METHOD_PARAMS_1_NORETURN(models_manager, "pinreads", this_ptr);
+		}
+	}
+	
 	/** 
 	 * Force perform the record existence checking again
 	 */
@@ -4448,6 +4619,7 @@ PHP_METHOD(Phalcon_Mvc_Model, refresh){
 	zval *unique_params, *unique_types, *attributes;
 	zval *fields, *attribute = NULL, *field_item = NULL, *escaped_table;
 	zval *select, *dialect, *sql, *fetch_type, *row, *column_map;
+	zval *models_manager;
 	HashTable *ah0;
 	HashPosition hp0;
 	zval **hd;
@@ -4569,6 +4741,13 @@ PHP_METHOD(Phalcon_Mvc_Model, refresh){
 	 */
 	if (Z_TYPE_P(row) == IS_ARRAY) { 
 		PHALCON_CALL_METHOD_PARAMS_2_NORETURN(this_ptr, "assign", row, column_map);
+	
+		/** 
+		 * The refreshed instance replaces any other in the identity map
+		 */
+		PHALCON_OBS_VAR(models_manager);
+		phalcon_read_property(&models_manager, this_ptr, SL("_modelsManager"), PH_NOISY_CC);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(models_manager, "setidentityrecord", this_ptr);
 	}
 	
 	PHALCON_MM_RESTORE();
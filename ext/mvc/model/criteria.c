@@ -438,6 +438,30 @@ PHP_METHOD(Phalcon_Mvc_Model_Criteria, sharedLock){
 	RETURN_THIS();
 }
 
+/**
+ * Adds the relations to be loaded in advance with the records of the criteria
+ *
+ *<code>
+ * $robots = Robots::query()->where("type = 'mechanical'")->with("robotsParts")->execute();
+ *</code>
+ *
+ * @param string|array $relations
+ * @return Phalcon\Mvc\Model\Criteria
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Criteria, with){
+
+	zval *relations;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &relations) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	phalcon_update_property_array_string(this_ptr, SL("_params"), SS("with"), relations TSRMLS_CC);
+	RETURN_THIS();
+}
+
 /**
  * Returns the conditions parameter in the criteria
  *
@@ -28,6 +28,7 @@
 #include "Zend/zend_operators.h"
 #include "Zend/zend_exceptions.h"
 #include "Zend/zend_interfaces.h"
+#include "ext/standard/php_rand.h"
 
 #include "kernel/main.h"
 #include "kernel/memory.h"
@@ -87,8 +88,24 @@ PHALCON_INIT_CLASS(Phalcon_Mvc_Model_Manager){
 	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_lastInitialized"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_lastQuery"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_reusable"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_eagerRecords"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_keepSnapshots"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_dynamicUpdate"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_useIdentityMap"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_identityMap"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_long(phalcon_mvc_model_manager_ce, SL("_identityHits"), 0, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_long(phalcon_mvc_model_manager_ce, SL("_identityMisses"), 0, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_queryCacheService"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_queryCacheLifetime"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_queryCacheVersions"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_readReplicas"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_replicaPolicies"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_replicaCursors"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_replicaCurrentWeights"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_replicaLoad"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_unhealthyReplicas"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_long(phalcon_mvc_model_manager_ce, SL("_replicaRetryInterval"), 30, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_model_manager_ce, SL("_pinnedServices"), ZEND_ACC_PROTECTED TSRMLS_CC);
 
 	zend_class_implements(phalcon_mvc_model_manager_ce TSRMLS_CC, 3, phalcon_mvc_model_managerinterface_ce, phalcon_di_injectionawareinterface_ce, phalcon_events_eventsawareinterface_ce);
 
@@ -624,6 +641,228 @@ PHP_METHOD(Phalcon_Mvc_Model_Manager, setReadConnectionService){
 	PHALCON_MM_RESTORE();
 }
 
+/**
+ * Reads a counter stored in an array property
+ */
+static long phalcon_mvc_model_manager_get_counter(zval *object, char *property, unsigned int property_length, zval *key TSRMLS_DC){
+
+	zval *counters, **counter;
+	long value = 0;
+
+	counters = zend_read_property(Z_OBJCE_P(object), object, property, property_length, 1 TSRMLS_CC);
+	if (Z_TYPE_P(counters) == IS_ARRAY && Z_TYPE_P(key) == IS_STRING) {
+		if (zend_hash_find(Z_ARRVAL_P(counters), Z_STRVAL_P(key), Z_STRLEN_P(key) + 1, (void**) &counter) == SUCCESS) {
+			value = phalcon_get_intval(*counter);
+		}
+	}
+
+	return value;
+}
+
+/**
+ * Updates a counter stored in an array property
+ */
+static void phalcon_mvc_model_manager_set_counter(zval *object, char *property, unsigned int property_length, zval *key, long value TSRMLS_DC){
+
+	zval *counter;
+
+	MAKE_STD_ZVAL(counter);
+	ZVAL_LONG(counter, value);
+	phalcon_update_property_array(object, property, property_length, key, counter TSRMLS_CC);
+	zval_ptr_dtor(&counter);
+}
+
+/**
+ * Seeds the version of a model in the query cache. The timestamp keeps a version created
+ * after an eviction greater than the evicted one, the random part keeps two processes
+ * seeding the same model in the same second from sharing a version
+ */
+static void phalcon_mvc_model_manager_seed_version(zval *version TSRMLS_DC){
+
+	long random;
+
+	if (!BG(mt_rand_is_seeded)) {
+		php_mt_srand(GENERATE_SEED() TSRMLS_CC);
+	}
+
+	random = (long) (php_mt_rand(TSRMLS_C) >> 1);
+
+#if SIZEOF_LONG > 4
+	ZVAL_LONG(version, (long) time(NULL) * 1000000 + random % 1000000);
+#else
+	ZVAL_LONG(version, ((long) time(NULL) & ~0xFFFFL) | (random & 0xFFFF));
+#endif
+}
+
+/**
+ * Requests a shared connection service from the DI, connection errors are reported
+ * as FAILURE instead of being thrown
+ */
+static int phalcon_mvc_model_manager_try_connection(zval *connection, zval *dependency_injector, zval *service TSRMLS_DC){
+
+	zval *method, *params[1];
+	int status;
+
+	MAKE_STD_ZVAL(method);
+	ZVAL_STRING(method, "getShared", 1);
+
+	params[0] = service;
+	status = call_user_function(NULL, &dependency_injector, method, connection, 1, params TSRMLS_CC);
+	zval_ptr_dtor(&method);
+
+	if (EG(exception)) {
+		zend_clear_exception(TSRMLS_C);
+		status = FAILURE;
+	}
+
+	if (status == FAILURE || Z_TYPE_P(connection) != IS_OBJECT) {
+		return FAILURE;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * Chooses a healthy read replica of a primary connection service according to its policy.
+ * Replicas that fail to connect are marked as unhealthy and the next one is tried
+ */
+static int phalcon_mvc_model_manager_select_replica(zval *connection, zval *object, zval *dependency_injector, zval *primary TSRMLS_DC){
+
+	zval *replicas_config, **replicas, *policies, **policy_zv, *unhealthy, **since;
+	zval **candidates, **weights_zv;
+	long *weights, retry, cursor, best_load, load, current, total, best_current;
+	int number, i, pick, status = FAILURE;
+	char *policy = "round-robin";
+	HashPosition hp;
+	time_t now = time(NULL);
+
+	replicas_config = zend_read_property(Z_OBJCE_P(object), object, SL("_readReplicas"), 1 TSRMLS_CC);
+	if (Z_TYPE_P(replicas_config) != IS_ARRAY || Z_TYPE_P(primary) != IS_STRING) {
+		return FAILURE;
+	}
+
+	if (zend_hash_find(Z_ARRVAL_P(replicas_config), Z_STRVAL_P(primary), Z_STRLEN_P(primary) + 1, (void**) &replicas) != SUCCESS) {
+		return FAILURE;
+	}
+
+	policies = zend_read_property(Z_OBJCE_P(object), object, SL("_replicaPolicies"), 1 TSRMLS_CC);
+	if (Z_TYPE_P(policies) == IS_ARRAY) {
+		if (zend_hash_find(Z_ARRVAL_P(policies), Z_STRVAL_P(primary), Z_STRLEN_P(primary) + 1, (void**) &policy_zv) == SUCCESS) {
+			if (Z_TYPE_PP(policy_zv) == IS_STRING) {
+				policy = Z_STRVAL_PP(policy_zv);
+			}
+		}
+	}
+
+	unhealthy = zend_read_property(Z_OBJCE_P(object), object, SL("_unhealthyReplicas"), 1 TSRMLS_CC);
+	retry = phalcon_get_intval(zend_read_property(Z_OBJCE_P(object), object, SL("_replicaRetryInterval"), 1 TSRMLS_CC));
+
+	/**
+	 * Collect the replicas that are healthy or whose retry interval has expired
+	 */
+	number = 0;
+	candidates = emalloc(sizeof(zval*) * (zend_hash_num_elements(Z_ARRVAL_PP(replicas)) + 1));
+	weights = emalloc(sizeof(long) * (zend_hash_num_elements(Z_ARRVAL_PP(replicas)) + 1));
+
+	zend_hash_internal_pointer_reset_ex(Z_ARRVAL_PP(replicas), &hp);
+	while (zend_hash_get_current_data_ex(Z_ARRVAL_PP(replicas), (void**) &weights_zv, &hp) == SUCCESS) {
+
+		zval *name;
+		char *key;
+		uint key_length;
+		ulong num_key;
+
+		if (zend_hash_get_current_key_ex(Z_ARRVAL_PP(replicas), &key, &key_length, &num_key, 0, &hp) == HASH_KEY_IS_STRING) {
+			if (Z_TYPE_P(unhealthy) == IS_ARRAY) {
+				if (zend_hash_find(Z_ARRVAL_P(unhealthy), key, key_length, (void**) &since) == SUCCESS) {
+					if ((long) now - phalcon_get_intval(*since) < retry) {
+						zend_hash_move_forward_ex(Z_ARRVAL_PP(replicas), &hp);
+						continue;
+					}
+				}
+			}
+
+			MAKE_STD_ZVAL(name);
+			ZVAL_STRINGL(name, key, key_length - 1, 1);
+			candidates[number] = name;
+			weights[number] = phalcon_get_intval(*weights_zv);
+			number++;
+		}
+
+		zend_hash_move_forward_ex(Z_ARRVAL_PP(replicas), &hp);
+	}
+
+	while (number > 0) {
+
+		pick = 0;
+
+		if (!strcmp(policy, "least-outstanding")) {
+			/**
+			 * The replica that has served less reads
+			 */
+			best_load = -1;
+			for (i = 0; i < number; i++) {
+				load = phalcon_mvc_model_manager_get_counter(object, SL("_replicaLoad"), candidates[i] TSRMLS_CC);
+				if (best_load < 0 || load < best_load) {
+					best_load = load;
+					pick = i;
+				}
+			}
+		} else {
+			if (!strcmp(policy, "weighted")) {
+				/**
+				 * Smooth weighted round-robin
+				 */
+				total = 0;
+				best_current = 0;
+				for (i = 0; i < number; i++) {
+					current = phalcon_mvc_model_manager_get_counter(object, SL("_replicaCurrentWeights"), candidates[i] TSRMLS_CC) + weights[i];
+					phalcon_mvc_model_manager_set_counter(object, SL("_replicaCurrentWeights"), candidates[i], current TSRMLS_CC);
+					total += weights[i];
+					if (i == 0 || current > best_current) {
+						best_current = current;
+						pick = i;
+					}
+				}
+				phalcon_mvc_model_manager_set_counter(object, SL("_replicaCurrentWeights"), candidates[pick], best_current - total TSRMLS_CC);
+			} else {
+				cursor = phalcon_mvc_model_manager_get_counter(object, SL("_replicaCursors"), primary TSRMLS_CC);
+				pick = (int) (cursor % number);
+				phalcon_mvc_model_manager_set_counter(object, SL("_replicaCursors"), primary, cursor + 1 TSRMLS_CC);
+			}
+		}
+
+		if (phalcon_mvc_model_manager_try_connection(connection, dependency_injector, candidates[pick] TSRMLS_CC) == SUCCESS) {
+			load = phalcon_mvc_model_manager_get_counter(object, SL("_replicaLoad"), candidates[pick] TSRMLS_CC);
+			phalcon_mvc_model_manager_set_counter(object, SL("_replicaLoad"), candidates[pick], load + 1 TSRMLS_CC);
+			status = SUCCESS;
+			break;
+		}
+
+		/**
+		 * The replica can't be reached, it's excluded until the retry interval expires
+		 */
+		zval_dtor(connection);
+		ZVAL_NULL(connection);
+		phalcon_mvc_model_manager_set_counter(object, SL("_unhealthyReplicas"), candidates[pick], (long) now TSRMLS_CC);
+
+		zval_ptr_dtor(&candidates[pick]);
+		for (i = pick; i < number - 1; i++) {
+			candidates[i] = candidates[i + 1];
+			weights[i] = weights[i + 1];
+		}
+		number--;
+	}
+
+	for (i = 0; i < number; i++) {
+		zval_ptr_dtor(&candidates[i]);
+	}
+	efree(candidates);
+	efree(weights);
+
+	return status;
+}
+
 /**
  * Returns the connection to write data related to a model
  *
@@ -690,7 +929,8 @@ PHP_METHOD(Phalcon_Mvc_Model_Manager, getWriteConnection){
 PHP_METHOD(Phalcon_Mvc_Model_Manager, getReadConnection){
 
 	zval *model, *service = NULL, *connection_services;
-	zval *entity_name, *dependency_injector, *connection;
+	zval *entity_name, *dependency_injector, *pinned_services;
+	zval *replica, *connection;
 
 	PHALCON_MM_GROW();
 
@@ -724,6 +964,18 @@ PHP_METHOD(Phalcon_Mvc_Model_Manager, getReadConnection){
 		return;
 	}
 	
+	/** 
+	 * Balance the reads between the replicas of the service unless they were pinned to the primary
+	 */
+	PHALCON_OBS_VAR(pinned_services);
+	phalcon_read_property(&pinned_services, this_ptr, SL("_pinnedServices"), PH_NOISY_CC);
+	if (!phalcon_array_isset(pinned_services, service)) {
+		PHALCON_INIT_VAR(replica);
+		if (phalcon_mvc_model_manager_select_replica(replica, this_ptr, dependency_injector, service TSRMLS_CC) == SUCCESS) {
+			RETURN_CCTOR(replica);
+		}
+	}
+	
 	/** 
 	 * Request the connection service from the DI
 	 */
@@ -738,6 +990,180 @@ PHP_METHOD(Phalcon_Mvc_Model_Manager, getReadConnection){
 	RETURN_CCTOR(connection);
 }
 
+/**
+ * Sets the read replicas of a connection service. Reads of the models using that service are
+ * balanced between the replicas according to a policy: 'round-robin', 'least-outstanding'
+ * (the replica that has served less reads) or 'weighted'
+ *
+ *<code>
+ * $modelsManager->setReadReplicas(array('dbReplica1', 'dbReplica2'));
+ * $modelsManager->setReadReplicas(array('dbReplica1' => 3, 'dbReplica2' => 1), 'weighted');
+ *</code>
+ *
+ * @param array $replicas
+ * @param string $policy
+ * @param string $connectionService
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, setReadReplicas){
+
+	zval *replicas, *policy = NULL, *connection_service = NULL;
+	zval *normalized, *service = NULL, *weight = NULL, *one;
+	HashTable *ah0;
+	HashPosition hp0;
+	zval **hd;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|zz", &replicas, &policy, &connection_service) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!policy) {
+		PHALCON_INIT_VAR(policy);
+		ZVAL_STRING(policy, "round-robin", 1);
+	}
+	
+	if (!connection_service) {
+		PHALCON_INIT_VAR(connection_service);
+		ZVAL_STRING(connection_service, "db", 1);
+	}
+	
+	if (Z_TYPE_P(replicas) != IS_ARRAY) { 
+		PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_model_exception_ce, "The replicas must be an array");
+		return;
+	}
+	
+	if (!PHALCON_IS_STRING(policy, "round-robin")) {
+		if (!PHALCON_IS_STRING(policy, "least-outstanding")) {
+			if (!PHALCON_IS_STRING(policy, "weighted")) {
+				PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_model_exception_ce, "Unknown replica selection policy");
+				return;
+			}
+		}
+	}
+	
+	/** 
+	 * Replicas are stored as service => weight
+	 */
+	PHALCON_INIT_VAR(one);
+	ZVAL_LONG(one, 1);
+	
+	PHALCON_INIT_VAR(normalized);
+	array_init(normalized);
+	
+	if (!phalcon_is_iterable(replicas, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_KEY(service, ah0, hp0);
+		PHALCON_GET_FOREACH_VALUE(weight);
+	
+		if (Z_TYPE_P(service) == IS_LONG) {
+			phalcon_array_update_zval(&normalized, weight, &one, PH_COPY | PH_SEPARATE TSRMLS_CC);
+		} else {
+			if (phalcon_get_intval(weight) > 0) {
+				phalcon_array_update_zval(&normalized, service, &weight, PH_COPY | PH_SEPARATE TSRMLS_CC);
+			}
+		}
+	
+		zend_hash_move_forward_ex(ah0, &hp0);
+	}
+	
+	phalcon_update_property_array(this_ptr, SL("_readReplicas"), connection_service, normalized TSRMLS_CC);
+	phalcon_update_property_array(this_ptr, SL("_replicaPolicies"), connection_service, policy TSRMLS_CC);
+	
+	PHALCON_MM_RESTORE();
+}
+
+/**
+ * Sets the number of seconds an unhealthy replica is excluded before trying it again
+ *
+ * @param int $seconds
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, setReplicaRetryInterval){
+
+	zval *seconds;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &seconds) == FAILURE) {
+		RETURN_NULL();
+	}
+
+	phalcon_update_property_zval(this_ptr, SL("_replicaRetryInterval"), seconds TSRMLS_CC);
+	
+}
+
+/**
+ * Marks a replica as unhealthy, it will not be used until the retry interval expires
+ *
+ * @param string $connectionService
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, markReplicaUnhealthy){
+
+	zval *connection_service, *now;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &connection_service) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	PHALCON_INIT_VAR(now);
+	ZVAL_LONG(now, (long) time(NULL));
+	phalcon_update_property_array(this_ptr, SL("_unhealthyReplicas"), connection_service, now TSRMLS_CC);
+	
+	PHALCON_MM_RESTORE();
+}
+
+/**
+ * Returns the replicas marked as unhealthy with the time they failed
+ *
+ * @return array
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, getUnhealthyReplicas){
+
+
+	RETURN_MEMBER(this_ptr, "_unhealthyReplicas");
+}
+
+/**
+ * Pins the reads of a model's read connection service to the primary, this is done
+ * automatically after a successful save or delete so the next reads see the written data.
+ * The pin applies to the whole connection service: every model read through that
+ * service uses the primary until releasePinnedReads() is called
+ *
+ * @param Phalcon\Mvc\ModelInterface $model
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, pinReads){
+
+	zval *model, *service, *pinned;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &model) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	PHALCON_INIT_VAR(service);
+	PHALCON_CALL_METHOD_PARAMS_1(service, this_ptr, "getreadconnectionservice", model);
+	PHALCON_INIT_VAR(pinned);
+	ZVAL_BOOL(pinned, 1);
+	phalcon_update_property_array(this_ptr, SL("_pinnedServices"), service, pinned TSRMLS_CC);
+	
+	PHALCON_MM_RESTORE();
+}
+
+/**
+ * Releases the reads pinned to the primary connections
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, releasePinnedReads){
+
+
+	phalcon_update_property_null(this_ptr, SL("_pinnedServices") TSRMLS_CC);
+	
+}
+
 /**
  * Returns the connection service name used to read data related to a model
  *
@@ -1774,8 +2200,11 @@ PHP_METHOD(Phalcon_Mvc_Model_Manager, getRelationRecords){
 	zval *position = NULL, *join_conditions, *has_through;
 	zval *dependency_injector, *find_params, *find_arguments = NULL;
 	zval *arguments, *referenced_model, *type, *retrieve_method = NULL;
-	zval *reusable, *unique_key, *records = NULL, *referenced_entity;
-	zval *call_object;
+	zval *reusable, *unique_key, *records = NULL, *referenced_entity = NULL;
+	zval *call_object, *eager_prefix, *eager_key, *use_identity_map;
+	zval *meta_data, *primary_keys, *number_keys, *primary_key;
+	zval *column_map, *attribute_field = NULL, *eager_entity, *eager_records;
+	zval *eager_entity_records;
 	HashTable *ah0;
 	HashPosition hp0;
 	zval **hd;
@@ -1963,6 +2392,79 @@ PHP_METHOD(Phalcon_Mvc_Model_Manager, getRelationRecords){
 		PHALCON_CPY_WRT(retrieve_method, method);
 	}
 	
+	/** 
+	 * Records loaded in advance by eagerLoad are used when there are no extra parameters,
+	 * until the referenced model is written
+	 */
+	if (Z_TYPE_P(method) == IS_NULL && Z_TYPE_P(parameters) == IS_NULL && Z_TYPE_P(fields) != IS_ARRAY) {
+	
+		PHALCON_INIT_VAR(eager_prefix);
+		PHALCON_CONCAT_SVSVSV(eager_prefix, "eager$", referenced_model, "$", referenced_field, "$", type);
+	
+		PHALCON_INIT_VAR(eager_key);
+		PHALCON_CONCAT_VSV(eager_key, eager_prefix, "$", value);
+	
+		PHALCON_INIT_VAR(eager_entity);
+		phalcon_fast_strtolower(eager_entity, referenced_model);
+	
+		PHALCON_OBS_VAR(eager_records);
+		phalcon_read_property(&eager_records, this_ptr, SL("_eagerRecords"), PH_NOISY_CC);
+		if (phalcon_array_isset(eager_records, eager_entity)) {
+	
+			PHALCON_OBS_VAR(eager_entity_records);
+			phalcon_array_fetch(&eager_entity_records, eager_records, eager_entity, PH_NOISY_CC);
+			if (phalcon_array_isset(eager_entity_records, eager_key)) {
+				PHALCON_OBS_NVAR(records);
+				phalcon_array_fetch(&records, eager_entity_records, eager_key, PH_NOISY_CC);
+				RETURN_CCTOR(records);
+			}
+		}
+	}
+	
+	/** 
+	 * Records referenced by their primary key could be already in the identity map
+	 */
+	PHALCON_OBS_VAR(use_identity_map);
+	phalcon_read_property(&use_identity_map, this_ptr, SL("_useIdentityMap"), PH_NOISY_CC);
+	if (zend_is_true(use_identity_map) && Z_TYPE_P(parameters) == IS_NULL && Z_TYPE_P(fields) != IS_ARRAY) {
+		if (PHALCON_IS_STRING(retrieve_method, "findFirst")) {
+	
+			PHALCON_INIT_VAR(referenced_entity);
+			PHALCON_CALL_METHOD_PARAMS_1(referenced_entity, this_ptr, "load", referenced_model);
+	
+			PHALCON_INIT_VAR(meta_data);
+			PHALCON_CALL_METHOD(meta_data, referenced_entity, "getmodelsmetadata");
+	
+			PHALCON_INIT_VAR(primary_keys);
+			PHALCON_CALL_METHOD_PARAMS_1(primary_keys, meta_data, "getprimarykeyattributes", referenced_entity);
+	
+			PHALCON_INIT_VAR(number_keys);
+			phalcon_fast_count(number_keys, primary_keys TSRMLS_CC);
+			if (PHALCON_IS_LONG(number_keys, 1)) {
+	
+				PHALCON_OBS_VAR(primary_key);
+				phalcon_array_fetch_long(&primary_key, primary_keys, 0, PH_NOISY_CC);
+	
+				PHALCON_INIT_VAR(column_map);
+				PHALCON_CALL_METHOD_PARAMS_1(column_map, meta_data, "getcolumnmap", referenced_entity);
+				if (Z_TYPE_P(column_map) == IS_ARRAY && phalcon_array_isset(column_map, primary_key)) {
+					PHALCON_OBS_VAR(attribute_field);
+					phalcon_array_fetch(&attribute_field, column_map, primary_key, PH_NOISY_CC);
+				} else {
+					PHALCON_CPY_WRT(attribute_field, primary_key);
+				}
+	
+				if (PHALCON_IS_EQUAL(attribute_field, referenced_field)) {
+					PHALCON_INIT_NVAR(records);
+					PHALCON_CALL_METHOD_PARAMS_2(records, this_ptr, "getidentityrecord", referenced_model, value);
+					if (Z_TYPE_P(records) == IS_OBJECT) {
+						RETURN_CCTOR(records);
+					}
+				}
+			}
+		}
+	}
+	
 	/** 
 	 * Find first results could be reusable
 	 */
@@ -1973,7 +2475,7 @@ PHP_METHOD(Phalcon_Mvc_Model_Manager, getRelationRecords){
 		PHALCON_INIT_VAR(unique_key);
 		phalcon_unique_key(unique_key, referenced_model, arguments TSRMLS_CC);
 	
-		PHALCON_INIT_VAR(records);
+		PHALCON_INIT_NVAR(records);
 		PHALCON_CALL_METHOD_PARAMS_2(records, this_ptr, "getreusablerecords", referenced_model, unique_key);
 		if (Z_TYPE_P(records) == IS_ARRAY || Z_TYPE_P(records) == IS_OBJECT) {
 			RETURN_CCTOR(records);
@@ -1983,7 +2485,7 @@ PHP_METHOD(Phalcon_Mvc_Model_Manager, getRelationRecords){
 	/** 
 	 * Load the referenced model
 	 */
-	PHALCON_INIT_VAR(referenced_entity);
+	PHALCON_INIT_NVAR(referenced_entity);
 	PHALCON_CALL_METHOD_PARAMS_1(referenced_entity, this_ptr, "load", referenced_model);
 	
 	/** 
@@ -2056,7 +2558,7 @@ PHP_METHOD(Phalcon_Mvc_Model_Manager, setReusableRecords){
 }
 
 /**
- * Clears the internal reusable list
+ * Clears the internal reusable list and the records loaded in advance by eagerLoad
  *
  * @param
  */
@@ -2064,9 +2566,891 @@ PHP_METHOD(Phalcon_Mvc_Model_Manager, clearReusableObjects){
 
 
 	phalcon_update_property_null(this_ptr, SL("_reusable") TSRMLS_CC);
+	phalcon_update_property_null(this_ptr, SL("_eagerRecords") TSRMLS_CC);
 	
 }
 
+/**
+ * Loads the records of one or more relations for a set of records in advance, executing
+ * one query per relation instead of one query per record. The loaded records are used
+ * later when the relations are accessed without parameters, until a record of the
+ * referenced model is saved or deleted
+ *
+ *<code>
+ * $robots = Robots::find(array("type = 'mechanical'", "with" => "robotsParts"));
+ * foreach ($robots as $robot) {
+ *	//No additional queries are executed here
+ *	foreach ($robot->robotsParts as $robotPart) {
+ *		echo $robotPart->parts_id, PHP_EOL;
+ *	}
+ * }
+ *</code>
+ *
+ * @param Phalcon\Mvc\Model\ResultsetInterface|array $records
+ * @param string|array $relations
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, eagerLoad){
+
+	zval *records, *relations, *models = NULL, *number_models, *aliases = NULL;
+	zval *first, *model_name, *dependency_injector, *alias = NULL;
+	zval *relation = NULL, *exception_message = NULL, *has_through = NULL;
+	zval *fields = NULL, *referenced_fields = NULL, *referenced_model = NULL;
+	zval *type = NULL, *key_prefix = NULL, *values = NULL, *record = NULL;
+	zval *value = NULL, *placeholders = NULL, *bind_params = NULL, *position = NULL;
+	zval *placeholder = NULL, *join_placeholders = NULL, *conditions = NULL;
+	zval *find_params = NULL, *arguments = NULL, *referenced_entity = NULL;
+	zval *call_object = NULL, *resultset = NULL, *rows = NULL;
+	zval *keep_snapshots = NULL, *grouped = NULL, *row = NULL, *group = NULL;
+	zval *unique_key = NULL, *entity_name = NULL, *eager_records = NULL;
+	zval *entity_records = NULL, *related = NULL, *identity_record = NULL;
+	zval *null_value, *dirty_state, *no_result;
+	HashTable *ah0, *ah1, *ah2, *ah3;
+	HashPosition hp0, hp1, hp2, hp3;
+	zval **hd;
+	long number_placeholders;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "zz", &records, &relations) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	/** 
+	 * Resultsets are traversed once to obtain the values of the relation fields
+	 */
+	if (Z_TYPE_P(records) == IS_OBJECT) {
+		PHALCON_INIT_VAR(models);
+		PHALCON_CALL_FUNC_PARAMS_1(models, "iterator_to_array", records);
+	} else {
+		if (Z_TYPE_P(records) != IS_ARRAY) { 
+			PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_model_exception_ce, "Records to eager load must be a resultset or an array");
+			return;
+		}
+		PHALCON_INIT_NVAR(models);
+		PHALCON_CALL_FUNC_PARAMS_1(models, "array_values", records);
+	}
+
+	PHALCON_INIT_VAR(number_models);
+	phalcon_fast_count(number_models, models TSRMLS_CC);
+	if (!zend_is_true(number_models)) {
+		RETURN_MM_NULL();
+	}
+
+	if (Z_TYPE_P(relations) == IS_ARRAY) { 
+		PHALCON_CPY_WRT(aliases, relations);
+	} else {
+		PHALCON_INIT_NVAR(aliases);
+		array_init_size(aliases, 1);
+		phalcon_array_append(&aliases, relations, PH_SEPARATE TSRMLS_CC);
+	}
+
+	PHALCON_OBS_VAR(first);
+	phalcon_array_fetch_long(&first, models, 0, PH_NOISY_CC);
+
+	PHALCON_INIT_VAR(model_name);
+	phalcon_get_class(model_name, first, 0 TSRMLS_CC);
+
+	PHALCON_INIT_VAR(dependency_injector);
+	PHALCON_CALL_METHOD(dependency_injector, first, "getdi");
+
+	PHALCON_INIT_VAR(null_value);
+
+	PHALCON_INIT_VAR(dirty_state);
+	ZVAL_LONG(dirty_state, 0);
+
+	PHALCON_INIT_VAR(no_result);
+	ZVAL_BOOL(no_result, 0);
+
+	if (!phalcon_is_iterable(aliases, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+
+		PHALCON_GET_FOREACH_VALUE(alias);
+
+		PHALCON_INIT_NVAR(relation);
+		PHALCON_CALL_METHOD_PARAMS_2(relation, this_ptr, "getrelationbyalias", model_name, alias);
+		if (Z_TYPE_P(relation) != IS_OBJECT) {
+			PHALCON_INIT_NVAR(exception_message);
+			PHALCON_CONCAT_SVSVS(exception_message, "There is no defined relations for the model \"", model_name, "\" using alias \"", alias, "\"");
+			PHALCON_THROW_EXCEPTION_ZVAL(phalcon_mvc_model_exception_ce, exception_message);
+			return;
+		}
+
+		/** 
+		 * Relations through intermediate models and compound relations are loaded on demand
+		 */
+		PHALCON_INIT_NVAR(has_through);
+		PHALCON_CALL_METHOD(has_through, relation, "hasthrough");
+
+		PHALCON_INIT_NVAR(fields);
+		PHALCON_CALL_METHOD(fields, relation, "getfields");
+		if (zend_is_true(has_through) || Z_TYPE_P(fields) == IS_ARRAY) {
+			zend_hash_move_forward_ex(ah0, &hp0);
+			continue;
+		}
+
+		PHALCON_INIT_NVAR(referenced_fields);
+		PHALCON_CALL_METHOD(referenced_fields, relation, "getreferencedfields");
+
+		PHALCON_INIT_NVAR(referenced_model);
+		PHALCON_CALL_METHOD(referenced_model, relation, "getreferencedmodel");
+
+		PHALCON_INIT_NVAR(type);
+		PHALCON_CALL_METHOD(type, relation, "gettype");
+
+		PHALCON_INIT_NVAR(key_prefix);
+		PHALCON_CONCAT_SVSVSV(key_prefix, "eager$", referenced_model, "$", referenced_fields, "$", type);
+
+		/** 
+		 * Collect the distinct values of the relation field
+		 */
+		PHALCON_INIT_NVAR(values);
+		array_init(values);
+
+		PHALCON_INIT_NVAR(placeholders);
+		array_init(placeholders);
+
+		PHALCON_INIT_NVAR(bind_params);
+		array_init(bind_params);
+
+		number_placeholders = 0;
+
+		if (!phalcon_is_iterable(models, &ah1, &hp1, 0, 0 TSRMLS_CC)) {
+			return;
+		}
+
+		while (zend_hash_get_current_data_ex(ah1, (void**) &hd, &hp1) == SUCCESS) {
+
+			PHALCON_GET_FOREACH_VALUE(record);
+
+			PHALCON_INIT_NVAR(value);
+			PHALCON_CALL_METHOD_PARAMS_1(value, record, "readattribute", fields);
+			if (Z_TYPE_P(value) != IS_NULL) {
+
+				PHALCON_INIT_NVAR(unique_key);
+				PHALCON_CONCAT_VSV(unique_key, key_prefix, "$", value);
+				if (!phalcon_array_isset(values, unique_key)) {
+					phalcon_array_update_zval(&values, unique_key, &value, PH_COPY | PH_SEPARATE TSRMLS_CC);
+
+					PHALCON_INIT_NVAR(position);
+					ZVAL_LONG(position, number_placeholders);
+
+					PHALCON_INIT_NVAR(placeholder);
+					PHALCON_CONCAT_SV(placeholder, "?", position);
+					phalcon_array_append(&placeholders, placeholder, PH_SEPARATE TSRMLS_CC);
+					phalcon_array_append(&bind_params, value, PH_SEPARATE TSRMLS_CC);
+					number_placeholders++;
+				}
+			}
+
+			zend_hash_move_forward_ex(ah1, &hp1);
+		}
+
+		if (!number_placeholders) {
+			zend_hash_move_forward_ex(ah0, &hp0);
+			continue;
+		}
+
+		PHALCON_INIT_NVAR(join_placeholders);
+		phalcon_fast_join_str(join_placeholders, SL(", "), placeholders TSRMLS_CC);
+
+		PHALCON_INIT_NVAR(conditions);
+		PHALCON_CONCAT_VSVS(conditions, referenced_fields, " IN (", join_placeholders, ")");
+
+		PHALCON_INIT_NVAR(find_params);
+		array_init_size(find_params, 3);
+		phalcon_array_append(&find_params, conditions, PH_SEPARATE TSRMLS_CC);
+		phalcon_array_update_string(&find_params, SL("bind"), &bind_params, PH_COPY | PH_SEPARATE TSRMLS_CC);
+		phalcon_array_update_string(&find_params, SL("di"), &dependency_injector, PH_COPY | PH_SEPARATE TSRMLS_CC);
+
+		PHALCON_INIT_NVAR(arguments);
+		array_init_size(arguments, 1);
+		phalcon_array_append(&arguments, find_params, PH_SEPARATE TSRMLS_CC);
+
+		/** 
+		 * Query the related records of all the records at once
+		 */
+		PHALCON_INIT_NVAR(referenced_entity);
+		PHALCON_CALL_METHOD_PARAMS_1(referenced_entity, this_ptr, "load", referenced_model);
+
+		PHALCON_INIT_NVAR(call_object);
+		array_init_size(call_object, 2);
+		phalcon_array_append(&call_object, referenced_entity, PH_SEPARATE TSRMLS_CC);
+		add_next_index_stringl(call_object, SL("find"), 1);
+
+		PHALCON_INIT_NVAR(resultset);
+		PHALCON_CALL_USER_FUNC_ARRAY(resultset, call_object, arguments);
+
+		PHALCON_INIT_NVAR(rows);
+		PHALCON_CALL_METHOD(rows, resultset, "toarray");
+
+		PHALCON_INIT_NVAR(keep_snapshots);
+		PHALCON_CALL_METHOD_PARAMS_1(keep_snapshots, this_ptr, "iskeepingsnapshots", referenced_entity);
+
+		/** 
+		 * Group the rows by the value of the referenced field
+		 */
+		PHALCON_INIT_NVAR(grouped);
+		array_init(grouped);
+
+		if (!phalcon_is_iterable(rows, &ah2, &hp2, 0, 0 TSRMLS_CC)) {
+			return;
+		}
+
+		while (zend_hash_get_current_data_ex(ah2, (void**) &hd, &hp2) == SUCCESS) {
+
+			PHALCON_GET_FOREACH_VALUE(row);
+
+			PHALCON_OBS_NVAR(value);
+			phalcon_array_fetch(&value, row, referenced_fields, PH_NOISY_CC);
+
+			PHALCON_INIT_NVAR(unique_key);
+			PHALCON_CONCAT_VSV(unique_key, key_prefix, "$", value);
+			if (phalcon_array_isset(grouped, unique_key)) {
+				PHALCON_OBS_NVAR(group);
+				phalcon_array_fetch(&group, grouped, unique_key, PH_NOISY_CC);
+			} else {
+				PHALCON_INIT_NVAR(group);
+				array_init(group);
+			}
+
+			phalcon_array_append(&group, row, PH_SEPARATE TSRMLS_CC);
+			phalcon_array_update_zval(&grouped, unique_key, &group, PH_COPY | PH_SEPARATE TSRMLS_CC);
+
+			zend_hash_move_forward_ex(ah2, &hp2);
+		}
+
+		/** 
+		 * The related records are kept per referenced model, so writing to that model discards them
+		 */
+		PHALCON_INIT_NVAR(entity_name);
+		phalcon_fast_strtolower(entity_name, referenced_model);
+
+		PHALCON_OBS_NVAR(eager_records);
+		phalcon_read_property(&eager_records, this_ptr, SL("_eagerRecords"), PH_NOISY_CC);
+		if (phalcon_array_isset(eager_records, entity_name)) {
+			PHALCON_OBS_NVAR(entity_records);
+			phalcon_array_fetch(&entity_records, eager_records, entity_name, PH_NOISY_CC);
+		} else {
+			PHALCON_INIT_NVAR(entity_records);
+			array_init(entity_records);
+		}
+
+		if (!phalcon_is_iterable(values, &ah3, &hp3, 0, 0 TSRMLS_CC)) {
+			return;
+		}
+
+		while (zend_hash_get_current_data_ex(ah3, (void**) &hd, &hp3) == SUCCESS) {
+
+			PHALCON_GET_FOREACH_KEY(unique_key, ah3, hp3);
+
+			if (phalcon_array_isset(grouped, unique_key)) {
+				PHALCON_OBS_NVAR(group);
+				phalcon_array_fetch(&group, grouped, unique_key, PH_NOISY_CC);
+			} else {
+				PHALCON_INIT_NVAR(group);
+				array_init(group);
+			}
+
+			PHALCON_INIT_NVAR(related);
+			if (phalcon_get_intval(type) == 2) {
+
+				/** 
+				 * 'Has many' relations get a resultset backed by the grouped rows
+				 */
+				object_init_ex(related, phalcon_mvc_model_resultset_simple_ce);
+				PHALCON_CALL_METHOD_PARAMS_5_NORETURN(related, "__construct", null_value, referenced_entity, group, null_value, keep_snapshots);
+			} else {
+				if (phalcon_array_isset_long(group, 0)) {
+					PHALCON_OBS_NVAR(row);
+					phalcon_array_fetch_long(&row, group, 0, PH_NOISY_CC);
+					PHALCON_CALL_STATIC_PARAMS_5(related, "phalcon\\mvc\\model", "cloneresultmap", referenced_entity, row, null_value, dirty_state, keep_snapshots);
+
+					PHALCON_INIT_NVAR(identity_record);
+					PHALCON_CALL_METHOD_PARAMS_2(identity_record, this_ptr, "setidentityrecord", related, no_result);
+					PHALCON_CPY_WRT(related, identity_record);
+				} else {
+					ZVAL_BOOL(related, 0);
+				}
+			}
+
+			phalcon_array_update_zval(&entity_records, unique_key, &related, PH_COPY | PH_SEPARATE TSRMLS_CC);
+
+			zend_hash_move_forward_ex(ah3, &hp3);
+		}
+
+		phalcon_update_property_array(this_ptr, SL("_eagerRecords"), entity_name, entity_records TSRMLS_CC);
+
+		zend_hash_move_forward_ex(ah0, &hp0);
+	}
+
+	PHALCON_MM_RESTORE();
+}
+
+/**
+ * Sets if the models manager must keep an identity map of the records queried by primary key,
+ * returning the same instance every time a record is requested during the request
+ *
+ *<code>
+ * $modelsManager->useIdentityMap(true);
+ * $robot = Robots::findFirst(1);
+ * var_dump($robot === Robots::findFirst(1)); // true, the second call doesn't hit the database
+ *</code>
+ *
+ * @param boolean $identityMap
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, useIdentityMap){
+
+	zval *identity_map;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &identity_map) == FAILURE) {
+		RETURN_NULL();
+	}
+
+	phalcon_update_property_zval(this_ptr, SL("_useIdentityMap"), identity_map TSRMLS_CC);
+	
+}
+
+/**
+ * Checks if the models manager is keeping an identity map
+ *
+ * @return boolean
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, isUsingIdentityMap){
+
+	zval *identity_map;
+
+	PHALCON_MM_GROW();
+
+	PHALCON_OBS_VAR(identity_map);
+	phalcon_read_property(&identity_map, this_ptr, SL("_useIdentityMap"), PH_NOISY_CC);
+	if (zend_is_true(identity_map)) {
+		RETURN_MM_TRUE;
+	}
+	
+	RETURN_MM_FALSE;
+}
+
+/**
+ * Returns the key used to store a record in the identity map, composed by the model's class
+ * and the values of its primary key. NULL is returned if the record doesn't have a complete primary key
+ *
+ * @param Phalcon\Mvc\ModelInterface $record
+ * @return string
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, getIdentityKey){
+
+	zval *record, *meta_data, *primary_keys, *column_map;
+	zval *values, *primary_key = NULL, *attribute_field = NULL;
+	zval *value = NULL, *class_name, *join_values, *key;
+	HashTable *ah0;
+	HashPosition hp0;
+	zval **hd;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &record) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (Z_TYPE_P(record) != IS_OBJECT) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_model_exception_ce, "Only model instances can be stored in the identity map");
+		return;
+	}
+	
+	PHALCON_INIT_VAR(meta_data);
+	PHALCON_CALL_METHOD(meta_data, record, "getmodelsmetadata");
+	
+	PHALCON_INIT_VAR(primary_keys);
+	PHALCON_CALL_METHOD_PARAMS_1(primary_keys, meta_data, "getprimarykeyattributes", record);
+	if (!phalcon_fast_count_ev(primary_keys TSRMLS_CC)) {
+		RETURN_MM_NULL();
+	}
+	
+	PHALCON_INIT_VAR(column_map);
+	PHALCON_CALL_METHOD_PARAMS_1(column_map, meta_data, "getcolumnmap", record);
+	
+	PHALCON_INIT_VAR(values);
+	array_init(values);
+	
+	if (!phalcon_is_iterable(primary_keys, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_VALUE(primary_key);
+	
+		if (Z_TYPE_P(column_map) == IS_ARRAY && phalcon_array_isset(column_map, primary_key)) {
+			PHALCON_OBS_NVAR(attribute_field);
+			phalcon_array_fetch(&attribute_field, column_map, primary_key, PH_NOISY_CC);
+		} else {
+			PHALCON_CPY_WRT(attribute_field, primary_key);
+		}
+	
+		PHALCON_INIT_NVAR(value);
+		PHALCON_CALL_METHOD_PARAMS_1(value, record, "readattribute", attribute_field);
+		if (Z_TYPE_P(value) == IS_NULL) {
+			RETURN_MM_NULL();
+		}
+		phalcon_array_append(&values, value, PH_SEPARATE TSRMLS_CC);
+	
+		zend_hash_move_forward_ex(ah0, &hp0);
+	}
+	
+	PHALCON_INIT_VAR(class_name);
+	phalcon_get_class(class_name, record, 1 TSRMLS_CC);
+	
+	PHALCON_INIT_VAR(join_values);
+	phalcon_fast_join_str(join_values, SL("$"), values TSRMLS_CC);
+	
+	PHALCON_INIT_VAR(key);
+	PHALCON_CONCAT_VSV(key, class_name, "$", join_values);
+	
+	RETURN_CTOR(key);
+}
+
+/**
+ * Returns a record from the identity map by its primary key. Compound primary keys are passed
+ * as an array with the values in the same order of the primary key attributes
+ *
+ *<code>
+ * $robot = $modelsManager->getIdentityRecord('Robots', 1);
+ *</code>
+ *
+ * @param string $modelName
+ * @param mixed $primaryKey
+ * @return Phalcon\Mvc\ModelInterface
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, getIdentityRecord){
+
+	zval *model_name, *primary_key, *use_identity_map, *entity_name;
+	zval *join_values = NULL, *key, *identity_map, *record;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "zz", &model_name, &primary_key) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	PHALCON_OBS_VAR(use_identity_map);
+	phalcon_read_property(&use_identity_map, this_ptr, SL("_useIdentityMap"), PH_NOISY_CC);
+	if (!zend_is_true(use_identity_map)) {
+		RETURN_MM_FALSE;
+	}
+	
+	PHALCON_INIT_VAR(entity_name);
+	phalcon_fast_strtolower(entity_name, model_name);
+	if (Z_TYPE_P(primary_key) == IS_ARRAY) { 
+		PHALCON_INIT_VAR(join_values);
+		phalcon_fast_join_str(join_values, SL("$"), primary_key TSRMLS_CC);
+	} else {
+		PHALCON_CPY_WRT(join_values, primary_key);
+	}
+	
+	PHALCON_INIT_VAR(key);
+	PHALCON_CONCAT_VSV(key, entity_name, "$", join_values);
+	
+	PHALCON_OBS_VAR(identity_map);
+	phalcon_read_property(&identity_map, this_ptr, SL("_identityMap"), PH_NOISY_CC);
+	if (phalcon_array_isset(identity_map, key)) {
+		phalcon_property_incr(this_ptr, SL("_identityHits") TSRMLS_CC);
+	
+		PHALCON_OBS_VAR(record);
+		phalcon_array_fetch(&record, identity_map, key, PH_NOISY_CC);
+		RETURN_CCTOR(record);
+	}
+	
+	phalcon_property_incr(this_ptr, SL("_identityMisses") TSRMLS_CC);
+	
+	RETURN_MM_FALSE;
+}
+
+/**
+ * Stores a record in the identity map returning the instance kept in the map.
+ * If $replace is false and there is already a record with the same primary key the existing instance is returned
+ *
+ * @param Phalcon\Mvc\ModelInterface $record
+ * @param boolean $replace
+ * @return Phalcon\Mvc\ModelInterface
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, setIdentityRecord){
+
+	zval *record, *replace = NULL, *use_identity_map, *key, *identity_map;
+	zval *existing;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &record, &replace) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!replace) {
+		PHALCON_INIT_VAR(replace);
+		ZVAL_BOOL(replace, 1);
+	}
+	
+	PHALCON_OBS_VAR(use_identity_map);
+	phalcon_read_property(&use_identity_map, this_ptr, SL("_useIdentityMap"), PH_NOISY_CC);
+	if (!zend_is_true(use_identity_map)) {
+		RETURN_CCTOR(record);
+	}
+	
+	PHALCON_INIT_VAR(key);
+	PHALCON_CALL_METHOD_PARAMS_1(key, this_ptr, "getidentitykey", record);
+	if (Z_TYPE_P(key) == IS_NULL) {
+		RETURN_CCTOR(record);
+	}
+	
+	if (!zend_is_true(replace)) {
+		PHALCON_OBS_VAR(identity_map);
+		phalcon_read_property(&identity_map, this_ptr, SL("_identityMap"), PH_NOISY_CC);
+		if (phalcon_array_isset(identity_map, key)) {
+			PHALCON_OBS_VAR(existing);
+			phalcon_array_fetch(&existing, identity_map, key, PH_NOISY_CC);
+			RETURN_CCTOR(existing);
+		}
+	}
+	
+	phalcon_update_property_array(this_ptr, SL("_identityMap"), key, record TSRMLS_CC);
+	
+	RETURN_CCTOR(record);
+}
+
+/**
+ * Removes a record from the identity map
+ *
+ * @param Phalcon\Mvc\ModelInterface $record
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, removeIdentityRecord){
+
+	zval *record, *identity_map, *key;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &record) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	PHALCON_OBS_VAR(identity_map);
+	phalcon_read_property(&identity_map, this_ptr, SL("_identityMap"), PH_NOISY_CC);
+	if (Z_TYPE_P(identity_map) == IS_ARRAY) { 
+	
+		PHALCON_INIT_VAR(key);
+		PHALCON_CALL_METHOD_PARAMS_1(key, this_ptr, "getidentitykey", record);
+		if (Z_TYPE_P(key) != IS_NULL) {
+			if (phalcon_array_isset(identity_map, key)) {
+				phalcon_unset_property_array(this_ptr, SL("_identityMap"), key TSRMLS_CC);
+			}
+		}
+	}
+	
+	PHALCON_MM_RESTORE();
+}
+
+/**
+ * Removes all the records in the identity map
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, clearIdentityMap){
+
+
+	phalcon_update_property_null(this_ptr, SL("_identityMap") TSRMLS_CC);
+	
+}
+
+/**
+ * Returns the number of hits, misses and records stored in the identity map
+ *
+ *<code>
+ * print_r($modelsManager->getIdentityMapStats()); // array('hits' => 10, 'misses' => 2, 'records' => 2)
+ *</code>
+ *
+ * @return array
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, getIdentityMapStats){
+
+	zval *hits, *misses, *identity_map, *records, *stats;
+
+	PHALCON_MM_GROW();
+
+	PHALCON_OBS_VAR(hits);
+	phalcon_read_property(&hits, this_ptr, SL("_identityHits"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(misses);
+	phalcon_read_property(&misses, this_ptr, SL("_identityMisses"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(identity_map);
+	phalcon_read_property(&identity_map, this_ptr, SL("_identityMap"), PH_NOISY_CC);
+	
+	PHALCON_INIT_VAR(records);
+	phalcon_fast_count(records, identity_map TSRMLS_CC);
+	
+	PHALCON_INIT_VAR(stats);
+	array_init_size(stats, 3);
+	phalcon_array_update_string(&stats, SL("hits"), &hits, PH_COPY | PH_SEPARATE TSRMLS_CC);
+	phalcon_array_update_string(&stats, SL("misses"), &misses, PH_COPY | PH_SEPARATE TSRMLS_CC);
+	phalcon_array_update_string(&stats, SL("records"), &records, PH_COPY | PH_SEPARATE TSRMLS_CC);
+	
+	RETURN_CTOR(stats);
+}
+
+/**
+ * Sets the cache service used by the ORM-managed query cache. Once it's set, cached PHQL
+ * queries without an explicit key are identified automatically by their intermediate
+ * representation, their bound parameters and the version of the queried models.
+ * The version of a model changes every time one of its records is saved or deleted,
+ * so the cached resultsets never return stale data and they can use long lifetimes
+ *
+ *<code>
+ * $modelsManager->setQueryCacheService('modelsCache');
+ *
+ * $robots = Robots::find(array(
+ *	"type = 'virtual'",
+ *	"cache" => array("lifetime" => 86400)
+ * ));
+ *</code>
+ *
+ * @param string $service
+ * @param int $lifetime
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, setQueryCacheService){
+
+	zval *service, *lifetime = NULL;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &service, &lifetime) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!lifetime) {
+		PHALCON_INIT_VAR(lifetime);
+		ZVAL_LONG(lifetime, 86400);
+	}
+	
+	phalcon_update_property_zval(this_ptr, SL("_queryCacheService"), service TSRMLS_CC);
+	phalcon_update_property_zval(this_ptr, SL("_queryCacheLifetime"), lifetime TSRMLS_CC);
+	
+	PHALCON_MM_RESTORE();
+}
+
+/**
+ * Returns the cache service used by the ORM-managed query cache
+ *
+ * @return string
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, getQueryCacheService){
+
+
+	RETURN_MEMBER(this_ptr, "_queryCacheService");
+}
+
+/**
+ * Returns the cache backend used by the ORM-managed query cache
+ *
+ * @return Phalcon\Cache\BackendInterface
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, getQueryCache){
+
+	zval *service, *dependency_injector, *cache;
+
+	PHALCON_MM_GROW();
+
+	PHALCON_OBS_VAR(service);
+	phalcon_read_property(&service, this_ptr, SL("_queryCacheService"), PH_NOISY_CC);
+	if (Z_TYPE_P(service) == IS_NULL) {
+		RETURN_MM_NULL();
+	}
+	
+	PHALCON_OBS_VAR(dependency_injector);
+	phalcon_read_property(&dependency_injector, this_ptr, SL("_dependencyInjector"), PH_NOISY_CC);
+	if (Z_TYPE_P(dependency_injector) != IS_OBJECT) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_model_exception_ce, "A dependency injector container is required to obtain the services related to the ORM");
+		return;
+	}
+	
+	PHALCON_INIT_VAR(cache);
+	PHALCON_CALL_METHOD_PARAMS_1(cache, dependency_injector, "getshared", service);
+	if (Z_TYPE_P(cache) != IS_OBJECT) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_model_exception_ce, "The cache service must be an object");
+		return;
+	}
+	
+	RETURN_CCTOR(cache);
+}
+
+/**
+ * Returns the current versions of the models passed in the ORM-managed query cache.
+ * Versions are read only once per request from the cache backend
+ *
+ * @param array $modelNames
+ * @return array
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, getQueryCacheVersions){
+
+	zval *model_names, *versions, *cache, *lifetime, *known_versions;
+	zval *model_name = NULL, *entity_name = NULL, *version_key = NULL;
+	zval *version = NULL;
+	HashTable *ah0;
+	HashPosition hp0;
+	zval **hd;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &model_names) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	PHALCON_INIT_VAR(versions);
+	array_init(versions);
+	
+	PHALCON_INIT_VAR(cache);
+	PHALCON_CALL_METHOD(cache, this_ptr, "getquerycache");
+	if (Z_TYPE_P(cache) != IS_OBJECT) {
+		RETURN_CTOR(versions);
+	}
+	
+	PHALCON_OBS_VAR(lifetime);
+	phalcon_read_property(&lifetime, this_ptr, SL("_queryCacheLifetime"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(known_versions);
+	phalcon_read_property(&known_versions, this_ptr, SL("_queryCacheVersions"), PH_NOISY_CC);
+	
+	if (!phalcon_is_iterable(model_names, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_VALUE(model_name);
+	
+		PHALCON_INIT_NVAR(entity_name);
+		phalcon_fast_strtolower(entity_name, model_name);
+		if (phalcon_array_isset(known_versions, entity_name)) {
+			PHALCON_OBS_NVAR(version);
+			phalcon_array_fetch(&version, known_versions, entity_name, PH_NOISY_CC);
+		} else {
+			PHALCON_INIT_NVAR(version_key);
+			PHALCON_CONCAT_SV(version_key, "phqlv-", entity_name);
+	
+			PHALCON_INIT_NVAR(version);
+			PHALCON_CALL_METHOD_PARAMS_2(version, cache, "get", version_key, lifetime);
+	
+			/** 
+			 * Versions start from the current timestamp so an expired version never matches an older one
+			 */
+			if (Z_TYPE_P(version) == IS_NULL) {
+				PHALCON_INIT_NVAR(version);
+				phalcon_mvc_model_manager_seed_version(version TSRMLS_CC);
+				PHALCON_CALL_METHOD_PARAMS_3_NORETURN(cache, "save", version_key, version, lifetime);
+			}
+			phalcon_update_property_array(this_ptr, SL("_queryCacheVersions"), entity_name, version TSRMLS_CC);
+		}
+		phalcon_array_update_zval(&versions, entity_name, &version, PH_COPY | PH_SEPARATE TSRMLS_CC);
+	
+		zend_hash_move_forward_ex(ah0, &hp0);
+	}
+	
+	RETURN_CTOR(versions);
+}
+
+/**
+ * Changes the version of a model in the ORM-managed query cache, invalidating every
+ * cached query that involves it. The records of the model loaded by eagerLoad are
+ * discarded even if the query cache is not enabled. If the model is written inside a
+ * transaction the version is changed once the transaction is committed
+ *
+ * @param string|Phalcon\Mvc\ModelInterface $model
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Manager, invalidateQueryCache){
+
+	zval *model, *cache, *entity_name = NULL, *instance = NULL, *connection;
+	zval *under_transaction, *version, *version_key, *callback;
+	zval *parameters, *lifetime;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &model) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	PHALCON_INIT_VAR(entity_name);
+	if (Z_TYPE_P(model) == IS_OBJECT) {
+		phalcon_get_class(entity_name, model, 1 TSRMLS_CC);
+	} else {
+		phalcon_fast_strtolower(entity_name, model);
+	}
+	
+	/** 
+	 * Records of the model loaded in advance by eagerLoad are discarded too
+	 */
+	phalcon_unset_property_array(this_ptr, SL("_eagerRecords"), entity_name TSRMLS_CC);
+	
+	PHALCON_INIT_VAR(cache);
+	PHALCON_CALL_METHOD(cache, this_ptr, "getquerycache");
+	if (Z_TYPE_P(cache) != IS_OBJECT) {
+		RETURN_MM_NULL();
+	}
+	
+	/** 
+	 * A new version is seeded instead of incrementing the stored one, two processes changing
+	 * the version at the same time never end up sharing it
+	 */
+	PHALCON_INIT_VAR(version);
+	phalcon_mvc_model_manager_seed_version(version TSRMLS_CC);
+	
+	PHALCON_INIT_VAR(version_key);
+	PHALCON_CONCAT_SV(version_key, "phqlv-", entity_name);
+	
+	if (Z_TYPE_P(model) == IS_OBJECT) {
+		PHALCON_CPY_WRT(instance, model);
+	} else {
+		PHALCON_INIT_NVAR(instance);
+		PHALCON_CALL_METHOD_PARAMS_1(instance, this_ptr, "load", model);
+	}
+	
+	/** 
+	 * Inside a transaction the shared version is changed after the commit, other requests could
+	 * cache the old rows again otherwise. Until then only this request uses a new version
+	 */
+	if (phalcon_method_exists_ex(instance, SS("getwriteconnection") TSRMLS_CC) == SUCCESS) {
+	
+		PHALCON_INIT_VAR(connection);
+		PHALCON_CALL_METHOD(connection, instance, "getwriteconnection");
+		if (Z_TYPE_P(connection) == IS_OBJECT) {
+			if (phalcon_method_exists_ex(connection, SS("oncommit") TSRMLS_CC) == SUCCESS) {
+	
+				PHALCON_INIT_VAR(under_transaction);
+				PHALCON_CALL_METHOD(under_transaction, connection, "isundertransaction");
+				if (zend_is_true(under_transaction)) {
+					phalcon_update_property_array(this_ptr, SL("_queryCacheVersions"), entity_name, version TSRMLS_CC);
+	
+					PHALCON_INIT_VAR(callback);
+					array_init_size(callback, 2);
+					phalcon_array_append(&callback, this_ptr, PH_SEPARATE TSRMLS_CC);
+					add_next_index_stringl(callback, SL("invalidateQueryCache"), 1);
+	
+					PHALCON_INIT_VAR(parameters);
+					array_init_size(parameters, 1);
+					phalcon_array_append(&parameters, entity_name, PH_SEPARATE TSRMLS_CC);
+					PHALCON_CALL_METHOD_PARAMS_3_NORETURN(connection, "oncommit", callback, parameters, version_key);
+					RETURN_MM_NULL();
+				}
+			}
+		}
+	}
+	
+	PHALCON_OBS_VAR(lifetime);
+	phalcon_read_property(&lifetime, this_ptr, SL("_queryCacheLifetime"), PH_NOISY_CC);
+	
+	PHALCON_CALL_METHOD_PARAMS_3_NORETURN(cache, "save", version_key, version, lifetime);
+	phalcon_update_property_array(this_ptr, SL("_queryCacheVersions"), entity_name, version TSRMLS_CC);
+	
+	PHALCON_MM_RESTORE();
+}
+
 /**
  * Gets belongsTo related records from a model
  *
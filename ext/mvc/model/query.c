@@ -92,6 +92,7 @@ PHALCON_INIT_CLASS(Phalcon_Mvc_Model_Query){
 	zend_declare_property_null(phalcon_mvc_model_query_ce, SL("_cache"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_model_query_ce, SL("_cacheOptions"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_model_query_ce, SL("_uniqueRow"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_model_query_ce, SL("_with"), ZEND_ACC_PROTECTED TSRMLS_CC);
 
 	zend_declare_class_constant_long(phalcon_mvc_model_query_ce, SL("TYPE_SELECT"), 309 TSRMLS_CC);
 	zend_declare_class_constant_long(phalcon_mvc_model_query_ce, SL("TYPE_INSERT"), 306 TSRMLS_CC);
@@ -2890,6 +2891,29 @@ PHP_METHOD(Phalcon_Mvc_Model_Query, cache){
 	RETURN_THISW();
 }
 
+/**
+ * Sets the relations to be loaded in advance with the records returned by the query.
+ * Only queries returning complete models can load relations in advance
+ *
+ *<code>
+ * $query = $manager->createQuery("SELECT * FROM Robots")->with("robotsParts");
+ *</code>
+ *
+ * @param string|array $relations
+ * @return Phalcon\Mvc\Model\Query
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Query, with){
+
+	zval *relations;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &relations) == FAILURE) {
+		RETURN_NULL();
+	}
+
+	phalcon_update_property_zval(this_ptr, SL("_with"), relations TSRMLS_CC);
+	RETURN_THISW();
+}
+
 /**
  * Returns the current cache options
  *
@@ -2912,6 +2936,44 @@ PHP_METHOD(Phalcon_Mvc_Model_Query, getCache){
 	RETURN_MEMBER(this_ptr, "_cache");
 }
 
+/**
+ * Copies bind params or bind types replacing their numeric keys by the ":n" placeholders
+ * generated by the dialects. Values that are not arrays are copied as they are
+ */
+static void phalcon_mvc_model_query_process_placeholders(zval *processed, zval *params TSRMLS_DC){
+
+	HashTable *ht;
+	HashPosition pos;
+	zval **value;
+	char *key, *placeholder;
+	uint key_length;
+	ulong index;
+	int placeholder_length;
+
+	if (Z_TYPE_P(params) != IS_ARRAY) {
+		ZVAL_ZVAL(processed, params, 1, 0);
+		return;
+	}
+
+	ht = Z_ARRVAL_P(params);
+	array_init_size(processed, zend_hash_num_elements(ht));
+
+	zend_hash_internal_pointer_reset_ex(ht, &pos);
+	while (zend_hash_get_current_data_ex(ht, (void**) &value, &pos) == SUCCESS) {
+
+		Z_ADDREF_PP(value);
+		if (zend_hash_get_current_key_ex(ht, &key, &key_length, &index, 0, &pos) == HASH_KEY_IS_LONG) {
+			placeholder_length = spprintf(&placeholder, 0, ":%ld", (long) index);
+			zend_hash_update(Z_ARRVAL_P(processed), placeholder, placeholder_length + 1, value, sizeof(zval*), NULL);
+			efree(placeholder);
+		} else {
+			zend_hash_update(Z_ARRVAL_P(processed), key, key_length, value, sizeof(zval*), NULL);
+		}
+
+		zend_hash_move_forward_ex(ht, &pos);
+	}
+}
+
 /**
  * Executes the SELECT intermediate representation producing a Phalcon\Mvc\Model\Resultset
  *
@@ -2932,12 +2994,11 @@ PHP_METHOD(Phalcon_Mvc_Model_Query, _executeSelect){
 	zval *sql_column = NULL, *instance = NULL, *attributes = NULL, *column_map = NULL;
 	zval *attribute = NULL, *hidden_alias = NULL, *column_alias = NULL;
 	zval *is_keeping_snapshots = NULL, *sql_alias = NULL, *dialect;
-	zval *sql_select, *processed = NULL, *value = NULL, *wildcard = NULL;
-	zval *string_wildcard = NULL, *processed_types = NULL, *result;
+	zval *sql_select, *processed, *processed_types, *result;
 	zval *count, *result_data = NULL, *cache, *result_object = NULL;
 	zval *resultset = NULL;
-	HashTable *ah0, *ah1, *ah2, *ah3, *ah4, *ah5, *ah6;
-	HashPosition hp0, hp1, hp2, hp3, hp4, hp5, hp6;
+	HashTable *ah0, *ah1, *ah2, *ah3, *ah4;
+	HashPosition hp0, hp1, hp2, hp3, hp4;
 	zval **hd;
 
 	PHALCON_MM_GROW();
@@ -3301,66 +3362,11 @@ PHP_METHOD(Phalcon_Mvc_Model_Query, _executeSelect){
 	/** 
 	 * Replace the placeholders
 	 */
-	if (Z_TYPE_P(bind_params) == IS_ARRAY) { 
-	
-		PHALCON_INIT_VAR(processed);
-		array_init(processed);
-	
-		if (!phalcon_is_iterable(bind_params, &ah5, &hp5, 0, 0 TSRMLS_CC)) {
-			return;
-		}
+	PHALCON_INIT_VAR(processed);
+	phalcon_mvc_model_query_process_placeholders(processed, bind_params TSRMLS_CC);
 	
-		while (zend_hash_get_current_data_ex(ah5, (void**) &hd, &hp5) == SUCCESS) {
-	
-			PHALCON_GET_FOREACH_KEY(wildcard, ah5, hp5);
-			PHALCON_GET_FOREACH_VALUE(value);
-	
-			if (Z_TYPE_P(wildcard) == IS_LONG) {
-				PHALCON_INIT_NVAR(string_wildcard);
-				PHALCON_CONCAT_SV(string_wildcard, ":", wildcard);
-				phalcon_array_update_zval(&processed, string_wildcard, &value, PH_COPY | PH_SEPARATE TSRMLS_CC);
-			} else {
-				phalcon_array_update_zval(&processed, wildcard, &value, PH_COPY | PH_SEPARATE TSRMLS_CC);
-			}
-	
-			zend_hash_move_forward_ex(ah5, &hp5);
-		}
-	
-	} else {
-		PHALCON_CPY_WRT(processed, bind_params);
-	}
-	
-	/** 
-	 * Replace the bind Types
-	 */
-	if (Z_TYPE_P(bind_types) == IS_ARRAY) { 
-	
-		PHALCON_INIT_VAR(processed_types);
-		array_init(processed_types);
-	
-		if (!phalcon_is_iterable(bind_types, &ah6, &hp6, 0, 0 TSRMLS_CC)) {
-			return;
-		}
-	
-		while (zend_hash_get_current_data_ex(ah6, (void**) &hd, &hp6) == SUCCESS) {
-	
-			PHALCON_GET_FOREACH_KEY(wildcard, ah6, hp6);
-			PHALCON_GET_FOREACH_VALUE(value);
-	
-			if (Z_TYPE_P(wildcard) == IS_LONG) {
-				PHALCON_INIT_NVAR(string_wildcard);
-				PHALCON_CONCAT_SV(string_wildcard, ":", wildcard);
-				phalcon_array_update_zval(&processed_types, string_wildcard, &value, PH_COPY | PH_SEPARATE TSRMLS_CC);
-			} else {
-				phalcon_array_update_zval(&processed_types, wildcard, &value, PH_COPY | PH_SEPARATE TSRMLS_CC);
-			}
-	
-			zend_hash_move_forward_ex(ah6, &hp6);
-		}
-	
-	} else {
-		PHALCON_CPY_WRT(processed_types, bind_types);
-	}
+	PHALCON_INIT_VAR(processed_types);
+	phalcon_mvc_model_query_process_placeholders(processed_types, bind_types TSRMLS_CC);
 	
 	/** 
 	 * Execute the query
@@ -3832,7 +3838,7 @@ PHP_METHOD(Phalcon_Mvc_Model_Query, _executeUpdate){
 	zval *null_value, *field = NULL, *number = NULL, *field_name = NULL;
 	zval *value = NULL, *type = NULL, *expr_value = NULL, *update_value = NULL;
 	zval *update_expr = NULL, *wildcard = NULL, *exception_message = NULL;
-	zval *records, *success = NULL, *status = NULL, *record = NULL;
+	zval *records, *success = NULL, *status = NULL, *record = NULL, *models_manager;
 	zval *r0 = NULL;
 	HashTable *ah0;
 	HashPosition hp0;
@@ -4064,6 +4070,13 @@ PHP_METHOD(Phalcon_Mvc_Model_Query, _executeUpdate){
 		PHALCON_CALL_METHOD_NORETURN(records, "next");
 	}
 	
+	/** 
+	 * Invalidate the cached queries that involve the model
+	 */
+	PHALCON_OBS_VAR(models_manager);
+	phalcon_read_property(&models_manager, this_ptr, SL("_manager"), PH_NOISY_CC);
+	PHALCON_CALL_METHOD_PARAMS_1_NORETURN(models_manager, "invalidatequerycache", model_name);
+	
 	PHALCON_INIT_NVAR(success);
 	ZVAL_BOOL(success, 1);
 	
@@ -4087,7 +4100,7 @@ PHP_METHOD(Phalcon_Mvc_Model_Query, _executeDelete){
 
 	zval *intermediate, *bind_params, *bind_types;
 	zval *models, *model_name, *models_instances;
-	zval *model = NULL, *manager, *records, *success = NULL, *null_value = NULL;
+	zval *model = NULL, *manager, *records, *success = NULL, *null_value = NULL, *models_manager;
 	zval *status = NULL, *record = NULL;
 	zval *r0 = NULL;
 
@@ -4178,6 +4191,13 @@ PHP_METHOD(Phalcon_Mvc_Model_Query, _executeDelete){
 		PHALCON_CALL_METHOD_NORETURN(records, "next");
 	}
 	
+	/** 
+	 * Invalidate the cached queries that involve the model
+	 */
+	PHALCON_OBS_VAR(models_manager);
+	phalcon_read_property(&models_manager, this_ptr, SL("_manager"), PH_NOISY_CC);
+	PHALCON_CALL_METHOD_PARAMS_1_NORETURN(models_manager, "invalidatequerycache", model_name);
+	
 	PHALCON_INIT_NVAR(success);
 	ZVAL_BOOL(success, 1);
 	
@@ -4207,8 +4227,13 @@ PHP_METHOD(Phalcon_Mvc_Model_Query, execute){
 	zval *bind_params = NULL, *bind_types = NULL, *unique_row;
 	zval *cache_options, *key, *lifetime = NULL, *cache_service = NULL;
 	zval *dependency_injector, *cache, *result = NULL, *is_fresh;
-	zval *prepared_result = NULL, *intermediate, *type;
-	zval *exception_message;
+	zval *prepared_result = NULL, *intermediate = NULL, *type;
+	zval *exception_message, *manager = NULL, *query_cache_service = NULL;
+	zval *models, *versions, *key_data, *serialized, *hash, *with;
+	zval *models_instances, *model_name = NULL;
+	HashTable *ah0;
+	HashPosition hp0;
+	zval **hd;
 
 	PHALCON_MM_GROW();
 
@@ -4227,6 +4252,9 @@ PHP_METHOD(Phalcon_Mvc_Model_Query, execute){
 	PHALCON_OBS_VAR(unique_row);
 	phalcon_read_property(&unique_row, this_ptr, SL("_uniqueRow"), PH_NOISY_CC);
 	
+	PHALCON_OBS_VAR(with);
+	phalcon_read_property(&with, this_ptr, SL("_with"), PH_NOISY_CC);
+	
 	PHALCON_OBS_VAR(cache_options);
 	phalcon_read_property(&cache_options, this_ptr, SL("_cacheOptions"), PH_NOISY_CC);
 	if (Z_TYPE_P(cache_options) != IS_NULL) {
@@ -4235,15 +4263,75 @@ PHP_METHOD(Phalcon_Mvc_Model_Query, execute){
 			return;
 		}
 	
+		PHALCON_OBS_VAR(manager);
+		phalcon_read_property(&manager, this_ptr, SL("_manager"), PH_NOISY_CC);
+	
+		PHALCON_INIT_VAR(query_cache_service);
+		PHALCON_CALL_METHOD(query_cache_service, manager, "getquerycacheservice");
+	
 		/** 
-		 * The user must set a cache key
+		 * The user must set a cache key unless the query cache is managed by the ORM
 		 */
 		if (phalcon_array_isset_string(cache_options, SS("key"))) {
 			PHALCON_OBS_VAR(key);
 			phalcon_array_fetch_string(&key, cache_options, SL("key"), PH_NOISY_CC);
 		} else {
-			PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_model_exception_ce, "A cache key must be provided to identify the cached resultset in the cache backend");
-			return;
+			if (Z_TYPE_P(query_cache_service) == IS_NULL) {
+				PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_model_exception_ce, "A cache key must be provided to identify the cached resultset in the cache backend");
+				return;
+			}
+	
+			/** 
+			 * The key is built from the IR, the bound parameters and the versions of the queried models,
+			 * the joined models are versioned too
+			 */
+			PHALCON_INIT_VAR(intermediate);
+			PHALCON_CALL_METHOD(intermediate, this_ptr, "parse");
+	
+			PHALCON_INIT_VAR(models);
+			if (phalcon_array_isset_string(intermediate, SS("models"))) {
+				PHALCON_OBS_NVAR(models);
+				phalcon_array_fetch_string(&models, intermediate, SL("models"), PH_NOISY_CC);
+			} else {
+				array_init(models);
+			}
+	
+			PHALCON_OBS_VAR(models_instances);
+			phalcon_read_property(&models_instances, this_ptr, SL("_modelsInstances"), PH_NOISY_CC);
+			if (Z_TYPE_P(models_instances) == IS_ARRAY) {
+	
+				if (!phalcon_is_iterable(models_instances, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+					return;
+				}
+	
+				while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+					PHALCON_GET_FOREACH_KEY(model_name, ah0, hp0);
+					phalcon_array_append(&models, model_name, PH_SEPARATE TSRMLS_CC);
+	
+					zend_hash_move_forward_ex(ah0, &hp0);
+				}
+	
+			}
+	
+			PHALCON_INIT_VAR(versions);
+			PHALCON_CALL_METHOD_PARAMS_1(versions, manager, "getquerycacheversions", models);
+	
+			PHALCON_INIT_VAR(key_data);
+			array_init_size(key_data, 4);
+			phalcon_array_append(&key_data, intermediate, PH_SEPARATE TSRMLS_CC);
+			phalcon_array_append(&key_data, bind_params, PH_SEPARATE TSRMLS_CC);
+			phalcon_array_append(&key_data, bind_types, PH_SEPARATE TSRMLS_CC);
+			phalcon_array_append(&key_data, versions, PH_SEPARATE TSRMLS_CC);
+	
+			PHALCON_INIT_VAR(serialized);
+			PHALCON_CALL_FUNC_PARAMS_1(serialized, "serialize", key_data);
+	
+			PHALCON_INIT_VAR(hash);
+			PHALCON_CALL_FUNC_PARAMS_1(hash, "md5", serialized);
+	
+			PHALCON_INIT_VAR(key);
+			PHALCON_CONCAT_SV(key, "phql-", hash);
 		}
 	
 		/** 
@@ -4264,8 +4352,12 @@ PHP_METHOD(Phalcon_Mvc_Model_Query, execute){
 			PHALCON_OBS_VAR(cache_service);
 			phalcon_array_fetch_string(&cache_service, cache_options, SL("service"), PH_NOISY_CC);
 		} else {
-			PHALCON_INIT_NVAR(cache_service);
-			ZVAL_STRING(cache_service, "modelsCache", 1);
+			if (Z_TYPE_P(query_cache_service) != IS_NULL) {
+				PHALCON_CPY_WRT(cache_service, query_cache_service);
+			} else {
+				PHALCON_INIT_NVAR(cache_service);
+				ZVAL_STRING(cache_service, "modelsCache", 1);
+			}
 		}
 	
 		PHALCON_OBS_VAR(dependency_injector);
@@ -4290,6 +4382,13 @@ PHP_METHOD(Phalcon_Mvc_Model_Query, execute){
 			ZVAL_BOOL(is_fresh, 0);
 			PHALCON_CALL_METHOD_PARAMS_1_NORETURN(result, "setisfresh", is_fresh);
 	
+			/** 
+			 * Load the requested relations of all the records at once
+			 */
+			if (Z_TYPE_P(with) != IS_NULL) {
+				PHALCON_CALL_METHOD_PARAMS_2_NORETURN(manager, "eagerload", result, with);
+			}
+	
 			/** 
 			 * Check if only the first row must be returned
 			 */
@@ -4310,7 +4409,7 @@ PHP_METHOD(Phalcon_Mvc_Model_Query, execute){
 	/** 
 	 * The statement is parsed from its PHQL string or a previously processed IR
 	 */
-	PHALCON_INIT_VAR(intermediate);
+	PHALCON_INIT_NVAR(intermediate);
 	PHALCON_CALL_METHOD(intermediate, this_ptr, "parse");
 	
 	PHALCON_OBS_VAR(type);
@@ -4361,6 +4460,17 @@ PHP_METHOD(Phalcon_Mvc_Model_Query, execute){
 		PHALCON_CALL_METHOD_PARAMS_3_NORETURN(cache, "save", key, result, lifetime);
 	}
 	
+	/** 
+	 * Load the requested relations of all the records at once
+	 */
+	if (Z_TYPE_P(with) != IS_NULL) {
+		if (PHALCON_IS_LONG(type, 309) && Z_TYPE_P(result) == IS_OBJECT) {
+			PHALCON_OBS_NVAR(manager);
+			phalcon_read_property(&manager, this_ptr, SL("_manager"), PH_NOISY_CC);
+			PHALCON_CALL_METHOD_PARAMS_2_NORETURN(manager, "eagerload", result, with);
+		}
+	}
+	
 	/** 
 	 * Check if only the first row must be returned
 	 */
@@ -4422,6 +4532,239 @@ PHP_METHOD(Phalcon_Mvc_Model_Query, getSingleResult){
 	RETURN_CCTOR(result);
 }
 
+/**
+ * Generates the SQL of a PHQL SELECT that only returns scalars and fetches the first column of
+ * its first row, or the number of rows it returns when count_rows is set
+ */
+static void phalcon_mvc_model_query_fetch_scalar(zval *return_value, zval *this_ptr, zval *bind_params, zval *bind_types, int count_rows TSRMLS_DC){
+
+	zval *intermediate;
+	zval *type, *manager, *models_instances = NULL, *models;
+	zval *model_name, *model = NULL, *connection = NULL, *columns;
+	zval *select_columns, *column = NULL, *alias = NULL, *column_type = NULL;
+	zval *sql_column = NULL, *column_alias = NULL, *dialect, *sql_select = NULL;
+	zval *sql_count;
+	zval *processed, *processed_types, *fetch_type, *row, *scalar;
+	HashTable *ah0;
+	HashPosition hp0;
+	zval **hd;
+
+	PHALCON_MM_GROW();
+
+	PHALCON_INIT_VAR(intermediate);
+	PHALCON_CALL_METHOD(intermediate, this_ptr, "parse");
+	
+	PHALCON_OBS_VAR(type);
+	phalcon_read_property(&type, this_ptr, SL("_type"), PH_NOISY_CC);
+	if (!PHALCON_IS_LONG(type, 309)) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_model_exception_ce, "Only PHQL SELECT statements can return a scalar");
+		return;
+	}
+	
+	PHALCON_OBS_VAR(manager);
+	phalcon_read_property(&manager, this_ptr, SL("_manager"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(models_instances);
+	phalcon_read_property(&models_instances, this_ptr, SL("_modelsInstances"), PH_NOISY_CC);
+	if (Z_TYPE_P(models_instances) != IS_ARRAY) { 
+		PHALCON_INIT_NVAR(models_instances);
+		array_init(models_instances);
+	}
+	
+	/** 
+	 * The read connection of the first model is used to execute the statement
+	 */
+	PHALCON_OBS_VAR(models);
+	phalcon_array_fetch_string(&models, intermediate, SL("models"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(model_name);
+	phalcon_array_fetch_long(&model_name, models, 0, PH_NOISY_CC);
+	if (!phalcon_array_isset(models_instances, model_name)) {
+		PHALCON_INIT_VAR(model);
+		PHALCON_CALL_METHOD_PARAMS_1(model, manager, "load", model_name);
+	} else {
+		PHALCON_OBS_NVAR(model);
+		phalcon_array_fetch(&model, models_instances, model_name, PH_NOISY_CC);
+	}
+	
+	if (phalcon_method_exists_ex(model, SS("selectreadconnection") TSRMLS_CC) == SUCCESS) {
+	
+		PHALCON_INIT_VAR(connection);
+		PHALCON_CALL_METHOD_PARAMS_3(connection, model, "selectreadconnection", intermediate, bind_params, bind_types);
+		if (Z_TYPE_P(connection) != IS_OBJECT) {
+			PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_model_exception_ce, "'selectReadConnection' didn't returned a valid connection");
+			return;
+		}
+	} else {
+		PHALCON_INIT_NVAR(connection);
+		PHALCON_CALL_METHOD(connection, model, "getreadconnection");
+	}
+	
+	/** 
+	 * Only scalar columns are allowed, they are passed to the dialect as they are
+	 */
+	PHALCON_OBS_VAR(columns);
+	phalcon_array_fetch_string(&columns, intermediate, SL("columns"), PH_NOISY_CC);
+	
+	PHALCON_INIT_VAR(select_columns);
+	array_init(select_columns);
+	
+	if (!phalcon_is_iterable(columns, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_KEY(alias, ah0, hp0);
+		PHALCON_GET_FOREACH_VALUE(column);
+	
+		PHALCON_OBS_NVAR(column_type);
+		phalcon_array_fetch_string(&column_type, column, SL("type"), PH_NOISY_CC);
+		if (!PHALCON_IS_STRING(column_type, "scalar")) {
+			if (count_rows) {
+				PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_model_exception_ce, "Only scalar columns can be counted");
+			} else {
+				PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_model_exception_ce, "Only scalar columns can be returned as a scalar");
+			}
+			return;
+		}
+	
+		PHALCON_OBS_NVAR(sql_column);
+		phalcon_array_fetch_string(&sql_column, column, SL("column"), PH_NOISY_CC);
+	
+		PHALCON_INIT_NVAR(column_alias);
+		array_init_size(column_alias, 3);
+		phalcon_array_append(&column_alias, sql_column, PH_SEPARATE TSRMLS_CC);
+		add_next_index_null(column_alias);
+		if (Z_TYPE_P(alias) != IS_LONG) {
+			phalcon_array_append(&column_alias, alias, PH_SEPARATE TSRMLS_CC);
+		}
+		phalcon_array_append(&select_columns, column_alias, PH_SEPARATE TSRMLS_CC);
+	
+		zend_hash_move_forward_ex(ah0, &hp0);
+	}
+	
+	phalcon_array_update_string(&intermediate, SL("columns"), &select_columns, PH_COPY | PH_SEPARATE TSRMLS_CC);
+	
+	PHALCON_INIT_VAR(dialect);
+	PHALCON_CALL_METHOD(dialect, connection, "getdialect");
+	
+	PHALCON_INIT_VAR(sql_select);
+	PHALCON_CALL_METHOD_PARAMS_1(sql_select, dialect, "select", intermediate);
+	
+	/** 
+	 * The rows are counted by the database wrapping the statement in a derived table
+	 */
+	if (count_rows) {
+		PHALCON_INIT_VAR(sql_count);
+		PHALCON_CONCAT_SVS(sql_count, "SELECT COUNT(*) FROM (", sql_select, ") AS phalcon_rows");
+		PHALCON_CPY_WRT(sql_select, sql_count);
+	}
+	
+	/** 
+	 * Replace the numeric placeholders in the bind params and bind types
+	 */
+	PHALCON_INIT_VAR(processed);
+	phalcon_mvc_model_query_process_placeholders(processed, bind_params TSRMLS_CC);
+	
+	PHALCON_INIT_VAR(processed_types);
+	phalcon_mvc_model_query_process_placeholders(processed_types, bind_types TSRMLS_CC);
+	
+	/** 
+	 * Fetch the first row as a numeric array (Phalcon\Db::FETCH_NUM)
+	 */
+	PHALCON_INIT_VAR(fetch_type);
+	ZVAL_LONG(fetch_type, 3);
+	
+	PHALCON_INIT_VAR(row);
+	PHALCON_CALL_METHOD_PARAMS_4(row, connection, "fetchone", sql_select, fetch_type, processed, processed_types);
+	if (Z_TYPE_P(row) == IS_ARRAY) { 
+		if (phalcon_array_isset_long(row, 0)) {
+			PHALCON_OBS_VAR(scalar);
+			phalcon_array_fetch_long(&scalar, row, 0, PH_NOISY_CC);
+			RETURN_CCTOR(scalar);
+		}
+	}
+	
+	RETURN_MM_NULL();
+}
+
+/**
+ * Executes a PHQL SELECT that only returns scalars, returning the first column of the first row.
+ * The SQL is generated directly by the dialect and the value is fetched without building
+ * resultsets or rows
+ *
+ *<code>
+ * $query = new Phalcon\Mvc\Model\Query("SELECT COUNT(*) FROM Robots WHERE type = ?0", $di);
+ * $total = $query->getSingleScalar(array('mechanical'));
+ *</code>
+ *
+ * @param array $bindParams
+ * @param array $bindTypes
+ * @return mixed
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Query, getSingleScalar){
+
+	zval *bind_params = NULL, *bind_types = NULL;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|zz", &bind_params, &bind_types) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!bind_params) {
+		PHALCON_INIT_VAR(bind_params);
+	}
+	
+	if (!bind_types) {
+		PHALCON_INIT_VAR(bind_types);
+	}
+	
+	phalcon_mvc_model_query_fetch_scalar(return_value, this_ptr, bind_params, bind_types, 0 TSRMLS_CC);
+	
+	PHALCON_MM_RESTORE();
+}
+
+/**
+ * Returns the number of rows a PHQL SELECT with scalar columns would return. The statement is
+ * wrapped in a SELECT COUNT(*) so grouped statements are counted by the database
+ *
+ *<code>
+ * $query = new Phalcon\Mvc\Model\Query("SELECT type FROM Robots GROUP BY type", $di);
+ * $types = $query->getRowCount();
+ *</code>
+ *
+ * @param array $bindParams
+ * @param array $bindTypes
+ * @return int
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Query, getRowCount){
+
+	zval *bind_params = NULL, *bind_types = NULL;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|zz", &bind_params, &bind_types) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!bind_params) {
+		PHALCON_INIT_VAR(bind_params);
+	}
+	
+	if (!bind_types) {
+		PHALCON_INIT_VAR(bind_types);
+	}
+	
+	phalcon_mvc_model_query_fetch_scalar(return_value, this_ptr, bind_params, bind_types, 1 TSRMLS_CC);
+	if (Z_TYPE_P(return_value) != IS_NULL) {
+		convert_to_long(return_value);
+	}
+	
+	PHALCON_MM_RESTORE();
+}
+
 /**
  * Sets the type of PHQL statement to be executed
  *
@@ -77,6 +77,7 @@ PHALCON_INIT_CLASS(Phalcon_Mvc_Model_Query_Builder){
 	zend_declare_property_null(phalcon_mvc_model_query_builder_ce, SL("_offset"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_model_query_builder_ce, SL("_forUpdate"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_model_query_builder_ce, SL("_sharedLock"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_model_query_builder_ce, SL("_with"), ZEND_ACC_PROTECTED TSRMLS_CC);
 
 	zend_class_implements(phalcon_mvc_model_query_builder_ce TSRMLS_CC, 2, phalcon_mvc_model_query_builderinterface_ce, phalcon_di_injectionawareinterface_ce);
 
@@ -92,7 +93,7 @@ PHP_METHOD(Phalcon_Mvc_Model_Query_Builder, __construct){
 
 	zval *params = NULL, *conditions = NULL, *columns, *group_clause;
 	zval *having_clause, *order_clause, *limit_clause;
-	zval *for_update, *shared_lock;
+	zval *for_update, *shared_lock, *with;
 
 	PHALCON_MM_GROW();
 
@@ -189,6 +190,15 @@ PHP_METHOD(Phalcon_Mvc_Model_Query_Builder, __construct){
 				phalcon_update_property_bool(this_ptr, SL("_sharedLock"), 1 TSRMLS_CC);
 			}
 		}
+	
+		/** 
+		 * Assign the relations to load in advance
+		 */
+		if (phalcon_array_isset_string(params, SS("with"))) {
+			PHALCON_OBS_VAR(with);
+			phalcon_array_fetch_string(&with, params, SL("with"), PH_NOISY_CC);
+			phalcon_update_property_zval(this_ptr, SL("_with"), with TSRMLS_CC);
+		}
 	}
 	
 	PHALCON_MM_RESTORE();
@@ -796,6 +806,39 @@ PHP_METHOD(Phalcon_Mvc_Model_Query_Builder, getGroupBy){
 	RETURN_MEMBER(this_ptr, "_group");
 }
 
+/**
+ * Sets the relations to be loaded in advance with the records returned by the query
+ *
+ *<code>
+ *	$builder->from('Robots')->with('robotsParts');
+ *</code>
+ *
+ * @param string|array $relations
+ * @return Phalcon\Mvc\Model\Query\Builder
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Query_Builder, with){
+
+	zval *relations;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &relations) == FAILURE) {
+		RETURN_NULL();
+	}
+
+	phalcon_update_property_zval(this_ptr, SL("_with"), relations TSRMLS_CC);
+	RETURN_THISW();
+}
+
+/**
+ * Returns the relations to be loaded in advance
+ *
+ * @return string|array
+ */
+PHP_METHOD(Phalcon_Mvc_Model_Query_Builder, getWith){
+
+
+	RETURN_MEMBER(this_ptr, "_with");
+}
+
 /**
  * Returns a PHQL statement built based on the builder parameters
  *
@@ -1271,7 +1314,7 @@ PHP_METHOD(Phalcon_Mvc_Model_Query_Builder, getPhql){
  */
 PHP_METHOD(Phalcon_Mvc_Model_Query_Builder, getQuery){
 
-	zval *phql, *query, *dependency_injector;
+	zval *phql, *query, *dependency_injector, *with;
 
 	PHALCON_MM_GROW();
 
@@ -1285,6 +1328,13 @@ PHP_METHOD(Phalcon_Mvc_Model_Query_Builder, getQuery){
 	PHALCON_OBS_VAR(dependency_injector);
 	phalcon_read_property(&dependency_injector, this_ptr, SL("_dependencyInjector"), PH_NOISY_CC);
 	PHALCON_CALL_METHOD_PARAMS_1_NORETURN(query, "setdi", dependency_injector);
+	
+	PHALCON_OBS_VAR(with);
+	phalcon_read_property(&with, this_ptr, SL("_with"), PH_NOISY_CC);
+	if (Z_TYPE_P(with) != IS_NULL) {
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(query, "with", with);
+	}
+	
 	RETURN_CTOR(query);
 }
 
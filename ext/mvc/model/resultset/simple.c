@@ -68,7 +68,7 @@ PHALCON_INIT_CLASS(Phalcon_Mvc_Model_Resultset_Simple){
  *
  * @param array $columnMap
  * @param Phalcon\Mvc\ModelInterface $model
- * @param Phalcon\Db\Result\Pdo $result
+ * @param Phalcon\Db\Result\Pdo|array $result
  * @param Phalcon\Cache\BackendInterface $cache
  * @param boolean $keepSnapshots
  */
@@ -95,6 +95,21 @@ PHP_METHOD(Phalcon_Mvc_Model_Resultset_Simple, __construct){
 	phalcon_update_property_zval(this_ptr, SL("_result"), result TSRMLS_CC);
 	phalcon_update_property_zval(this_ptr, SL("_cache"), cache TSRMLS_CC);
 	phalcon_update_property_zval(this_ptr, SL("_columnMap"), column_map TSRMLS_CC);
+	
+	/** 
+	 * Rows already fetched are traversed from memory
+	 */
+	if (Z_TYPE_P(result) == IS_ARRAY) { 
+		PHALCON_INIT_VAR(row_count);
+		phalcon_fast_count(row_count, result TSRMLS_CC);
+		phalcon_update_property_bool(this_ptr, SL("_result"), 0 TSRMLS_CC);
+		phalcon_update_property_long(this_ptr, SL("_type"), 0 TSRMLS_CC);
+		phalcon_update_property_zval(this_ptr, SL("_rows"), result TSRMLS_CC);
+		phalcon_update_property_zval(this_ptr, SL("_count"), row_count TSRMLS_CC);
+		phalcon_update_property_zval(this_ptr, SL("_keepSnapshots"), keep_snapshots TSRMLS_CC);
+		RETURN_MM_NULL();
+	}
+	
 	if (Z_TYPE_P(result) != IS_OBJECT) {
 		RETURN_MM_NULL();
 	}
@@ -40,6 +40,9 @@
 #include "kernel/concat.h"
 #include "kernel/file.h"
 #include "kernel/string.h"
+#include "kernel/persistent.h"
+
+#include "ext/standard/php_smart_str.h"
 
 /**
  * Phalcon\Mvc\View
@@ -94,6 +97,11 @@ PHALCON_INIT_CLASS(Phalcon_Mvc_View){
 	zend_declare_property_long(phalcon_mvc_view_ce, SL("_cacheLevel"), 0, ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_view_ce, SL("_activeRenderPath"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_bool(phalcon_mvc_view_ce, SL("_disabled"), 0, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_bool(phalcon_mvc_view_ce, SL("_pathCache"), 0, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_bool(phalcon_mvc_view_ce, SL("_pathCacheStat"), 1, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_bool(phalcon_mvc_view_ce, SL("_streaming"), 0, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_view_ce, SL("_streamLevels"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_long(phalcon_mvc_view_ce, SL("_streamPosition"), 0, ZEND_ACC_PROTECTED TSRMLS_CC);
 
 	zend_declare_class_constant_long(phalcon_mvc_view_ce, SL("LEVEL_MAIN_LAYOUT"), 5 TSRMLS_CC);
 	zend_declare_class_constant_long(phalcon_mvc_view_ce, SL("LEVEL_AFTER_TEMPLATE"), 4 TSRMLS_CC);
@@ -728,6 +736,7 @@ PHP_METHOD(Phalcon_Mvc_View, _loadTemplateEngines){
  * @param boolean $silence
  * @param boolean $mustClean
  * @param Phalcon\Cache\BackendInterface $cache
+ * @return boolean
  */
 PHP_METHOD(Phalcon_Mvc_View, _engineRender){
 
@@ -739,9 +748,16 @@ PHP_METHOD(Phalcon_Mvc_View, _engineRender){
 	zval *cache_options, *cached_view, *is_fresh;
 	zval *engine = NULL, *extension = NULL, *view_engine_path = NULL;
 	zval *event_name = NULL, *status = NULL, *exception_message;
+	zval *path_cache, *path_cache_stat, *path_key = NULL;
 	HashTable *ah0;
-	HashPosition hp0;
+	HashPosition hp0, hp1;
 	zval **hd;
+	phalcon_persistent_entry *cached = NULL;
+	smart_str key_buffer = {0};
+	char *hash_index, *absolute_path;
+	uint hash_index_len;
+	ulong hash_num;
+	int use_path_cache, revalidate = 1, known_missing = 0, resolved = 0, exists;
 
 	PHALCON_MM_GROW();
 
@@ -822,7 +838,7 @@ PHP_METHOD(Phalcon_Mvc_View, _engineRender){
 				 */
 				if (Z_TYPE_P(key) == IS_NULL) {
 					PHALCON_INIT_NVAR(key);
-					PHALCON_CALL_FUNC_PARAMS_1(key, "md5", view_path);
+					phalcon_md5(key, view_path);
 				}
 	
 				/** 
@@ -847,6 +863,54 @@ PHP_METHOD(Phalcon_Mvc_View, _engineRender){
 		}
 	}
 	
+	/** 
+	 * The absolute path of the file that resolves a view is cached per worker, the key is the
+	 * path of the view plus the registered extensions
+	 */
+	PHALCON_OBS_VAR(path_cache);
+	phalcon_read_property(&path_cache, this_ptr, SL("_pathCache"), PH_NOISY_CC);
+	
+	use_path_cache = zend_is_true(path_cache) && Z_TYPE_P(views_dir_path) == IS_STRING && Z_TYPE_P(engines) == IS_ARRAY;
+	if (use_path_cache) {
+	
+		PHALCON_OBS_VAR(path_cache_stat);
+		phalcon_read_property(&path_cache_stat, this_ptr, SL("_pathCacheStat"), PH_NOISY_CC);
+		revalidate = zend_is_true(path_cache_stat);
+	
+		/** 
+		 * Relative views directories are expanded, the cached paths must not depend on the
+		 * current directory of the request
+		 */
+		if (!IS_ABSOLUTE_PATH(Z_STRVAL_P(views_dir_path), Z_STRLEN_P(views_dir_path))) {
+			absolute_path = expand_filepath(Z_STRVAL_P(views_dir_path), NULL TSRMLS_CC);
+			if (absolute_path) {
+				PHALCON_INIT_NVAR(views_dir_path);
+				ZVAL_STRING(views_dir_path, absolute_path, 0);
+			}
+		}
+	
+		smart_str_appendl(&key_buffer, Z_STRVAL_P(views_dir_path), Z_STRLEN_P(views_dir_path));
+		zend_hash_internal_pointer_reset_ex(Z_ARRVAL_P(engines), &hp1);
+		while (zend_hash_get_current_key_ex(Z_ARRVAL_P(engines), &hash_index, &hash_index_len, &hash_num, 0, &hp1) == HASH_KEY_IS_STRING) {
+			smart_str_appendc(&key_buffer, '\0');
+			smart_str_appendl(&key_buffer, hash_index, hash_index_len - 1);
+			zend_hash_move_forward_ex(Z_ARRVAL_P(engines), &hp1);
+		}
+		smart_str_0(&key_buffer);
+	
+		PHALCON_INIT_VAR(path_key);
+		ZVAL_STRINGL(path_key, key_buffer.c, key_buffer.len, 0);
+	
+		cached = phalcon_persistent_cache_find("views", Z_STRVAL_P(path_key), Z_STRLEN_P(path_key) + 1 TSRMLS_CC);
+		if (cached && !cached->value) {
+			/** 
+			 * Negative entries are only trusted when the cache doesn't revalidate
+			 */
+			known_missing = !revalidate;
+			cached = NULL;
+		}
+	}
+	
 	/** 
 	 * Views are rendered in each engine
 	 */
@@ -860,9 +924,49 @@ PHP_METHOD(Phalcon_Mvc_View, _engineRender){
 		PHALCON_GET_FOREACH_KEY(extension, ah0, hp0);
 		PHALCON_GET_FOREACH_VALUE(engine);
 	
-		PHALCON_INIT_NVAR(view_engine_path);
-		PHALCON_CONCAT_VV(view_engine_path, views_dir_path, extension);
-		if (phalcon_file_exists(view_engine_path TSRMLS_CC) == SUCCESS) {
+		if (cached) {
+	
+			/** 
+			 * The cached path ends with the extension of its engine, the engines before it
+			 * are known to be missing
+			 */
+			if (Z_TYPE_P(extension) != IS_STRING || Z_STRLEN_P(extension) != cached->number || memcmp(Z_STRVAL_P(extension), cached->value + cached->value_length - cached->number, cached->number)) {
+				zend_hash_move_forward_ex(ah0, &hp0);
+				continue;
+			}
+	
+			PHALCON_INIT_NVAR(view_engine_path);
+			ZVAL_STRINGL(view_engine_path, cached->value, cached->value_length, 1);
+	
+			cached = NULL;
+			if (revalidate && phalcon_file_exists(view_engine_path TSRMLS_CC) == FAILURE) {
+				/** 
+				 * The view was removed, every extension is probed again
+				 */
+				phalcon_persistent_cache_delete("views", Z_STRVAL_P(path_key), Z_STRLEN_P(path_key) + 1 TSRMLS_CC);
+				zend_hash_internal_pointer_reset_ex(ah0, &hp0);
+				continue;
+			}
+	
+			exists = 1;
+			resolved = 1;
+		} else {
+	
+			PHALCON_INIT_NVAR(view_engine_path);
+			PHALCON_CONCAT_VV(view_engine_path, views_dir_path, extension);
+	
+			if (known_missing) {
+				exists = 0;
+			} else {
+				exists = phalcon_file_exists(view_engine_path TSRMLS_CC) == SUCCESS;
+				if (exists && use_path_cache && !resolved && Z_TYPE_P(extension) == IS_STRING) {
+					phalcon_persistent_cache_store("views", Z_STRVAL_P(path_key), Z_STRLEN_P(path_key) + 1, Z_STRVAL_P(view_engine_path), Z_STRLEN_P(view_engine_path), Z_STRLEN_P(extension) TSRMLS_CC);
+					resolved = 1;
+				}
+			}
+		}
+	
+		if (exists) {
 	
 			/** 
 			 * Call beforeRenderView if there is a events manager available
@@ -899,6 +1003,10 @@ PHP_METHOD(Phalcon_Mvc_View, _engineRender){
 		zend_hash_move_forward_ex(ah0, &hp0);
 	}
 	
+	if (use_path_cache && !resolved && !known_missing) {
+		phalcon_persistent_cache_store("views", Z_STRVAL_P(path_key), Z_STRLEN_P(path_key) + 1, NULL, 0, 0 TSRMLS_CC);
+	}
+	
 	if (PHALCON_IS_TRUE(not_exists)) {
 	
 		/** 
@@ -917,9 +1025,159 @@ PHP_METHOD(Phalcon_Mvc_View, _engineRender){
 			PHALCON_THROW_EXCEPTION_ZVAL(phalcon_mvc_view_exception_ce, exception_message);
 			return;
 		}
+	
+		RETURN_MM_FALSE;
 	}
 	
-	PHALCON_MM_RESTORE();
+	RETURN_MM_TRUE;
+}
+
+/**
+ * Caches per worker the engine and the file resolved for every view, so the views aren't searched
+ * in every registered extension on every render. Views not found are cached as well.
+ * In production $stat can be false to trust the cache without checking the filesystem again
+ *
+ *<code>
+ * $view->usePathCache(true, false);
+ *</code>
+ *
+ * @param boolean $usePathCache
+ * @param boolean $stat
+ * @return Phalcon\Mvc\View
+ */
+PHP_METHOD(Phalcon_Mvc_View, usePathCache){
+
+	zval *use_path_cache, *revalidate = NULL;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &use_path_cache, &revalidate) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!revalidate) {
+		PHALCON_INIT_VAR(revalidate);
+		ZVAL_BOOL(revalidate, 1);
+	}
+	
+	phalcon_update_property_bool(this_ptr, SL("_pathCache"), zend_is_true(use_path_cache) TSRMLS_CC);
+	phalcon_update_property_bool(this_ptr, SL("_pathCacheStat"), zend_is_true(revalidate) TSRMLS_CC);
+	RETURN_THIS();
+}
+
+/**
+ * Removes all the views resolved by the path cache of the current worker
+ */
+PHP_METHOD(Phalcon_Mvc_View, clearPathCache){
+
+
+	phalcon_persistent_cache_clear("views" TSRMLS_CC);
+}
+
+/**
+ * Renders the levels of the page as they are needed instead of buffering the whole page.
+ * The main layout is rendered first and the output produced before every call to
+ * getContent() is sent to the client, so the head of the page is sent before the action
+ * view is rendered. The headers of the response are sent when the render starts
+ *
+ *<code>
+ * $view->setStreaming(true);
+ *</code>
+ *
+ * @param boolean $streaming
+ * @return Phalcon\Mvc\View
+ */
+PHP_METHOD(Phalcon_Mvc_View, setStreaming){
+
+	zval *streaming;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &streaming) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	phalcon_update_property_bool(this_ptr, SL("_streaming"), zend_is_true(streaming) TSRMLS_CC);
+	RETURN_THIS();
+}
+
+/**
+ * Checks whether the view is rendered in streaming mode
+ *
+ * @return boolean
+ */
+PHP_METHOD(Phalcon_Mvc_View, isStreaming){
+
+
+	RETURN_MEMBER(this_ptr, "_streaming");
+}
+
+/**
+ * Renders the next inner level queued by the streaming mode. If there are no more levels
+ * the output of the controller is printed
+ *
+ * @return boolean
+ */
+PHP_METHOD(Phalcon_Mvc_View, _streamNext){
+
+	zval *stream_levels, *position, *engines, *must_clean;
+	zval *cache, *level = NULL, *view_path = NULL, *silence = NULL;
+	zval *rendered = NULL, *content;
+	long i;
+
+	PHALCON_MM_GROW();
+
+	PHALCON_OBS_VAR(stream_levels);
+	phalcon_read_property(&stream_levels, this_ptr, SL("_streamLevels"), PH_NOISY_CC);
+	if (Z_TYPE_P(stream_levels) == IS_ARRAY) {
+	
+		PHALCON_OBS_VAR(position);
+		phalcon_read_property(&position, this_ptr, SL("_streamPosition"), PH_NOISY_CC);
+	
+		PHALCON_INIT_VAR(engines);
+		PHALCON_CALL_METHOD(engines, this_ptr, "_loadtemplateengines");
+	
+		/** 
+		 * Levels write directly to the output
+		 */
+		PHALCON_INIT_VAR(must_clean);
+		ZVAL_BOOL(must_clean, 0);
+	
+		PHALCON_INIT_VAR(cache);
+	
+		i = phalcon_get_intval(position);
+		while (i > 0) {
+	
+			i--;
+			phalcon_update_property_long(this_ptr, SL("_streamPosition"), i TSRMLS_CC);
+	
+			PHALCON_OBS_NVAR(level);
+			phalcon_array_fetch_long(&level, stream_levels, i, PH_NOISY_CC);
+	
+			PHALCON_OBS_NVAR(view_path);
+			phalcon_array_fetch_long(&view_path, level, 0, PH_NOISY_CC);
+	
+			PHALCON_OBS_NVAR(silence);
+			phalcon_array_fetch_long(&silence, level, 1, PH_NOISY_CC);
+	
+			/** 
+			 * Levels without a view are skipped like in the buffered mode
+			 */
+			PHALCON_INIT_NVAR(rendered);
+			PHALCON_CALL_METHOD_PARAMS_5(rendered, this_ptr, "_enginerender", engines, view_path, silence, must_clean, cache);
+			if (zend_is_true(rendered)) {
+				RETURN_MM_TRUE;
+			}
+		}
+	}
+	
+	PHALCON_OBS_VAR(content);
+	phalcon_read_property(&content, this_ptr, SL("_content"), PH_NOISY_CC);
+	zend_print_zval(content, 0);
+	
+	phalcon_update_property_string(this_ptr, SL("_content"), SL("") TSRMLS_CC);
+	
+	RETURN_MM_FALSE;
 }
 
 /**
@@ -954,6 +1212,23 @@ PHP_METHOD(Phalcon_Mvc_View, registerEngines){
 	PHALCON_MM_RESTORE();
 }
 
+/**
+ * Queues a level to be rendered later by the streaming mode
+ */
+static void phalcon_mvc_view_queue_level(zval *stream_levels, zval *view_path, zval *silence TSRMLS_DC) {
+
+	zval *level;
+
+	MAKE_STD_ZVAL(level);
+	array_init_size(level, 2);
+
+	Z_ADDREF_P(view_path);
+	add_next_index_zval(level, view_path);
+	add_next_index_bool(level, zend_is_true(silence));
+
+	add_next_index_zval(stream_levels, level);
+}
+
 /**
  * Executes render process from dispatching data
  *
@@ -980,9 +1255,12 @@ PHP_METHOD(Phalcon_Mvc_View, render){
 	zval *view_temp_path = NULL, *templates_after, *template_after = NULL;
 	zval *main_view, *is_started, *is_fresh;
 	zval *t0 = NULL, *t1 = NULL, *t2 = NULL, *t3 = NULL, *t4 = NULL;
+	zval *streaming, *stream_levels = NULL;
+	zval *dependency_injector, *service, *has_response, *response;
 	HashTable *ah0, *ah1;
 	HashPosition hp0, hp1;
 	zval **hd;
+	int stream;
 
 	PHALCON_MM_GROW();
 
@@ -1107,6 +1385,20 @@ PHP_METHOD(Phalcon_Mvc_View, render){
 	PHALCON_INIT_VAR(silence);
 	ZVAL_BOOL(silence, 1);
 	
+	/** 
+	 * In streaming mode the levels are queued and rendered from the outermost one, every
+	 * level renders the next inner one when it calls getContent(). Cached views are
+	 * always buffered
+	 */
+	PHALCON_OBS_VAR(streaming);
+	phalcon_read_property(&streaming, this_ptr, SL("_streaming"), PH_NOISY_CC);
+	
+	stream = zend_is_true(streaming) && Z_TYPE_P(cache) != IS_OBJECT;
+	if (stream) {
+		PHALCON_INIT_VAR(stream_levels);
+		array_init_size(stream_levels, 5);
+	}
+	
 	/** 
 	 * Disabled levels allow to avoid an specific level of rendering
 	 */
@@ -1129,7 +1421,11 @@ PHP_METHOD(Phalcon_Mvc_View, render){
 		is_smaller_or_equal_function(enter_level, t0, render_level TSRMLS_CC);
 		if (PHALCON_IS_TRUE(enter_level)) {
 			if (!phalcon_array_isset_long(disabled_levels, 1)) {
-				PHALCON_CALL_METHOD_PARAMS_5_NORETURN(this_ptr, "_enginerender", engines, render_view, silence, must_clean, cache);
+				if (stream) {
+					phalcon_mvc_view_queue_level(stream_levels, render_view, silence TSRMLS_CC);
+				} else {
+					PHALCON_CALL_METHOD_PARAMS_5_NORETURN(this_ptr, "_enginerender", engines, render_view, silence, must_clean, cache);
+				}
 			}
 		}
 	
@@ -1164,7 +1460,11 @@ PHP_METHOD(Phalcon_Mvc_View, render){
 	
 						PHALCON_INIT_NVAR(view_temp_path);
 						PHALCON_CONCAT_VV(view_temp_path, layouts_dir, template_before);
-						PHALCON_CALL_METHOD_PARAMS_5_NORETURN(this_ptr, "_enginerender", engines, view_temp_path, silence, must_clean, cache);
+						if (stream) {
+							phalcon_mvc_view_queue_level(stream_levels, view_temp_path, silence TSRMLS_CC);
+						} else {
+							PHALCON_CALL_METHOD_PARAMS_5_NORETURN(this_ptr, "_enginerender", engines, view_temp_path, silence, must_clean, cache);
+						}
 	
 						zend_hash_move_forward_ex(ah0, &hp0);
 					}
@@ -1186,7 +1486,11 @@ PHP_METHOD(Phalcon_Mvc_View, render){
 			if (!phalcon_array_isset_long(disabled_levels, 3)) {
 				PHALCON_INIT_NVAR(view_temp_path);
 				PHALCON_CONCAT_VV(view_temp_path, layouts_dir, layout_name);
-				PHALCON_CALL_METHOD_PARAMS_5_NORETURN(this_ptr, "_enginerender", engines, view_temp_path, silence, must_clean, cache);
+				if (stream) {
+					phalcon_mvc_view_queue_level(stream_levels, view_temp_path, silence TSRMLS_CC);
+				} else {
+					PHALCON_CALL_METHOD_PARAMS_5_NORETURN(this_ptr, "_enginerender", engines, view_temp_path, silence, must_clean, cache);
+				}
 			}
 		}
 	
@@ -1220,7 +1524,11 @@ PHP_METHOD(Phalcon_Mvc_View, render){
 	
 						PHALCON_INIT_NVAR(view_temp_path);
 						PHALCON_CONCAT_VV(view_temp_path, layouts_dir, template_after);
-						PHALCON_CALL_METHOD_PARAMS_5_NORETURN(this_ptr, "_enginerender", engines, view_temp_path, silence, must_clean, cache);
+						if (stream) {
+							phalcon_mvc_view_queue_level(stream_levels, view_temp_path, silence TSRMLS_CC);
+						} else {
+							PHALCON_CALL_METHOD_PARAMS_5_NORETURN(this_ptr, "_enginerender", engines, view_temp_path, silence, must_clean, cache);
+						}
 	
 						zend_hash_move_forward_ex(ah1, &hp1);
 					}
@@ -1242,7 +1550,11 @@ PHP_METHOD(Phalcon_Mvc_View, render){
 			if (!phalcon_array_isset_long(disabled_levels, 5)) {
 				PHALCON_OBS_VAR(main_view);
 				phalcon_read_property(&main_view, this_ptr, SL("_mainView"), PH_NOISY_CC);
-				PHALCON_CALL_METHOD_PARAMS_5_NORETURN(this_ptr, "_enginerender", engines, main_view, silence, must_clean, cache);
+				if (stream) {
+					phalcon_mvc_view_queue_level(stream_levels, main_view, silence TSRMLS_CC);
+				} else {
+					PHALCON_CALL_METHOD_PARAMS_5_NORETURN(this_ptr, "_enginerender", engines, main_view, silence, must_clean, cache);
+				}
 			}
 		}
 	
@@ -1268,6 +1580,48 @@ PHP_METHOD(Phalcon_Mvc_View, render){
 		}
 	}
 	
+	if (stream) {
+	
+		/** 
+		 * The output of the controller is kept in the content until the innermost level
+		 * asks for it
+		 */
+		PHALCON_CALL_FUNC_NORETURN("ob_clean");
+	
+		/** 
+		 * The headers of the response must be sent before the first byte of the page
+		 */
+		PHALCON_OBS_VAR(dependency_injector);
+		phalcon_read_property(&dependency_injector, this_ptr, SL("_dependencyInjector"), PH_NOISY_CC);
+		if (Z_TYPE_P(dependency_injector) == IS_OBJECT) {
+	
+			PHALCON_INIT_VAR(service);
+			ZVAL_STRING(service, "response", 1);
+	
+			PHALCON_INIT_VAR(has_response);
+			PHALCON_CALL_METHOD_PARAMS_1(has_response, dependency_injector, "has", service);
+			if (zend_is_true(has_response)) {
+				PHALCON_INIT_VAR(response);
+				PHALCON_CALL_METHOD_PARAMS_1(response, dependency_injector, "getshared", service);
+				PHALCON_CALL_METHOD_NORETURN(response, "sendheaders");
+			}
+		}
+	
+		phalcon_update_property_zval(this_ptr, SL("_streamLevels"), stream_levels TSRMLS_CC);
+		phalcon_update_property_long(this_ptr, SL("_streamPosition"), zend_hash_num_elements(Z_ARRVAL_P(stream_levels)) TSRMLS_CC);
+		PHALCON_CALL_METHOD_NORETURN(this_ptr, "_streamnext");
+	
+		/** 
+		 * Everything was already sent, so the content is empty
+		 */
+		phalcon_update_property_null(this_ptr, SL("_streamLevels") TSRMLS_CC);
+	
+		phalcon_update_property_string(this_ptr, SL("_content"), SL("") TSRMLS_CC);
+	
+		PHALCON_CALL_FUNC_NORETURN("ob_flush");
+		PHALCON_CALL_FUNC_NORETURN("flush");
+	}
+	
 	/** 
 	 * Call afterRender event
 	 */
@@ -1684,7 +2038,25 @@ PHP_METHOD(Phalcon_Mvc_View, setContent){
  */
 PHP_METHOD(Phalcon_Mvc_View, getContent){
 
+	zval *stream_levels;
+
+	PHALCON_MM_GROW();
 
+	/** 
+	 * While streaming, getContent() is a flush point: the output produced so far is sent
+	 * and the next inner level is rendered in place
+	 */
+	PHALCON_OBS_VAR(stream_levels);
+	phalcon_read_property(&stream_levels, this_ptr, SL("_streamLevels"), PH_NOISY_CC);
+	if (Z_TYPE_P(stream_levels) == IS_ARRAY) {
+		PHALCON_CALL_FUNC_NORETURN("ob_flush");
+		PHALCON_CALL_FUNC_NORETURN("flush");
+		PHALCON_CALL_METHOD_NORETURN(this_ptr, "_streamnext");
+		PHALCON_MM_RESTORE();
+		RETURN_EMPTY_STRING();
+	}
+	
+	PHALCON_MM_RESTORE();
 	RETURN_MEMBER(this_ptr, "_content");
 }
 
@@ -1734,6 +2106,7 @@ PHP_METHOD(Phalcon_Mvc_View, reset){
 	phalcon_update_property_long(this_ptr, SL("_renderLevel"), 5 TSRMLS_CC);
 	phalcon_update_property_long(this_ptr, SL("_cacheLevel"), 0 TSRMLS_CC);
 	phalcon_update_property_null(this_ptr, SL("_content") TSRMLS_CC);
+	phalcon_update_property_null(this_ptr, SL("_streamLevels") TSRMLS_CC);
 	
 }
 
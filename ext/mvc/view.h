@@ -50,6 +50,11 @@ PHP_METHOD(Phalcon_Mvc_View, getParams);
 PHP_METHOD(Phalcon_Mvc_View, start);
 PHP_METHOD(Phalcon_Mvc_View, _loadTemplateEngines);
 PHP_METHOD(Phalcon_Mvc_View, _engineRender);
+PHP_METHOD(Phalcon_Mvc_View, usePathCache);
+PHP_METHOD(Phalcon_Mvc_View, clearPathCache);
+PHP_METHOD(Phalcon_Mvc_View, setStreaming);
+PHP_METHOD(Phalcon_Mvc_View, isStreaming);
+PHP_METHOD(Phalcon_Mvc_View, _streamNext);
 PHP_METHOD(Phalcon_Mvc_View, registerEngines);
 PHP_METHOD(Phalcon_Mvc_View, render);
 PHP_METHOD(Phalcon_Mvc_View, pick);
@@ -132,6 +137,15 @@ ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_mvc_view_getvar, 0, 0, 1)
 	ZEND_ARG_INFO(0, key)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_mvc_view_usepathcache, 0, 0, 1)
+	ZEND_ARG_INFO(0, usePathCache)
+	ZEND_ARG_INFO(0, stat)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_mvc_view_setstreaming, 0, 0, 1)
+	ZEND_ARG_INFO(0, streaming)
+ZEND_END_ARG_INFO()
+
 ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_mvc_view_registerengines, 0, 0, 1)
 	ZEND_ARG_INFO(0, engines)
 ZEND_END_ARG_INFO()
@@ -203,6 +217,11 @@ PHALCON_INIT_FUNCS(phalcon_mvc_view_method_entry){
 	PHP_ME(Phalcon_Mvc_View, start, NULL, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Mvc_View, _loadTemplateEngines, NULL, ZEND_ACC_PROTECTED) 
 	PHP_ME(Phalcon_Mvc_View, _engineRender, NULL, ZEND_ACC_PROTECTED) 
+	PHP_ME(Phalcon_Mvc_View, usePathCache, arginfo_phalcon_mvc_view_usepathcache, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Mvc_View, clearPathCache, NULL, ZEND_ACC_PUBLIC|ZEND_ACC_STATIC) 
+	PHP_ME(Phalcon_Mvc_View, setStreaming, arginfo_phalcon_mvc_view_setstreaming, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Mvc_View, isStreaming, NULL, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Mvc_View, _streamNext, NULL, ZEND_ACC_PROTECTED) 
 	PHP_ME(Phalcon_Mvc_View, registerEngines, arginfo_phalcon_mvc_view_registerengines, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Mvc_View, render, arginfo_phalcon_mvc_view_render, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Mvc_View, pick, arginfo_phalcon_mvc_view_pick, ZEND_ACC_PUBLIC) 
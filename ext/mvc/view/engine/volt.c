@@ -40,12 +40,18 @@
 #include "kernel/string.h"
 #include "kernel/array.h"
 
+#include "ext/standard/php_string.h"
+
 /**
  * Phalcon\Mvc\View\Engine\Volt
  *
  * Designer friendly and fast template engine for PHP written in C
  */
 
+#define PHALCON_VOLT_CHARSET_OTHER 0
+#define PHALCON_VOLT_CHARSET_UTF8 1
+#define PHALCON_VOLT_CHARSET_LATIN1 2
+#define PHALCON_VOLT_CHARSET_ASCII 3
 
 /**
  * Phalcon\Mvc\View\Engine\Volt initializer
@@ -225,6 +231,174 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt, render){
 	PHALCON_MM_RESTORE();
 }
 
+/**
+ * Checks whether a string is made only of ASCII characters, in that case its bytes and
+ * characters are the same in any ASCII-compatible charset
+ */
+static int phalcon_mvc_view_engine_volt_is_ascii(const char *str, uint str_length){
+
+	const unsigned char *marker = (const unsigned char *) str;
+	const unsigned char *end = marker + str_length;
+
+	while (marker < end) {
+		if (*marker & 0x80) {
+			return 0;
+		}
+		marker++;
+	}
+
+	return 1;
+}
+
+/**
+ * Classifies a charset name accepted by the 'convert_encoding' filter
+ */
+static int phalcon_mvc_view_engine_volt_charset(zval *charset){
+
+	char *name;
+
+	if (Z_TYPE_P(charset) != IS_STRING) {
+		return PHALCON_VOLT_CHARSET_OTHER;
+	}
+
+	name = Z_STRVAL_P(charset);
+	if (!strcasecmp(name, "utf-8") || !strcasecmp(name, "utf8")) {
+		return PHALCON_VOLT_CHARSET_UTF8;
+	}
+
+	if (!strcasecmp(name, "iso-8859-1") || !strcasecmp(name, "latin1")) {
+		return PHALCON_VOLT_CHARSET_LATIN1;
+	}
+
+	if (!strcasecmp(name, "ascii") || !strcasecmp(name, "us-ascii") || !strcasecmp(name, "iso-8859-15") || !strcasecmp(name, "windows-1252") || !strcasecmp(name, "cp1252")) {
+		return PHALCON_VOLT_CHARSET_ASCII;
+	}
+
+	return PHALCON_VOLT_CHARSET_OTHER;
+}
+
+/**
+ * Extracts a slice from an array with the same semantics as array_slice
+ */
+static void phalcon_mvc_view_engine_volt_array_slice(zval *return_value, zval *arr, long offset, long length, int has_length){
+
+	HashTable *ht = Z_ARRVAL_P(arr);
+	HashPosition pos;
+	zval **entry;
+	char *str_key;
+	uint str_key_len;
+	ulong num_key;
+	long num = zend_hash_num_elements(ht), position = 0;
+
+	array_init(return_value);
+
+	if (offset > num) {
+		return;
+	}
+
+	if (offset < 0 && (offset = num + offset) < 0) {
+		offset = 0;
+	}
+
+	if (!has_length) {
+		length = num - offset;
+	} else {
+		if (length < 0) {
+			length = num - offset + length;
+		} else {
+			if (offset + length > num) {
+				length = num - offset;
+			}
+		}
+	}
+
+	if (length <= 0) {
+		return;
+	}
+
+	zend_hash_internal_pointer_reset_ex(ht, &pos);
+	while (zend_hash_get_current_data_ex(ht, (void**) &entry, &pos) == SUCCESS) {
+
+		if (position >= offset + length) {
+			break;
+		}
+
+		/**
+		 * String keys are preserved, numeric keys are renumbered
+		 */
+		if (position >= offset) {
+			Z_ADDREF_PP(entry);
+			if (zend_hash_get_current_key_ex(ht, &str_key, &str_key_len, &num_key, 0, &pos) == HASH_KEY_IS_STRING) {
+				zend_hash_update(Z_ARRVAL_P(return_value), str_key, str_key_len, entry, sizeof(zval *), NULL);
+			} else {
+				zend_hash_next_index_insert(Z_ARRVAL_P(return_value), entry, sizeof(zval *), NULL);
+			}
+		}
+
+		position++;
+		zend_hash_move_forward_ex(ht, &pos);
+	}
+}
+
+/**
+ * Extracts a substring counting bytes with the same semantics as mb_substr, slices out of
+ * the string are empty strings
+ */
+static void phalcon_mvc_view_engine_volt_substr(zval *return_value, char *str, long str_length, long offset, long length, int has_length){
+
+	if (offset < 0) {
+		offset = str_length + offset;
+		if (offset < 0) {
+			offset = 0;
+		}
+	}
+
+	if (!has_length) {
+		length = str_length - offset;
+	} else {
+		if (length < 0) {
+			length = (str_length - offset) + length;
+		}
+	}
+
+	if (offset >= str_length || length <= 0) {
+		RETURN_EMPTY_STRING();
+	}
+
+	if (offset + length > str_length) {
+		length = str_length - offset;
+	}
+
+	RETURN_STRINGL(str + offset, length, 1);
+}
+
+/**
+ * Converts a string from ISO-8859-1 to UTF-8, every byte above 0x7F takes two bytes
+ */
+static void phalcon_mvc_view_engine_volt_latin1_to_utf8(zval *return_value, const char *str, uint str_length){
+
+	const unsigned char *marker = (const unsigned char *) str;
+	const unsigned char *end = marker + str_length;
+	char *converted, *cursor;
+
+	converted = emalloc(str_length * 2 + 1);
+	cursor = converted;
+
+	while (marker < end) {
+		if (*marker < 0x80) {
+			*cursor++ = *marker;
+		} else {
+			*cursor++ = (char) (0xC0 | (*marker >> 6));
+			*cursor++ = (char) (0x80 | (*marker & 0x3F));
+		}
+		marker++;
+	}
+
+	*cursor = '\0';
+
+	RETURN_STRINGL(converted, cursor - converted, 0);
+}
+
 /**
  * Length filter. If an array/object is passed a count is performed otherwise a strlen/mb_strlen
  *
@@ -233,7 +407,8 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt, render){
  */
 PHP_METHOD(Phalcon_Mvc_View_Engine_Volt, length){
 
-	zval *item, *length = NULL;
+	zval *item, *length = NULL, *text = NULL;
+	long text_length;
 
 	PHALCON_MM_GROW();
 
@@ -241,25 +416,40 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt, length){
 		RETURN_MM_NULL();
 	}
 
-	PHALCON_INIT_VAR(length);
-	ZVAL_LONG(length, 0);
 	if (Z_TYPE_P(item) == IS_OBJECT) {
+		PHALCON_INIT_VAR(length);
 		phalcon_fast_count(length, item TSRMLS_CC);
+		RETURN_CCTOR(length);
+	}
+
+	if (Z_TYPE_P(item) == IS_ARRAY) { 
+		PHALCON_MM_RESTORE();
+		RETURN_LONG(zend_hash_num_elements(Z_ARRVAL_P(item)));
+	}
+
+	if (Z_TYPE_P(item) == IS_STRING) {
+		text = item;
 	} else {
-		if (Z_TYPE_P(item) == IS_ARRAY) { 
-			phalcon_fast_count(length, item TSRMLS_CC);
-		} else {
-			if (phalcon_function_exists_ex(SS("mb_strlen") TSRMLS_CC) == SUCCESS) {
-				PHALCON_CALL_FUNC_PARAMS_1(length, "mb_strlen", item);
-			} else {
-				PHALCON_INIT_NVAR(length);
-				phalcon_fast_strlen(length, item);
-			}
+		PHALCON_INIT_VAR(text);
+		ZVAL_ZVAL(text, item, 1, 0);
+		convert_to_string(text);
+	}
+
+	/** 
+	 * mb_strlen is only needed when the string has multi-byte characters
+	 */
+	if (!phalcon_mvc_view_engine_volt_is_ascii(Z_STRVAL_P(text), Z_STRLEN_P(text))) {
+		if (phalcon_function_exists_ex(SS("mb_strlen") TSRMLS_CC) == SUCCESS) {
+			PHALCON_INIT_VAR(length);
+			PHALCON_CALL_FUNC_PARAMS_1(length, "mb_strlen", text);
+			RETURN_CCTOR(length);
 		}
 	}
-	
-	
-	RETURN_CCTOR(length);
+
+	text_length = Z_STRLEN_P(text);
+
+	PHALCON_MM_RESTORE();
+	RETURN_LONG(text_length);
 }
 
 /**
@@ -271,7 +461,10 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt, length){
  */
 PHP_METHOD(Phalcon_Mvc_View_Engine_Volt, isIncluded){
 
-	zval *needle, *haystack, *included = NULL;
+	zval *needle, *haystack, *text = NULL, **entry, equals;
+	HashTable *ht;
+	HashPosition pos;
+	char *found;
 
 	PHALCON_MM_GROW();
 
@@ -279,21 +472,48 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt, isIncluded){
 		RETURN_MM_NULL();
 	}
 
+	/** 
+	 * Items are compared loosely like in_array does
+	 */
 	if (Z_TYPE_P(haystack) == IS_ARRAY) { 
-		PHALCON_INIT_VAR(included);
-		PHALCON_CALL_FUNC_PARAMS_2(included, "in_array", needle, haystack);
-		RETURN_CCTOR(included);
+
+		ht = Z_ARRVAL_P(haystack);
+
+		zend_hash_internal_pointer_reset_ex(ht, &pos);
+		while (zend_hash_get_current_data_ex(ht, (void**) &entry, &pos) == SUCCESS) {
+			is_equal_function(&equals, needle, *entry TSRMLS_CC);
+			if (Z_LVAL(equals)) {
+				RETURN_MM_TRUE;
+			}
+			zend_hash_move_forward_ex(ht, &pos);
+		}
+
+		RETURN_MM_FALSE;
 	}
+
+	/** 
+	 * A byte search is enough to know whether an UTF-8 string includes another one
+	 */
 	if (Z_TYPE_P(haystack) == IS_STRING) {
-		if (phalcon_function_exists_ex(SS("mb_strpos") TSRMLS_CC) == SUCCESS) {
-			PHALCON_INIT_NVAR(included);
-			PHALCON_CALL_FUNC_PARAMS_2(included, "mb_strpos", haystack, needle);
+
+		if (Z_TYPE_P(needle) == IS_STRING) {
+			text = needle;
 		} else {
-			PHALCON_INIT_NVAR(included);
-			phalcon_fast_strpos(included, haystack, needle TSRMLS_CC);
+			PHALCON_INIT_VAR(text);
+			ZVAL_ZVAL(text, needle, 1, 0);
+			convert_to_string(text);
 		}
-	
-		RETURN_CCTOR(included);
+
+		if (!Z_STRLEN_P(text)) {
+			RETURN_MM_FALSE;
+		}
+
+		found = php_memnstr(Z_STRVAL_P(haystack), Z_STRVAL_P(text), Z_STRLEN_P(text), Z_STRVAL_P(haystack) + Z_STRLEN_P(haystack));
+		if (found) {
+			RETURN_MM_TRUE;
+		}
+
+		RETURN_MM_FALSE;
 	}
 	
 	PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_view_exception_ce, "Invalid haystack");
@@ -301,26 +521,55 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt, isIncluded){
 }
 
 /**
- * Performs a string conversion
+ * Performs a string conversion, the arguments follow the order of mb_convert_encoding
+ *
+ *<code>
+ * $volt->convertEncoding($text, 'utf-8', 'latin1');
+ *</code>
+ *
+ * converEncoding is kept as a deprecated alias of this method
  *
  * @param string $text
- * @param string $from
  * @param string $to
+ * @param string $from
  * @return string
  */
-PHP_METHOD(Phalcon_Mvc_View_Engine_Volt, converEncoding){
+PHP_METHOD(Phalcon_Mvc_View_Engine_Volt, convertEncoding){
 
-	zval *text, *from, *to, *converted = NULL;
+	zval *text, *to, *from, *converted = NULL;
+	int to_charset, from_charset;
 
 	PHALCON_MM_GROW();
 
-	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "zzz", &text, &from, &to) == FAILURE) {
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "zzz", &text, &to, &from) == FAILURE) {
 		RETURN_MM_NULL();
 	}
 
+	/** 
+	 * ASCII strings don't change between ASCII-compatible charsets and ISO-8859-1 maps
+	 * directly to UTF-8
+	 */
+	if (Z_TYPE_P(text) == IS_STRING) {
+
+		to_charset = phalcon_mvc_view_engine_volt_charset(to);
+		from_charset = phalcon_mvc_view_engine_volt_charset(from);
+
+		if (to_charset != PHALCON_VOLT_CHARSET_OTHER && from_charset != PHALCON_VOLT_CHARSET_OTHER) {
+			if (phalcon_mvc_view_engine_volt_is_ascii(Z_STRVAL_P(text), Z_STRLEN_P(text))) {
+				RETURN_CCTOR(text);
+			}
+		}
+
+		if (to_charset == PHALCON_VOLT_CHARSET_UTF8 && from_charset == PHALCON_VOLT_CHARSET_LATIN1) {
+			PHALCON_MM_RESTORE();
+			phalcon_mvc_view_engine_volt_latin1_to_utf8(return_value, Z_STRVAL_P(text), Z_STRLEN_P(text));
+			return;
+		}
+	}
+
 	if (phalcon_function_exists_ex(SS("mb_convert_encoding") TSRMLS_CC) == SUCCESS) {
 		PHALCON_INIT_VAR(converted);
-		PHALCON_CALL_FUNC_PARAMS_3(converted, "mb_convert_encoding", text, from, to);
+		PHALCON_CALL_FUNC_PARAMS_3(converted, "mb_convert_encoding", text, to, from);
 		RETURN_CCTOR(converted);
 	}
 	if (phalcon_function_exists_ex(SS("iconv") TSRMLS_CC) == SUCCESS) {
@@ -341,8 +590,10 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt, converEncoding){
 PHP_METHOD(Phalcon_Mvc_View_Engine_Volt, slice){
 
 	zval *value, *start, *end = NULL, *slice = NULL, *length = NULL, *position;
-	zval *is_greater = NULL, *is_less = NULL, *current = NULL, *one, *range;
+	zval *is_greater = NULL, *is_less = NULL, *current = NULL, *text = NULL;
 	zval *r0 = NULL;
+	long offset, count = 0;
+	int has_count = 0;
 
 	PHALCON_MM_GROW();
 
@@ -405,55 +656,45 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt, slice){
 	/** 
 	 * Calculate the slice length
 	 */
+	offset = phalcon_get_intval(start);
 	if (Z_TYPE_P(end) != IS_NULL) {
-		PHALCON_INIT_VAR(one);
-		ZVAL_LONG(one, 1);
-	
-		PHALCON_INIT_VAR(range);
-		sub_function(range, end, start TSRMLS_CC);
-	
-		PHALCON_INIT_NVAR(length);
-		phalcon_add_function(length, range, one TSRMLS_CC);
-	} else {
-		PHALCON_INIT_NVAR(length);
+		count = phalcon_get_intval(end) - offset + 1;
+		has_count = 1;
 	}
 	
-	/** 
-	 * Use array_slice on arrays
-	 */
 	if (Z_TYPE_P(value) == IS_ARRAY) { 
-		PHALCON_INIT_NVAR(slice);
-		PHALCON_CALL_FUNC_PARAMS_3(slice, "array_slice", value, start, length);
-		RETURN_CTOR(slice);
+		PHALCON_MM_RESTORE();
+		phalcon_mvc_view_engine_volt_array_slice(return_value, value, offset, count, has_count);
+		return;
 	}
 	
-	/** 
-	 * Use mb_substr if available
-	 */
-	if (phalcon_function_exists_ex(SS("mb_substr") TSRMLS_CC) == SUCCESS) {
-		if (Z_TYPE_P(length) != IS_NULL) {
-			PHALCON_INIT_NVAR(slice);
-			PHALCON_CALL_FUNC_PARAMS_3(slice, "mb_substr", value, start, length);
-		} else {
-			PHALCON_INIT_NVAR(slice);
-			PHALCON_CALL_FUNC_PARAMS_2(slice, "mb_substr", value, start);
-		}
-	
-		RETURN_CCTOR(slice);
+	if (Z_TYPE_P(value) == IS_STRING) {
+		text = value;
+	} else {
+		PHALCON_INIT_VAR(text);
+		ZVAL_ZVAL(text, value, 1, 0);
+		convert_to_string(text);
 	}
 	
 	/** 
-	 * Use the standard substr function
+	 * mb_substr is only needed when the string has multi-byte characters
 	 */
-	if (Z_TYPE_P(length) != IS_NULL) {
-		PHALCON_INIT_NVAR(slice);
-		PHALCON_CALL_FUNC_PARAMS_3(slice, "substr", value, start, length);
-	} else {
-		PHALCON_INIT_NVAR(slice);
-		PHALCON_CALL_FUNC_PARAMS_2(slice, "substr", value, start);
-	}
+	if (!phalcon_mvc_view_engine_volt_is_ascii(Z_STRVAL_P(text), Z_STRLEN_P(text))) {
+		if (phalcon_function_exists_ex(SS("mb_substr") TSRMLS_CC) == SUCCESS) {
+			PHALCON_INIT_VAR(slice);
+			if (has_count) {
+				PHALCON_INIT_VAR(length);
+				ZVAL_LONG(length, count);
+				PHALCON_CALL_FUNC_PARAMS_3(slice, "mb_substr", text, start, length);
+			} else {
+				PHALCON_CALL_FUNC_PARAMS_2(slice, "mb_substr", text, start);
+			}
 	
+			RETURN_CCTOR(slice);
+		}
+	}
 	
-	RETURN_CCTOR(slice);
+	phalcon_mvc_view_engine_volt_substr(return_value, Z_STRVAL_P(text), Z_STRLEN_P(text), offset, count, has_count);
+	PHALCON_MM_RESTORE();
 }
 
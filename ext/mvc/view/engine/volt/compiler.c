@@ -40,9 +40,22 @@
 #include "kernel/operators.h"
 #include "kernel/concat.h"
 #include "kernel/string.h"
+#include "kernel/persistent.h"
 #include "mvc/view/engine/volt/scanner.h"
 #include "mvc/view/engine/volt/volt.h"
 
+#include "ext/standard/php_smart_str.h"
+#include "ext/standard/php_var.h"
+
+#ifdef PHP_WIN32
+#include "win32/time.h"
+#else
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
 /**
  * Phalcon\Mvc\View\Engine\Volt\Compiler
  *
@@ -55,6 +68,11 @@
  *</code>
  */
 
+/**
+ * Hashes of the keys read from every node of the intermediate representation,
+ * they're computed once when the class is registered
+ */
+static ulong phvolt_key_type, phvolt_key_value, phvolt_key_left, phvolt_key_right;
 
 /**
  * Phalcon\Mvc\View\Engine\Volt\Compiler initializer
@@ -78,17 +96,340 @@ PHALCON_INIT_CLASS(Phalcon_Mvc_View_Engine_Volt_Compiler){
 	zend_declare_property_null(phalcon_mvc_view_engine_volt_compiler_ce, SL("_blocks"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_view_engine_volt_compiler_ce, SL("_forElsePointers"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_view_engine_volt_compiler_ce, SL("_loopPointers"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_view_engine_volt_compiler_ce, SL("_cacheFragments"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_view_engine_volt_compiler_ce, SL("_functions"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_view_engine_volt_compiler_ce, SL("_filters"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_view_engine_volt_compiler_ce, SL("_prefix"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_view_engine_volt_compiler_ce, SL("_currentPath"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_mvc_view_engine_volt_compiler_ce, SL("_compiledTemplatePath"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_mvc_view_engine_volt_compiler_ce, SL("_registry"), ZEND_ACC_PROTECTED|ZEND_ACC_STATIC TSRMLS_CC);
 
 	zend_class_implements(phalcon_mvc_view_engine_volt_compiler_ce TSRMLS_CC, 1, phalcon_di_injectionawareinterface_ce);
 
+	phvolt_key_type = zend_inline_hash_func(SS("type"));
+	phvolt_key_value = zend_inline_hash_func(SS("value"));
+	phvolt_key_left = zend_inline_hash_func(SS("left"));
+	phvolt_key_right = zend_inline_hash_func(SS("right"));
+
 	return SUCCESS;
 }
 
+/**
+ * Checks if the 'nativeEscape' option is enabled, HTML is then escaped with htmlspecialchars
+ * using the default settings of Phalcon\Escaper instead of calling the escaper service
+ */
+static int phalcon_mvc_view_engine_volt_compiler_native_escape(zval *compiler TSRMLS_DC){
+
+	zval *options, **native_escape;
+
+	options = zend_read_property(phalcon_mvc_view_engine_volt_compiler_ce, compiler, SL("_options"), 1 TSRMLS_CC);
+	if (Z_TYPE_P(options) != IS_ARRAY) {
+		return 0;
+	}
+
+	if (zend_hash_find(Z_ARRVAL_P(options), SS("nativeEscape"), (void **) &native_escape) == SUCCESS) {
+		return zend_is_true(*native_escape);
+	}
+
+	return 0;
+}
+
+/**
+ * Evaluates at compile time the expressions made only of literals. Only integer and string results
+ * are folded, anything else is left to PHP
+ */
+static int phalcon_mvc_view_engine_volt_compiler_fold(zval *result, zval *expr TSRMLS_DC){
+
+	zval **type, **value, **left, **right, **name, left_value, right_value;
+	int i, status;
+
+	if (Z_TYPE_P(expr) != IS_ARRAY) {
+		return FAILURE;
+	}
+
+	if (zend_hash_find(Z_ARRVAL_P(expr), SS("type"), (void **) &type) == FAILURE || Z_TYPE_PP(type) != IS_LONG) {
+		return FAILURE;
+	}
+
+	switch (Z_LVAL_PP(type)) {
+
+		case 258:
+			if (zend_hash_find(Z_ARRVAL_P(expr), SS("value"), (void **) &value) == FAILURE || Z_TYPE_PP(value) != IS_STRING) {
+				return FAILURE;
+			}
+
+			/**
+			 * Octal literals and integers that could overflow are left to PHP
+			 */
+			if (Z_STRLEN_PP(value) > 18 || (Z_STRLEN_PP(value) > 1 && Z_STRVAL_PP(value)[0] == '0')) {
+				return FAILURE;
+			}
+
+			ZVAL_STRINGL(result, Z_STRVAL_PP(value), Z_STRLEN_PP(value), 1);
+			convert_to_long(result);
+			return SUCCESS;
+
+		case 260:
+			if (zend_hash_find(Z_ARRVAL_P(expr), SS("value"), (void **) &value) == FAILURE || Z_TYPE_PP(value) != IS_STRING) {
+				return FAILURE;
+			}
+
+			/**
+			 * The scanner keeps the escape sequences of the literal, they're left to PHP
+			 */
+			if (memchr(Z_STRVAL_PP(value), '\\', Z_STRLEN_PP(value))) {
+				return FAILURE;
+			}
+
+			ZVAL_STRINGL(result, Z_STRVAL_PP(value), Z_STRLEN_PP(value), 1);
+			return SUCCESS;
+
+		case 356:
+			if (zend_hash_find(Z_ARRVAL_P(expr), SS("left"), (void **) &left) == FAILURE) {
+				return FAILURE;
+			}
+			return phalcon_mvc_view_engine_volt_compiler_fold(result, *left TSRMLS_CC);
+
+		case 367:
+			if (zend_hash_find(Z_ARRVAL_P(expr), SS("right"), (void **) &right) == FAILURE) {
+				return FAILURE;
+			}
+
+			INIT_ZVAL(right_value);
+			if (phalcon_mvc_view_engine_volt_compiler_fold(&right_value, *right TSRMLS_CC) == FAILURE) {
+				return FAILURE;
+			}
+
+			if (Z_TYPE(right_value) != IS_LONG) {
+				zval_dtor(&right_value);
+				return FAILURE;
+			}
+
+			ZVAL_LONG(result, -Z_LVAL(right_value));
+			return SUCCESS;
+
+		case 42:
+		case 43:
+		case 45:
+		case 126:
+			if (zend_hash_find(Z_ARRVAL_P(expr), SS("left"), (void **) &left) == FAILURE) {
+				return FAILURE;
+			}
+			if (zend_hash_find(Z_ARRVAL_P(expr), SS("right"), (void **) &right) == FAILURE) {
+				return FAILURE;
+			}
+
+			INIT_ZVAL(left_value);
+			if (phalcon_mvc_view_engine_volt_compiler_fold(&left_value, *left TSRMLS_CC) == FAILURE) {
+				return FAILURE;
+			}
+
+			INIT_ZVAL(right_value);
+			if (phalcon_mvc_view_engine_volt_compiler_fold(&right_value, *right TSRMLS_CC) == FAILURE) {
+				zval_dtor(&left_value);
+				return FAILURE;
+			}
+
+			status = FAILURE;
+			if (Z_LVAL_PP(type) == 126) {
+				if (concat_function(result, &left_value, &right_value TSRMLS_CC) == SUCCESS) {
+					status = SUCCESS;
+				}
+			} else {
+				if (Z_TYPE(left_value) == IS_LONG && Z_TYPE(right_value) == IS_LONG) {
+					switch (Z_LVAL_PP(type)) {
+						case 42:
+							mul_function(result, &left_value, &right_value TSRMLS_CC);
+							break;
+						case 43:
+							add_function(result, &left_value, &right_value TSRMLS_CC);
+							break;
+						default:
+							sub_function(result, &left_value, &right_value TSRMLS_CC);
+							break;
+					}
+
+					/**
+					 * Results that overflow to a double aren't folded
+					 */
+					if (Z_TYPE_P(result) == IS_LONG) {
+						status = SUCCESS;
+					} else {
+						zval_dtor(result);
+						ZVAL_NULL(result);
+					}
+				}
+			}
+
+			zval_dtor(&left_value);
+			zval_dtor(&right_value);
+			return status;
+
+		case 124:
+			/**
+			 * Only the length of ASCII strings is folded, it doesn't depend on the encoding used at runtime
+			 */
+			if (zend_hash_find(Z_ARRVAL_P(expr), SS("right"), (void **) &right) == FAILURE || Z_TYPE_PP(right) != IS_ARRAY) {
+				return FAILURE;
+			}
+			if (zend_hash_find(Z_ARRVAL_PP(right), SS("type"), (void **) &type) == FAILURE || Z_TYPE_PP(type) != IS_LONG || Z_LVAL_PP(type) != 265) {
+				return FAILURE;
+			}
+			if (zend_hash_find(Z_ARRVAL_PP(right), SS("value"), (void **) &name) == FAILURE || Z_TYPE_PP(name) != IS_STRING) {
+				return FAILURE;
+			}
+			if (Z_STRLEN_PP(name) != 6 || memcmp(Z_STRVAL_PP(name), "length", 6)) {
+				return FAILURE;
+			}
+			if (zend_hash_find(Z_ARRVAL_P(expr), SS("left"), (void **) &left) == FAILURE) {
+				return FAILURE;
+			}
+
+			INIT_ZVAL(left_value);
+			if (phalcon_mvc_view_engine_volt_compiler_fold(&left_value, *left TSRMLS_CC) == FAILURE) {
+				return FAILURE;
+			}
+			convert_to_string(&left_value);
+
+			status = SUCCESS;
+			for (i = 0; i < Z_STRLEN(left_value); i++) {
+				if ((unsigned char) Z_STRVAL(left_value)[i] > 127) {
+					status = FAILURE;
+					break;
+				}
+			}
+
+			if (status == SUCCESS) {
+				ZVAL_LONG(result, Z_STRLEN(left_value));
+			}
+
+			zval_dtor(&left_value);
+			return status;
+	}
+
+	return FAILURE;
+}
+
+/**
+ * Produces the PHP code of a value folded at compile time
+ */
+static void phalcon_mvc_view_engine_volt_compiler_literal(zval *code, zval *value){
+
+	smart_str literal = {0};
+	char *str;
+	int i;
+
+	if (Z_TYPE_P(value) == IS_LONG) {
+		smart_str_append_long(&literal, Z_LVAL_P(value));
+	} else {
+		str = Z_STRVAL_P(value);
+		smart_str_appendc(&literal, '\'');
+		for (i = 0; i < Z_STRLEN_P(value); i++) {
+			if (str[i] == '\'') {
+				smart_str_appendc(&literal, '\\');
+			}
+			smart_str_appendc(&literal, str[i]);
+		}
+		smart_str_appendc(&literal, '\'');
+	}
+	smart_str_0(&literal);
+
+	ZVAL_STRINGL(code, literal.c, literal.len, 0);
+}
+
+/**
+ * Prepends to a compiled template the code reading the services it uses, they are read once at the
+ * beginning of the template. The fragments of the 'cache' blocks with a literal key are fetched
+ * at the same time with a single getMany() per lifetime
+ */
+static void phalcon_mvc_view_engine_volt_compiler_bind(zval *result, zval *compiler, zval *compilation TSRMLS_DC){
+
+	zval *fragments, **keys, **key;
+	smart_str code = {0};
+	HashPosition hp0, hp1;
+	char *lifetime;
+	uint lifetime_length;
+	ulong lifetime_number;
+	int lifetime_type, first_group = 1, first_key;
+
+	if (Z_TYPE_P(compilation) != IS_STRING) {
+		ZVAL_ZVAL(result, compilation, 1, 0);
+		return;
+	}
+
+	if (phalcon_memnstr_str(compilation, SL("$__escaper->") TSRMLS_CC)) {
+		smart_str_appendl(&code, SL("<?php $__escaper = $this->escaper; ?>\n"));
+	}
+
+	if (phalcon_memnstr_str(compilation, SL("$__viewCache->") TSRMLS_CC)) {
+
+		smart_str_appendl(&code, SL("<?php $__viewCache = $this->di->get('viewCache'); $__viewFragments = "));
+
+		phalcon_read_property(&fragments, compiler, SL("_cacheFragments"), PH_NOISY_CC);
+		if (Z_TYPE_P(fragments) == IS_ARRAY && zend_hash_num_elements(Z_ARRVAL_P(fragments))) {
+
+			/**
+			 * Backends that only implement Phalcon\Cache\BackendInterface are read fragment by fragment
+			 */
+			smart_str_appendl(&code, SL("(method_exists($__viewCache, 'getMany') ? "));
+
+			zend_hash_internal_pointer_reset_ex(Z_ARRVAL_P(fragments), &hp0);
+			while (zend_hash_get_current_data_ex(Z_ARRVAL_P(fragments), (void**) &keys, &hp0) == SUCCESS) {
+
+				lifetime_type = zend_hash_get_current_key_ex(Z_ARRVAL_P(fragments), &lifetime, &lifetime_length, &lifetime_number, 0, &hp0);
+
+				if (!first_group) {
+					smart_str_appendl(&code, SL(" + "));
+				}
+				smart_str_appendl(&code, SL("$__viewCache->getMany(array("));
+
+				first_key = 1;
+				zend_hash_internal_pointer_reset_ex(Z_ARRVAL_PP(keys), &hp1);
+				while (zend_hash_get_current_data_ex(Z_ARRVAL_PP(keys), (void**) &key, &hp1) == SUCCESS) {
+					if (!first_key) {
+						smart_str_appendl(&code, SL(", "));
+					}
+					smart_str_appendl(&code, Z_STRVAL_PP(key), Z_STRLEN_PP(key));
+					first_key = 0;
+					zend_hash_move_forward_ex(Z_ARRVAL_PP(keys), &hp1);
+				}
+				smart_str_appendc(&code, ')');
+
+				if (lifetime_type == HASH_KEY_IS_LONG) {
+					smart_str_appendl(&code, SL(", "));
+					smart_str_append_unsigned(&code, lifetime_number);
+				} else {
+					if (lifetime_length > 1) {
+						smart_str_appendl(&code, SL(", "));
+						smart_str_appendl(&code, lifetime, lifetime_length - 1);
+					}
+				}
+				smart_str_appendc(&code, ')');
+
+				first_group = 0;
+				zend_hash_move_forward_ex(Z_ARRVAL_P(fragments), &hp0);
+			}
+
+			smart_str_appendl(&code, SL(" : array())"));
+		} else {
+			smart_str_appendl(&code, SL("array()"));
+		}
+		zval_ptr_dtor(&fragments);
+
+		smart_str_appendl(&code, SL("; ?>\n"));
+	}
+
+	if (!code.len) {
+		ZVAL_ZVAL(result, compilation, 1, 0);
+		return;
+	}
+
+	smart_str_appendl(&code, Z_STRVAL_P(compilation), Z_STRLEN_P(compilation));
+	smart_str_0(&code);
+
+	ZVAL_STRINGL(result, code.c, code.len, 0);
+}
+
 /**
  * Phalcon\Mvc\View\Engine\Volt\Compiler
  *
@@ -332,7 +673,8 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, attributeReader){
 	zval *expr, *expr_code, *loop_context, *left, *left_type;
 	zval *variable, *level, *prefix, *dependency_injector;
 	zval *is_service, *left_code, *right, *right_type;
-	zval *member, *right_code;
+	zval *member, *right_code, *loop_members = NULL, *loop_right;
+	zval *loop_right_type, *loop_member = NULL;
 
 	PHALCON_MM_GROW();
 
@@ -347,8 +689,6 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, attributeReader){
 	
 	PHALCON_INIT_VAR(expr_code);
 	
-	PHALCON_INIT_VAR(loop_context);
-	
 	PHALCON_OBS_VAR(left);
 	phalcon_array_fetch_string(&left, expr, SL("left"), PH_NOISY_CC);
 	
@@ -369,7 +709,36 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, attributeReader){
 			PHALCON_INIT_VAR(prefix);
 			PHALCON_CALL_METHOD(prefix, this_ptr, "getuniqueprefix");
 			PHALCON_SCONCAT_SVVS(expr_code, "$", prefix, level, "loop");
-			phalcon_update_property_array(this_ptr, SL("_loopPointers"), level, level TSRMLS_CC);
+	
+			/** 
+			 * Register which members of the loop context are read, so the 'foreach' only
+			 * generates the bookkeeping it really needs. Dynamic members require all of them
+			 */
+			PHALCON_OBS_VAR(loop_context);
+			phalcon_read_property(&loop_context, this_ptr, SL("_loopPointers"), PH_NOISY_CC);
+			if (phalcon_array_isset(loop_context, level)) {
+				PHALCON_OBS_VAR(loop_members);
+				phalcon_array_fetch(&loop_members, loop_context, level, PH_NOISY_CC);
+			} else {
+				PHALCON_INIT_VAR(loop_members);
+				array_init(loop_members);
+			}
+	
+			PHALCON_OBS_VAR(loop_right);
+			phalcon_array_fetch_string(&loop_right, expr, SL("right"), PH_NOISY_CC);
+	
+			PHALCON_OBS_VAR(loop_right_type);
+			phalcon_array_fetch_string(&loop_right_type, loop_right, SL("type"), PH_NOISY_CC);
+			if (PHALCON_IS_LONG(loop_right_type, 265)) {
+				PHALCON_OBS_VAR(loop_member);
+				phalcon_array_fetch_string(&loop_member, loop_right, SL("value"), PH_NOISY_CC);
+			} else {
+				PHALCON_INIT_VAR(loop_member);
+				ZVAL_STRING(loop_member, "*", 1);
+			}
+	
+			phalcon_array_update_zval_bool(&loop_members, loop_member, 1, PH_SEPARATE TSRMLS_CC);
+			phalcon_update_property_array(this_ptr, SL("_loopPointers"), level, loop_members TSRMLS_CC);
 		} else {
 			/** 
 			 * Services registered in the dependency injector container are availables always
@@ -1039,7 +1408,11 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, resolveFilter){
 	 */
 	if (PHALCON_IS_STRING(name, "e")) {
 		PHALCON_INIT_NVAR(code);
-		PHALCON_CONCAT_SVS(code, "$this->escaper->escapeHtml(", arguments, ")");
+		if (phalcon_mvc_view_engine_volt_compiler_native_escape(this_ptr TSRMLS_CC)) {
+			PHALCON_CONCAT_SVS(code, "htmlspecialchars(", arguments, ", ENT_QUOTES, 'utf-8')");
+		} else {
+			PHALCON_CONCAT_SVS(code, "$__escaper->escapeHtml(", arguments, ")");
+		}
 		RETURN_CCTOR(code);
 	}
 	
@@ -1048,7 +1421,11 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, resolveFilter){
 	 */
 	if (PHALCON_IS_STRING(name, "escape")) {
 		PHALCON_INIT_NVAR(code);
-		PHALCON_CONCAT_SVS(code, "$this->escaper->escapeHtml(", arguments, ")");
+		if (phalcon_mvc_view_engine_volt_compiler_native_escape(this_ptr TSRMLS_CC)) {
+			PHALCON_CONCAT_SVS(code, "htmlspecialchars(", arguments, ", ENT_QUOTES, 'utf-8')");
+		} else {
+			PHALCON_CONCAT_SVS(code, "$__escaper->escapeHtml(", arguments, ")");
+		}
 		RETURN_CCTOR(code);
 	}
 	
@@ -1057,7 +1434,7 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, resolveFilter){
 	 */
 	if (PHALCON_IS_STRING(name, "escape_css")) {
 		PHALCON_INIT_NVAR(code);
-		PHALCON_CONCAT_SVS(code, "$this->escaper->escapeCss(", arguments, ")");
+		PHALCON_CONCAT_SVS(code, "$__escaper->escapeCss(", arguments, ")");
 		RETURN_CCTOR(code);
 	}
 	
@@ -1066,7 +1443,7 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, resolveFilter){
 	 */
 	if (PHALCON_IS_STRING(name, "escape_js")) {
 		PHALCON_INIT_NVAR(code);
-		PHALCON_CONCAT_SVS(code, "$this->escaper->escapeJs(", arguments, ")");
+		PHALCON_CONCAT_SVS(code, "$__escaper->escapeJs(", arguments, ")");
 		RETURN_CCTOR(code);
 	}
 	
@@ -1075,7 +1452,7 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, resolveFilter){
 	 */
 	if (PHALCON_IS_STRING(name, "escape_attr")) {
 		PHALCON_INIT_NVAR(code);
-		PHALCON_CONCAT_SVS(code, "$this->escaper->escapeHtmlAttr(", arguments, ")");
+		PHALCON_CONCAT_SVS(code, "$__escaper->escapeHtmlAttr(", arguments, ")");
 		RETURN_CCTOR(code);
 	}
 	
@@ -1157,7 +1534,11 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, resolveFilter){
 	 */
 	if (PHALCON_IS_STRING(name, "lowercase")) {
 		PHALCON_INIT_NVAR(code);
-		PHALCON_CONCAT_SVS(code, "Phalcon\\Text::lower(", arguments, ")");
+		if (phalcon_function_exists_ex(SS("mb_strtolower") TSRMLS_CC) == SUCCESS) {
+			PHALCON_CONCAT_SVS(code, "mb_strtolower(", arguments, ")");
+		} else {
+			PHALCON_CONCAT_SVS(code, "strtolower(", arguments, ")");
+		}
 		RETURN_CCTOR(code);
 	}
 	
@@ -1167,7 +1548,11 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, resolveFilter){
 	 */
 	if (PHALCON_IS_STRING(name, "lower")) {
 		PHALCON_INIT_NVAR(code);
-		PHALCON_CONCAT_SVS(code, "Phalcon\\Text::lower(", arguments, ")");
+		if (phalcon_function_exists_ex(SS("mb_strtolower") TSRMLS_CC) == SUCCESS) {
+			PHALCON_CONCAT_SVS(code, "mb_strtolower(", arguments, ")");
+		} else {
+			PHALCON_CONCAT_SVS(code, "strtolower(", arguments, ")");
+		}
 		RETURN_CCTOR(code);
 	}
 	
@@ -1177,7 +1562,11 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, resolveFilter){
 	 */
 	if (PHALCON_IS_STRING(name, "uppercase")) {
 		PHALCON_INIT_NVAR(code);
-		PHALCON_CONCAT_SVS(code, "Phalcon\\Text::upper(", arguments, ")");
+		if (phalcon_function_exists_ex(SS("mb_strtoupper") TSRMLS_CC) == SUCCESS) {
+			PHALCON_CONCAT_SVS(code, "mb_strtoupper(", arguments, ")");
+		} else {
+			PHALCON_CONCAT_SVS(code, "strtoupper(", arguments, ")");
+		}
 		RETURN_CCTOR(code);
 	}
 	
@@ -1187,7 +1576,11 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, resolveFilter){
 	 */
 	if (PHALCON_IS_STRING(name, "upper")) {
 		PHALCON_INIT_NVAR(code);
-		PHALCON_CONCAT_SVS(code, "Phalcon\\Text::upper(", arguments, ")");
+		if (phalcon_function_exists_ex(SS("mb_strtoupper") TSRMLS_CC) == SUCCESS) {
+			PHALCON_CONCAT_SVS(code, "mb_strtoupper(", arguments, ")");
+		} else {
+			PHALCON_CONCAT_SVS(code, "strtoupper(", arguments, ")");
+		}
 		RETURN_CCTOR(code);
 	}
 	
@@ -1269,7 +1662,11 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, resolveFilter){
 	 */
 	if (PHALCON_IS_STRING(name, "convert_encoding")) {
 		PHALCON_INIT_NVAR(code);
-		PHALCON_CONCAT_SVS(code, "$this->convertEncoding(", arguments, ")");
+		if (phalcon_function_exists_ex(SS("mb_convert_encoding") TSRMLS_CC) == SUCCESS) {
+			PHALCON_CONCAT_SVS(code, "mb_convert_encoding(", arguments, ")");
+		} else {
+			PHALCON_CONCAT_SVS(code, "$this->convertEncoding(", arguments, ")");
+		}
 		RETURN_CCTOR(code);
 	}
 	
@@ -1302,9 +1699,11 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, expression){
 	zval *single_quote = NULL, *escaped_quoute = NULL, *escaped_string = NULL;
 	zval *start = NULL, *start_code = NULL, *end = NULL, *end_code = NULL, *ternary = NULL;
 	zval *ternary_code = NULL, *line = NULL, *file = NULL, *exception_message = NULL;
+	zval *folded = NULL, *filter_type = NULL, *filter_name = NULL;
 	HashTable *ah0;
 	HashPosition hp0;
 	zval **hd;
+	int is_folded = 0;
 
 	PHALCON_MM_GROW();
 
@@ -1325,7 +1724,11 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, expression){
 	
 	while (1) {
 	
-		if (!phalcon_array_isset_string(expr, SS("type"))) {
+		/** 
+		 * Nodes without type are lists of expressions
+		 */
+		PHALCON_OBS_NVAR(type);
+		if (phalcon_array_fetch_quick_string(&type, expr, SS("type"), phvolt_key_type, PH_SILENT_CC) == FAILURE) {
 	
 			PHALCON_INIT_NVAR(items);
 			array_init(items);
@@ -1362,8 +1765,29 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, expression){
 			break;
 		}
 	
-		PHALCON_OBS_NVAR(type);
-		phalcon_array_fetch_string(&type, expr, SL("type"), PH_NOISY_CC);
+		/** 
+		 * Expressions made only of literals are evaluated at compile time
+		 */
+		switch (phalcon_get_intval(type)) {
+			case 42:
+			case 43:
+			case 45:
+			case 124:
+			case 126:
+			case 356:
+			case 367:
+				PHALCON_INIT_NVAR(folded);
+				if (phalcon_mvc_view_engine_volt_compiler_fold(folded, expr TSRMLS_CC) == SUCCESS) {
+					PHALCON_INIT_NVAR(expr_code);
+					phalcon_mvc_view_engine_volt_compiler_literal(expr_code, folded);
+					is_folded = 1;
+				}
+				break;
+		}
+	
+		if (is_folded) {
+			break;
+		}
 	
 		/** 
 		 * Attribute reading needs special handling
@@ -1377,10 +1801,8 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, expression){
 		/** 
 		 * Left part of expression is always resolved
 		 */
-		if (phalcon_array_isset_string(expr, SS("left"))) {
-			PHALCON_OBS_NVAR(left);
-			phalcon_array_fetch_string(&left, expr, SL("left"), PH_NOISY_CC);
-	
+		PHALCON_OBS_NVAR(left);
+		if (phalcon_array_fetch_quick_string(&left, expr, SS("left"), phvolt_key_left, PH_SILENT_CC) == SUCCESS) {
 			PHALCON_INIT_NVAR(left_code);
 			PHALCON_CALL_METHOD_PARAMS_1(left_code, this_ptr, "expression", left);
 		}
@@ -1404,6 +1826,27 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, expression){
 			PHALCON_OBS_NVAR(right_code);
 			phalcon_array_fetch_string(&right_code, expr, SL("right"), PH_NOISY_CC);
 	
+			/** 
+			 * The length of an array literal is always a count
+			 */
+			if (phalcon_array_isset_string(left, SS("type"))) {
+				PHALCON_OBS_NVAR(filter_type);
+				phalcon_array_fetch_string(&filter_type, left, SL("type"), PH_NOISY_CC);
+				if (PHALCON_IS_LONG(filter_type, 360)) {
+					PHALCON_OBS_NVAR(filter_type);
+					phalcon_array_fetch_string(&filter_type, right_code, SL("type"), PH_NOISY_CC);
+					if (PHALCON_IS_LONG(filter_type, 265)) {
+						PHALCON_OBS_NVAR(filter_name);
+						phalcon_array_fetch_string(&filter_name, right_code, SL("value"), PH_NOISY_CC);
+						if (PHALCON_IS_STRING(filter_name, "length")) {
+							PHALCON_INIT_NVAR(expr_code);
+							PHALCON_CONCAT_SVS(expr_code, "count(", left_code, ")");
+							break;
+						}
+					}
+				}
+			}
+	
 			PHALCON_INIT_NVAR(expr_code);
 			PHALCON_CALL_METHOD_PARAMS_2(expr_code, this_ptr, "resolvefilter", right_code, left_code);
 			break;
@@ -1412,10 +1855,8 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, expression){
 		/** 
 		 * From here, right part of expression is always resolved
 		 */
-		if (phalcon_array_isset_string(expr, SS("right"))) {
-			PHALCON_OBS_NVAR(right);
-			phalcon_array_fetch_string(&right, expr, SL("right"), PH_NOISY_CC);
-	
+		PHALCON_OBS_NVAR(right);
+		if (phalcon_array_fetch_quick_string(&right, expr, SS("right"), phvolt_key_right, PH_SILENT_CC) == SUCCESS) {
 			PHALCON_INIT_NVAR(right_code);
 			PHALCON_CALL_METHOD_PARAMS_1(right_code, this_ptr, "expression", right);
 		}
@@ -1765,7 +2206,10 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileForeach){
 	zval *prefix, *level, *prefix_level, *expr, *expr_code;
 	zval *block_statements, *for_else = NULL, *bstatement = NULL;
 	zval *type = NULL, *code, *loop_context, *iterator = NULL, *variable;
-	zval *key, *if_expr, *if_expr_code;
+	zval *key, *if_expr, *if_expr_code = NULL, *loop_members = NULL;
+	zval *for_else_pointer;
+	int all_members, use_first, use_index, use_index0, use_revindex;
+	int use_revindex0, use_last, use_length;
 	HashTable *ah0;
 	HashPosition hp0;
 	zval **hd;
@@ -1806,6 +2250,18 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileForeach){
 	PHALCON_INIT_VAR(expr_code);
 	PHALCON_CALL_METHOD_PARAMS_1(expr_code, this_ptr, "expression", expr);
 	
+	/** 
+	 * The 'if' expr can read the loop context too, it's compiled before the block so the
+	 * 'forelse' already knows if the loop context is used
+	 */
+	if (phalcon_array_isset_string(statement, SS("if_expr"))) {
+		PHALCON_OBS_VAR(if_expr);
+		phalcon_array_fetch_string(&if_expr, statement, SL("if_expr"), PH_NOISY_CC);
+	
+		PHALCON_INIT_VAR(if_expr_code);
+		PHALCON_CALL_METHOD_PARAMS_1(if_expr_code, this_ptr, "expression", if_expr);
+	}
+	
 	/** 
 	 * Process the block statements
 	 */
@@ -1840,7 +2296,15 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileForeach){
 			if (PHALCON_IS_LONG(type, 321)) {
 				PHALCON_SCONCAT_SVS(compilation, "<?php $", prefix_level, "iterated = false; ?>");
 				PHALCON_CPY_WRT(for_else, prefix_level);
-				phalcon_update_property_array(this_ptr, SL("_forElsePointers"), level, for_else TSRMLS_CC);
+	
+				/** 
+				 * The 'forelse' must also close the 'if' expr before leaving the loop
+				 */
+				PHALCON_INIT_VAR(for_else_pointer);
+				array_init_size(for_else_pointer, 2);
+				phalcon_array_append(&for_else_pointer, prefix_level, PH_SEPARATE TSRMLS_CC);
+				add_next_index_bool(for_else_pointer, if_expr_code != NULL);
+				phalcon_update_property_array(this_ptr, SL("_forElsePointers"), level, for_else_pointer TSRMLS_CC);
 				break;
 			}
 	
@@ -1859,20 +2323,42 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileForeach){
 	phalcon_read_property(&loop_context, this_ptr, SL("_loopPointers"), PH_NOISY_CC);
 	
 	/** 
-	 * Generate the loop context for the 'foreach'
+	 * Only the members of the loop context read in the block are calculated.
+	 * The iterator is only counted if 'length', 'revindex', 'revindex0' or 'last' are used
 	 */
+	use_first = use_index = use_index0 = use_revindex = use_revindex0 = use_last = use_length = 0;
 	if (phalcon_array_isset(loop_context, level)) {
-		PHALCON_SCONCAT_SVSVS(compilation, "<?php $", prefix_level, "iterator = ", expr_code, "; ");
-		PHALCON_SCONCAT_SVS(compilation, "$", prefix_level, "incr = 0; ");
-		PHALCON_SCONCAT_SVS(compilation, "$", prefix_level, "loop = new stdClass(); ");
-		PHALCON_SCONCAT_SVSVS(compilation, "$", prefix_level, "loop->length = count($", prefix_level, "iterator); ");
-		PHALCON_SCONCAT_SVS(compilation, "$", prefix_level, "loop->index = 1; ");
-		PHALCON_SCONCAT_SVS(compilation, "$", prefix_level, "loop->index0 = 1; ");
-		PHALCON_SCONCAT_SVSVS(compilation, "$", prefix_level, "loop->revindex = $", prefix_level, "loop->length; ");
-		PHALCON_SCONCAT_SVSVS(compilation, "$", prefix_level, "loop->revindex0 = $", prefix_level, "loop->length - 1; ?>");
-	
-		PHALCON_INIT_VAR(iterator);
-		PHALCON_CONCAT_SVS(iterator, "$", prefix_level, "iterator");
+	
+		PHALCON_OBS_VAR(loop_members);
+		phalcon_array_fetch(&loop_members, loop_context, level, PH_NOISY_CC);
+	
+		all_members = phalcon_array_isset_string(loop_members, SS("*"));
+		use_first = all_members || phalcon_array_isset_string(loop_members, SS("first"));
+		use_index = all_members || phalcon_array_isset_string(loop_members, SS("index"));
+		use_index0 = all_members || phalcon_array_isset_string(loop_members, SS("index0"));
+		use_revindex = all_members || phalcon_array_isset_string(loop_members, SS("revindex"));
+		use_revindex0 = all_members || phalcon_array_isset_string(loop_members, SS("revindex0"));
+		use_last = all_members || phalcon_array_isset_string(loop_members, SS("last"));
+		use_length = use_revindex || use_revindex0 || use_last || phalcon_array_isset_string(loop_members, SS("length"));
+	}
+	
+	/** 
+	 * Generate the loop context for the 'foreach'
+	 */
+	if (loop_members) {
+		if (use_length) {
+			PHALCON_SCONCAT_SVSVS(compilation, "<?php $", prefix_level, "iterator = ", expr_code, "; ");
+			PHALCON_SCONCAT_SVS(compilation, "$", prefix_level, "incr = 0; ");
+			PHALCON_SCONCAT_SVS(compilation, "$", prefix_level, "loop = new stdClass(); ");
+			PHALCON_SCONCAT_SVSVS(compilation, "$", prefix_level, "loop->length = count($", prefix_level, "iterator); ?>");
+	
+			PHALCON_INIT_VAR(iterator);
+			PHALCON_CONCAT_SVS(iterator, "$", prefix_level, "iterator");
+		} else {
+			PHALCON_SCONCAT_SVS(compilation, "<?php $", prefix_level, "incr = 0; ");
+			PHALCON_SCONCAT_SVS(compilation, "$", prefix_level, "loop = new stdClass(); ?>");
+			PHALCON_CPY_WRT(iterator, expr_code);
+		}
 	} else {
 		PHALCON_CPY_WRT(iterator, expr_code);
 	}
@@ -1895,29 +2381,34 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileForeach){
 	}
 	
 	/** 
-	 * Check for an 'if' expr in the block
+	 * Generate the loop context inside the cycle, before the 'if' expr is evaluated
 	 */
-	if (phalcon_array_isset_string(statement, SS("if_expr"))) {
-		PHALCON_OBS_VAR(if_expr);
-		phalcon_array_fetch_string(&if_expr, statement, SL("if_expr"), PH_NOISY_CC);
-	
-		PHALCON_INIT_VAR(if_expr_code);
-		PHALCON_CALL_METHOD_PARAMS_1(if_expr_code, this_ptr, "expression", if_expr);
-		PHALCON_SCONCAT_SVS(compilation, "if (", if_expr_code, ") { ?>");
-	} else {
-		phalcon_concat_self_str(&compilation, SL("?>") TSRMLS_CC);
+	if (use_first) {
+		PHALCON_SCONCAT_SVSVS(compilation, "$", prefix_level, "loop->first = ($", prefix_level, "incr == 0); ");
 	}
-	
-	/** 
-	 * Generate the loop context inside the cycle
-	 */
-	if (phalcon_array_isset(loop_context, level)) {
-		PHALCON_SCONCAT_SVSVS(compilation, "<?php $", prefix_level, "loop->first = ($", prefix_level, "incr == 0); ");
+	if (use_index) {
 		PHALCON_SCONCAT_SVSVS(compilation, "$", prefix_level, "loop->index = $", prefix_level, "incr + 1; ");
+	}
+	if (use_index0) {
 		PHALCON_SCONCAT_SVSVS(compilation, "$", prefix_level, "loop->index0 = $", prefix_level, "incr; ");
+	}
+	if (use_revindex) {
 		PHALCON_SCONCAT_SVSVSVS(compilation, "$", prefix_level, "loop->revindex = $", prefix_level, "loop->length - $", prefix_level, "incr; ");
+	}
+	if (use_revindex0) {
 		PHALCON_SCONCAT_SVSVSVS(compilation, "$", prefix_level, "loop->revindex0 = $", prefix_level, "loop->length - ($", prefix_level, "incr + 1); ");
-		PHALCON_SCONCAT_SVSVSVS(compilation, "$", prefix_level, "loop->last = ($", prefix_level, "incr == ($", prefix_level, "loop->length - 1)); ?>");
+	}
+	if (use_last) {
+		PHALCON_SCONCAT_SVSVSVS(compilation, "$", prefix_level, "loop->last = ($", prefix_level, "incr == ($", prefix_level, "loop->length - 1)); ");
+	}
+	
+	/** 
+	 * Check for an 'if' expr in the block
+	 */
+	if (if_expr_code) {
+		PHALCON_SCONCAT_SVS(compilation, "if (", if_expr_code, ") { ?>");
+	} else {
+		phalcon_concat_self_str(&compilation, SL("?>") TSRMLS_CC);
 	}
 	
 	/** 
@@ -1931,20 +2422,30 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileForeach){
 	 * Append the internal block compilation
 	 */
 	phalcon_concat_self(&compilation, code TSRMLS_CC);
-	if (phalcon_array_isset_string(statement, SS("if_expr"))) {
-		phalcon_concat_self_str(&compilation, SL("<?php } ?>") TSRMLS_CC);
-	}
 	
+	/** 
+	 * The 'forelse' already closed the 'if' expr and the loop, only its own block is left
+	 */
 	if (Z_TYPE_P(for_else) == IS_STRING) {
 		phalcon_concat_self_str(&compilation, SL("<?php } ?>") TSRMLS_CC);
 	} else {
-		if (phalcon_array_isset(loop_context, level)) {
+		if (if_expr_code) {
+			phalcon_concat_self_str(&compilation, SL("<?php } ?>") TSRMLS_CC);
+		}
+		if (loop_members) {
 			PHALCON_SCONCAT_SVS(compilation, "<?php $", prefix_level, "incr++; } ?>");
 		} else {
 			phalcon_concat_self_str(&compilation, SL("<?php } ?>") TSRMLS_CC);
 		}
 	}
 	
+	/** 
+	 * The next 'foreach' in the same level has its own loop context
+	 */
+	if (loop_members) {
+		phalcon_unset_property_array(this_ptr, SL("_loopPointers"), level TSRMLS_CC);
+	}
+	
 	phalcon_property_decr(this_ptr, SL("_foreachLevel") TSRMLS_CC);
 	
 	RETURN_CTOR(compilation);
@@ -1957,8 +2458,8 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileForeach){
  */
 PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileForElse){
 
-	zval *level, *for_else_pointers, *prefix, *loop_context;
-	zval *compilation = NULL;
+	zval *level, *for_else_pointers, *for_else_pointer, *prefix;
+	zval *if_expr, *loop_context, *compilation;
 
 	PHALCON_MM_GROW();
 
@@ -1969,19 +2470,32 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileForElse){
 	phalcon_read_property(&for_else_pointers, this_ptr, SL("_forElsePointers"), PH_NOISY_CC);
 	if (phalcon_array_isset(for_else_pointers, level)) {
 	
+		PHALCON_OBS_VAR(for_else_pointer);
+		phalcon_array_fetch(&for_else_pointer, for_else_pointers, level, PH_NOISY_CC);
+	
 		PHALCON_OBS_VAR(prefix);
-		phalcon_array_fetch(&prefix, for_else_pointers, level, PH_NOISY_CC);
+		phalcon_array_fetch_long(&prefix, for_else_pointer, 0, PH_NOISY_CC);
+	
+		PHALCON_OBS_VAR(if_expr);
+		phalcon_array_fetch_long(&if_expr, for_else_pointer, 1, PH_NOISY_CC);
+	
+		PHALCON_INIT_VAR(compilation);
+		ZVAL_STRING(compilation, "<?php ", 1);
+	
+		/** 
+		 * The 'if' expr is closed first, the loop context is incremented on every iteration
+		 */
+		if (zend_is_true(if_expr)) {
+			phalcon_concat_self_str(&compilation, SL("} ") TSRMLS_CC);
+		}
 	
 		PHALCON_OBS_VAR(loop_context);
 		phalcon_read_property(&loop_context, this_ptr, SL("_loopPointers"), PH_NOISY_CC);
 		if (phalcon_array_isset(loop_context, level)) {
-			PHALCON_INIT_VAR(compilation);
-			PHALCON_CONCAT_SVSVS(compilation, "<?php $", prefix, "incr++; } if (!$", prefix, "iterated) { ?>");
-		} else {
-			PHALCON_INIT_NVAR(compilation);
-			PHALCON_CONCAT_SVS(compilation, "<?php } if (!$", prefix, "iterated) { ?>");
+			PHALCON_SCONCAT_SVS(compilation, "$", prefix, "incr++; ");
 		}
 	
+		PHALCON_SCONCAT_SVS(compilation, "} if (!$", prefix, "iterated) { ?>");
 	
 		RETURN_CTOR(compilation);
 	}
@@ -2082,7 +2596,8 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileCache){
 
 	zval *statement, *extends_mode = NULL, *compilation;
 	zval *expr, *expr_code, *lifetime = NULL, *block_statements;
-	zval *code;
+	zval *code, *expr_type, *fragments, *group = NULL;
+	int is_literal;
 
 	PHALCON_MM_GROW();
 
@@ -2106,22 +2621,59 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileCache){
 	PHALCON_INIT_VAR(expr_code);
 	PHALCON_CALL_METHOD_PARAMS_1(expr_code, this_ptr, "expression", expr);
 	
-	/** 
-	 * Cache statement
-	 */
-	PHALCON_SCONCAT_SVS(compilation, "<?php $_cache[", expr_code, "] = $this->di->get('viewCache'); ");
 	if (phalcon_array_isset_string(statement, SS("lifetime"))) {
 		PHALCON_OBS_VAR(lifetime);
 		phalcon_array_fetch_string(&lifetime, statement, SL("lifetime"), PH_NOISY_CC);
-		PHALCON_SCONCAT_SVS(compilation, "$_cacheKey[", expr_code, "]");
-		PHALCON_SCONCAT_SVSVSVS(compilation, " = $_cache[", expr_code, "]->start(", expr_code, ", ", lifetime, "); ");
 	} else {
-		PHALCON_SCONCAT_SVSVSVS(compilation, "$_cacheKey[", expr_code, "] = $_cache[", expr_code, "]->start(", expr_code, "); ");
+		PHALCON_INIT_VAR(lifetime);
+		ZVAL_STRING(lifetime, "", 1);
 	}
 	
-	PHALCON_SCONCAT_SVS(compilation, "if ($_cacheKey[", expr_code, "] === null) { ?>");
 	/** 
-	 * Get the code in the block
+	 * The cache service is read once per template in $__viewCache. Literal keys are fetched
+	 * in advance at the beginning of the template and grouped by lifetime
+	 */
+	PHALCON_OBS_VAR(expr_type);
+	phalcon_array_fetch_string(&expr_type, expr, SL("type"), PH_NOISY_CC);
+	is_literal = PHALCON_IS_LONG(expr_type, 260) || PHALCON_IS_LONG(expr_type, 258);
+	if (is_literal) {
+	
+		PHALCON_OBS_VAR(fragments);
+		phalcon_read_property(&fragments, this_ptr, SL("_cacheFragments"), PH_NOISY_CC);
+		if (phalcon_array_isset(fragments, lifetime)) {
+			PHALCON_OBS_VAR(group);
+			phalcon_array_fetch(&group, fragments, lifetime, PH_NOISY_CC);
+		} else {
+			PHALCON_INIT_VAR(group);
+			array_init(group);
+		}
+	
+		phalcon_array_update_zval(&group, expr_code, &expr_code, PH_COPY | PH_SEPARATE TSRMLS_CC);
+		phalcon_update_property_array(this_ptr, SL("_cacheFragments"), lifetime, group TSRMLS_CC);
+	
+		PHALCON_SCONCAT_SVSVSVS(compilation, "<?php $_cacheKey[", expr_code, "] = (array_key_exists(", expr_code, ", $__viewFragments) ? $__viewFragments[", expr_code, "] : ");
+	} else {
+		PHALCON_SCONCAT_SVS(compilation, "<?php $_cacheKey[", expr_code, "] = ");
+	}
+	
+	if (zend_is_true(lifetime)) {
+		PHALCON_SCONCAT_SVSVS(compilation, "$__viewCache->get(", expr_code, ", ", lifetime, ")");
+	} else {
+		PHALCON_SCONCAT_SVS(compilation, "$__viewCache->get(", expr_code, ")");
+	}
+	if (is_literal) {
+		phalcon_concat_self_str(&compilation, SL("); ") TSRMLS_CC);
+	} else {
+		phalcon_concat_self_str(&compilation, SL("; ") TSRMLS_CC);
+	}
+	
+	/** 
+	 * Fragments are buffered by the template, so nested 'cache' blocks can share the backend
+	 */
+	PHALCON_SCONCAT_SVS(compilation, "if ($_cacheKey[", expr_code, "] === null) { ob_start(); ?>");
+	
+	/** 
+	 * Get the code in the block
 	 */
 	PHALCON_OBS_VAR(block_statements);
 	phalcon_array_fetch_string(&block_statements, statement, SL("block_statements"), PH_NOISY_CC);
@@ -2130,20 +2682,20 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileCache){
 	PHALCON_CALL_METHOD_PARAMS_2(code, this_ptr, "_statementlist", block_statements, extends_mode);
 	phalcon_concat_self(&compilation, code TSRMLS_CC);
 	
+	PHALCON_SCONCAT_SVS(compilation, "<?php $_cacheKey[", expr_code, "] = ob_get_clean(); ");
+	
 	/** 
 	 * Check if the cache has a lifetime
 	 */
-	if (phalcon_array_isset_string(statement, SS("lifetime"))) {
-		PHALCON_OBS_NVAR(lifetime);
-		phalcon_array_fetch_string(&lifetime, statement, SL("lifetime"), PH_NOISY_CC);
-		PHALCON_SCONCAT_SVSVSVS(compilation, "<?php $_cache[", expr_code, "]->save(", expr_code, ", null, ", lifetime, "); ");
-		PHALCON_SCONCAT_SVS(compilation, "} else { echo $_cacheKey[", expr_code, "]; } ?>");
+	if (zend_is_true(lifetime)) {
+		PHALCON_SCONCAT_SVSVSVS(compilation, "$__viewCache->save(", expr_code, ", $_cacheKey[", expr_code, "], ", lifetime, ", false); ");
 	} else {
-		PHALCON_SCONCAT_SVSVSVS(compilation, "<?php $_cache[", expr_code, "]->save(", expr_code, "); } else { echo $_cacheKey[", expr_code, "]; } ?>");
+		PHALCON_SCONCAT_SVSVS(compilation, "$__viewCache->save(", expr_code, ", $_cacheKey[", expr_code, "], null, false); ");
 	}
 	
+	PHALCON_SCONCAT_SVS(compilation, "} echo $_cacheKey[", expr_code, "]; ?>");
 	
-	RETURN_CCTOR(compilation);
+	RETURN_CTOR(compilation);
 }
 
 PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileEcho){
@@ -2199,7 +2751,11 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileEcho){
 	PHALCON_OBS_VAR(autoescape);
 	phalcon_read_property(&autoescape, this_ptr, SL("_autoescape"), PH_NOISY_CC);
 	if (zend_is_true(autoescape)) {
-		PHALCON_SCONCAT_SVS(compilation, "<?php echo $this->escaper->escapeHtml(", expr_code, "); ?>");
+		if (phalcon_mvc_view_engine_volt_compiler_native_escape(this_ptr TSRMLS_CC)) {
+			PHALCON_SCONCAT_SVS(compilation, "<?php echo htmlspecialchars(", expr_code, ", ENT_QUOTES, 'utf-8'); ?>");
+		} else {
+			PHALCON_SCONCAT_SVS(compilation, "<?php echo $__escaper->escapeHtml(", expr_code, "); ?>");
+		}
 	} else {
 		PHALCON_SCONCAT_SVS(compilation, "<?php echo ", expr_code, "; ?>");
 	}
@@ -2421,7 +2977,8 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, _statementList){
 		/** 
 		 * Check if the statement is valid
 		 */
-		if (!phalcon_array_isset_string(statement, SS("type"))) {
+		PHALCON_OBS_NVAR(type);
+		if (phalcon_array_fetch_quick_string(&type, statement, SS("type"), phvolt_key_type, PH_SILENT_CC) == FAILURE) {
 			PHALCON_OBS_NVAR(line);
 			phalcon_array_fetch_string(&line, statement, SL("line"), PH_NOISY_CC);
 	
@@ -2434,9 +2991,6 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, _statementList){
 			return;
 		}
 	
-		PHALCON_OBS_NVAR(type);
-		phalcon_array_fetch_string(&type, statement, SL("type"), PH_NOISY_CC);
-	
 		switch (phalcon_get_intval(type)) {
 	
 			case 357:
@@ -2444,7 +2998,7 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, _statementList){
 				 * Raw output statement
 				 */
 				PHALCON_OBS_NVAR(temp_compilation);
-				phalcon_array_fetch_string(&temp_compilation, statement, SL("value"), PH_NOISY_CC);
+				phalcon_array_fetch_quick_string(&temp_compilation, statement, SS("value"), phvolt_key_value, PH_NOISY_CC);
 				phalcon_concat_self(&compilation, temp_compilation TSRMLS_CC);
 				break;
 	
@@ -2671,6 +3225,7 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, _compileSource){
 	zval *intermediate, *compilation, *extended;
 	zval *final_compilation = NULL, *blocks = NULL, *extended_blocks;
 	zval *block = NULL, *name = NULL, *local_block = NULL, *block_compilation = NULL;
+	zval *bound_compilation;
 	HashTable *ah0;
 	HashPosition hp0;
 	zval **hd;
@@ -2699,6 +3254,11 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, _compileSource){
 	 */
 	if (Z_TYPE_P(intermediate) == IS_ARRAY) { 
 	
+		/** 
+		 * Every template fetches its own cache fragments
+		 */
+		phalcon_update_property_null(this_ptr, SL("_cacheFragments") TSRMLS_CC);
+	
 		PHALCON_INIT_VAR(compilation);
 		PHALCON_CALL_METHOD_PARAMS_2(compilation, this_ptr, "_statementlist", intermediate, extends_mode);
 	
@@ -2791,7 +3351,10 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, _compileSource){
 			}
 	
 	
-			RETURN_CCTOR(final_compilation);
+			PHALCON_INIT_VAR(bound_compilation);
+			phalcon_mvc_view_engine_volt_compiler_bind(bound_compilation, this_ptr, final_compilation TSRMLS_CC);
+	
+			RETURN_CTOR(bound_compilation);
 		}
 	
 		if (PHALCON_IS_TRUE(extends_mode)) {
@@ -2803,8 +3366,13 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, _compileSource){
 			RETURN_CCTOR(blocks);
 		}
 	
+		/** 
+		 * The services used by the template are read once at the beginning of it
+		 */
+		PHALCON_INIT_VAR(bound_compilation);
+		phalcon_mvc_view_engine_volt_compiler_bind(bound_compilation, this_ptr, compilation TSRMLS_CC);
 	
-		RETURN_CCTOR(compilation);
+		RETURN_CTOR(bound_compilation);
 	}
 	
 	PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_view_exception_ce, "Invalid intermediate representation");
@@ -2853,6 +3421,25 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileString){
 	RETURN_CCTOR(compilation);
 }
 
+/**
+ * Removes the temporary file of a failed compilation if it was created, no warning is raised
+ * when it doesn't exist
+ */
+static void phalcon_mvc_view_engine_volt_compiler_unlink(zval *path TSRMLS_DC){
+
+	php_stream_wrapper *wrapper;
+	char *path_to_open = NULL;
+
+	if (phalcon_file_exists(path TSRMLS_CC) == FAILURE) {
+		return;
+	}
+
+	wrapper = php_stream_locate_url_wrapper(Z_STRVAL_P(path), &path_to_open, 0 TSRMLS_CC);
+	if (wrapper && wrapper->wops->unlink) {
+		wrapper->wops->unlink(wrapper, path_to_open, 0, NULL TSRMLS_CC);
+	}
+}
+
 /**
  * Compiles a template into a file forcing the destination path
  *
@@ -2869,7 +3456,8 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileFile){
 
 	zval *path, *compiled_path, *extends_mode = NULL, *view_code;
 	zval *exception_message, *compilation, *final_compilation = NULL;
-	zval *status;
+	zval *empty_prefix, *more_entropy, *unique_id, *temporary_path;
+	zval *status = NULL;
 
 	PHALCON_MM_GROW();
 
@@ -2915,13 +3503,38 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileFile){
 		PHALCON_CPY_WRT(final_compilation, compilation);
 	}
 	
+	/** 
+	 * The compilation is written to a temporary file that replaces the compiled file at once, so
+	 * concurrent requests never include a partially written template
+	 */
+	PHALCON_INIT_VAR(empty_prefix);
+	ZVAL_STRING(empty_prefix, "", 1);
+	
+	PHALCON_INIT_VAR(more_entropy);
+	ZVAL_BOOL(more_entropy, 1);
+	
+	PHALCON_INIT_VAR(unique_id);
+	PHALCON_CALL_FUNC_PARAMS_2(unique_id, "uniqid", empty_prefix, more_entropy);
+	
+	PHALCON_INIT_VAR(temporary_path);
+	PHALCON_CONCAT_VSV(temporary_path, compiled_path, ".", unique_id);
+	
 	/** 
 	 * Always use file_put_contents to write files instead of write the file directly,
 	 * this respect the open_basedir directive
 	 */
 	PHALCON_INIT_VAR(status);
-	PHALCON_CALL_FUNC_PARAMS_2(status, "file_put_contents", compiled_path, final_compilation);
+	PHALCON_CALL_FUNC_PARAMS_2(status, "file_put_contents", temporary_path, final_compilation);
+	if (PHALCON_IS_FALSE(status)) {
+		phalcon_mvc_view_engine_volt_compiler_unlink(temporary_path TSRMLS_CC);
+		PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_view_exception_ce, "Volt directory can't be written");
+		return;
+	}
+	
+	PHALCON_INIT_NVAR(status);
+	PHALCON_CALL_FUNC_PARAMS_2(status, "rename", temporary_path, compiled_path);
 	if (PHALCON_IS_FALSE(status)) {
+		phalcon_mvc_view_engine_volt_compiler_unlink(temporary_path TSRMLS_CC);
 		PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_view_exception_ce, "Volt directory can't be written");
 		return;
 	}
@@ -2934,7 +3547,11 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileFile){
  * Compiles a template into a file applying the compiler options
  * This method does not return the compiled path if the template was not compiled
  *
+ * Templates checked by the current worker are registered, the 'revalidate' option sets the number of seconds
+ * they're trusted before looking at their modification time again. With 'stat' disabled they're never checked again
+ *
  *<code>
+ *	$compiler->setOptions(array('revalidate' => 60));
  *	$compiler->compile('views/layouts/main.volt');
  *	require $compiler->getCompiledTemplatePath();
  *</code>
@@ -2949,7 +3566,12 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compile){
 	zval *compiled_path = NULL, *prefix = NULL, *compiled_separator = NULL;
 	zval *compiled_extension = NULL, *compilation = NULL, *options;
 	zval *template_sep_path = NULL, *compiled_template_path = NULL;
-	zval *blocks_code, *exception_message = NULL;
+	zval *blocks_code, *exception_message = NULL, *revalidate_option = NULL;
+	zval *registry = NULL, *registered = NULL, *registered_mtime;
+	phalcon_persistent_entry *entry;
+	long revalidate = 0, mtime, blocks_mtime = 0;
+	time_t now;
+	int fresh, load_blocks = 0;
 
 	PHALCON_MM_GROW();
 
@@ -3067,6 +3689,20 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compile){
 			PHALCON_OBS_NVAR(stat);
 			phalcon_array_fetch_string(&stat, options, SL("stat"), PH_NOISY_CC);
 		}
+	
+		/** 
+		 * Number of seconds the templates in the registry are trusted before checking them again
+		 */
+		if (phalcon_array_isset_string(options, SS("revalidate"))) {
+	
+			PHALCON_OBS_VAR(revalidate_option);
+			phalcon_array_fetch_string(&revalidate_option, options, SL("revalidate"), PH_NOISY_CC);
+			if (Z_TYPE_P(revalidate_option) != IS_LONG) {
+				PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_view_exception_ce, "revalidate must be an integer value");
+				return;
+			}
+			revalidate = Z_LVAL_P(revalidate_option);
+		}
 	}
 	
 	if (Z_TYPE_P(compiled_path) != IS_NULL) {
@@ -3097,60 +3733,174 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compile){
 		 */
 		PHALCON_CALL_METHOD_PARAMS_3(compilation, this_ptr, "compilefile", template_path, compiled_template_path, extends_mode);
 	} else {
-		if (PHALCON_IS_TRUE(stat)) {
-			if (phalcon_file_exists(compiled_template_path TSRMLS_CC) == SUCCESS) {
 	
-				/** 
-				 * Compare modification timestamps to check if the file needs to be recompiled
-				 */
-				if (phalcon_compare_mtime(template_path, compiled_template_path TSRMLS_CC)) {
-					PHALCON_INIT_NVAR(compilation);
-					PHALCON_CALL_METHOD_PARAMS_3(compilation, this_ptr, "compilefile", template_path, compiled_template_path, extends_mode);
-				} else {
-					if (PHALCON_IS_TRUE(extends_mode)) {
+		/** 
+		 * Templates already checked by this worker are looked up in the registry, they're
+		 * only checked again when the revalidation interval expires
+		 */
+		entry = NULL;
+		if (Z_TYPE_P(template_path) == IS_STRING && Z_TYPE_P(compiled_template_path) == IS_STRING) {
+			entry = phalcon_persistent_cache_find("volt", Z_STRVAL_P(compiled_template_path), Z_STRLEN_P(compiled_template_path) + 1 TSRMLS_CC);
+			if (entry) {
+				if (!entry->value || entry->value_length != (uint) Z_STRLEN_P(template_path) || memcmp(entry->value, Z_STRVAL_P(template_path), entry->value_length)) {
+					entry = NULL;
+				}
+			}
+		}
 	
-						/** 
-						 * In extends mode we read the file that must contains a serialized array of blocks
-						 */
-						PHALCON_INIT_VAR(blocks_code);
-						PHALCON_CALL_FUNC_PARAMS_1(blocks_code, "file_get_contents", compiled_template_path);
-						if (PHALCON_IS_FALSE(blocks_code)) {
-							PHALCON_INIT_VAR(exception_message);
-							PHALCON_CONCAT_SVS(exception_message, "Extends compilation file ", compiled_template_path, " could not be opened");
-							PHALCON_THROW_EXCEPTION_ZVAL(phalcon_mvc_view_exception_ce, exception_message);
-							return;
+		fresh = 0;
+		if (entry) {
+			if (PHALCON_IS_TRUE(stat)) {
+				if (revalidate > 0) {
+					now = time(NULL);
+					if (now - entry->checked_at < revalidate) {
+						fresh = 1;
+					} else {
+						if (phalcon_file_mtime(template_path, &mtime TSRMLS_CC) == SUCCESS) {
+							if (mtime == entry->number) {
+								entry->checked_at = now;
+								fresh = 1;
+							}
 						}
+					}
+				}
+			} else {
+				fresh = 1;
+			}
 	
-						/** 
-						 * Unserialize the array blocks code
-						 */
-						if (zend_is_true(blocks_code)) {
-							PHALCON_INIT_NVAR(compilation);
-							PHALCON_CALL_FUNC_PARAMS_1(compilation, "unserialize", blocks_code);
-						} else {
-							PHALCON_INIT_NVAR(compilation);
-							array_init(compilation);
+			/** 
+			 * The compiled file could have been removed since the template was registered
+			 */
+			if (fresh && PHALCON_IS_TRUE(stat)) {
+				if (phalcon_file_exists(compiled_template_path TSRMLS_CC) == FAILURE) {
+					fresh = 0;
+				}
+			}
+		}
+	
+		if (fresh) {
+			if (PHALCON_IS_TRUE(extends_mode)) {
+				load_blocks = 1;
+				blocks_mtime = entry->number;
+			}
+		} else {
+	
+			mtime = 0;
+			if (PHALCON_IS_TRUE(stat)) {
+				if (phalcon_file_mtime(template_path, &mtime TSRMLS_CC) == FAILURE) {
+					mtime = -1;
+				}
+			}
+			blocks_mtime = mtime;
+	
+			if (PHALCON_IS_TRUE(stat)) {
+				if (phalcon_file_exists(compiled_template_path TSRMLS_CC) == SUCCESS) {
+	
+					/** 
+					 * Compare modification timestamps to check if the file needs to be recompiled
+					 */
+					if (phalcon_compare_mtime(template_path, compiled_template_path TSRMLS_CC)) {
+						PHALCON_INIT_NVAR(compilation);
+						PHALCON_CALL_METHOD_PARAMS_3(compilation, this_ptr, "compilefile", template_path, compiled_template_path, extends_mode);
+					} else {
+						if (PHALCON_IS_TRUE(extends_mode)) {
+							load_blocks = 1;
 						}
 					}
+				} else {
+					/** 
+					 * The file doesn't exist so we compile the php version for the first time
+					 */
+					PHALCON_INIT_NVAR(compilation);
+					PHALCON_CALL_METHOD_PARAMS_3(compilation, this_ptr, "compilefile", template_path, compiled_template_path, extends_mode);
 				}
 			} else {
 				/** 
-				 * The file doesn't exist so we compile the php version for the first time
+				 * Stat is off but the compiled file doesn't exist
 				 */
-				PHALCON_INIT_NVAR(compilation);
-				PHALCON_CALL_METHOD_PARAMS_3(compilation, this_ptr, "compilefile", template_path, compiled_template_path, extends_mode);
+				if (phalcon_file_exists(compiled_template_path TSRMLS_CC) == FAILURE) {
+					PHALCON_INIT_NVAR(exception_message);
+					PHALCON_CONCAT_SVS(exception_message, "Compiled template file ", compiled_template_path, " does not exist");
+					PHALCON_THROW_EXCEPTION_ZVAL(phalcon_mvc_view_exception_ce, exception_message);
+					return;
+				}
 			}
-		} else {
+	
+			/** 
+			 * Register the template with a snapshot of its modification time
+			 */
+			if (Z_TYPE_P(template_path) == IS_STRING && Z_TYPE_P(compiled_template_path) == IS_STRING && (!PHALCON_IS_TRUE(stat) || revalidate > 0)) {
+				if (mtime >= 0) {
+					phalcon_persistent_cache_store("volt", Z_STRVAL_P(compiled_template_path), Z_STRLEN_P(compiled_template_path) + 1, Z_STRVAL_P(template_path), Z_STRLEN_P(template_path), mtime TSRMLS_CC);
+				}
+			}
+		}
+	}
+	
+	PHALCON_OBS_VAR(registry);
+	phalcon_read_static_property(&registry, SL("phalcon\\mvc\\view\\engine\\volt\\compiler"), SL("_registry") TSRMLS_CC);
+	
+	if (load_blocks) {
+	
+		/** 
+		 * Blocks already unserialized are reused only if they were registered with the same
+		 * modification time of the template
+		 */
+		if (phalcon_array_isset(registry, compiled_template_path)) {
+			PHALCON_OBS_VAR(registered);
+			phalcon_array_fetch(&registered, registry, compiled_template_path, PH_NOISY_CC);
+			if (phalcon_array_isset_long(registered, 0)) {
+				PHALCON_OBS_VAR(registered_mtime);
+				phalcon_array_fetch_long(&registered_mtime, registered, 0, PH_NOISY_CC);
+				if (phalcon_get_intval(registered_mtime) == blocks_mtime) {
+					PHALCON_OBS_NVAR(compilation);
+					phalcon_array_fetch_long(&compilation, registered, 1, PH_NOISY_CC);
+					load_blocks = 0;
+				}
+			}
+		}
+	
+		if (load_blocks) {
 			/** 
-			 * Stat is off but the compiled file doesn't exist
+			 * In extends mode we read the file that must contains a serialized array of blocks
 			 */
-			if (phalcon_file_exists(compiled_template_path TSRMLS_CC) == FAILURE) {
+			PHALCON_INIT_VAR(blocks_code);
+			PHALCON_CALL_FUNC_PARAMS_1(blocks_code, "file_get_contents", compiled_template_path);
+			if (PHALCON_IS_FALSE(blocks_code)) {
 				PHALCON_INIT_NVAR(exception_message);
-				PHALCON_CONCAT_SVS(exception_message, "Compiled template file ", compiled_template_path, " does not exist");
+				PHALCON_CONCAT_SVS(exception_message, "Extends compilation file ", compiled_template_path, " could not be opened");
 				PHALCON_THROW_EXCEPTION_ZVAL(phalcon_mvc_view_exception_ce, exception_message);
 				return;
 			}
+	
+			/** 
+			 * Unserialize the array blocks code
+			 */
+			if (zend_is_true(blocks_code)) {
+				PHALCON_INIT_NVAR(compilation);
+				PHALCON_CALL_FUNC_PARAMS_1(compilation, "unserialize", blocks_code);
+			} else {
+				PHALCON_INIT_NVAR(compilation);
+				array_init(compilation);
+			}
+		}
+	}
+	
+	/** 
+	 * Blocks compiled or read in extends mode are kept for the rest of the request together
+	 * with the modification time of their template
+	 */
+	if (PHALCON_IS_TRUE(extends_mode) && Z_TYPE_P(compilation) == IS_ARRAY) {
+		if (Z_TYPE_P(registry) != IS_ARRAY) {
+			PHALCON_INIT_NVAR(registry);
+			array_init(registry);
 		}
+		PHALCON_INIT_NVAR(registered);
+		array_init_size(registered, 2);
+		add_next_index_long(registered, blocks_mtime);
+		phalcon_array_append(&registered, compilation, PH_SEPARATE TSRMLS_CC);
+		phalcon_array_update_zval(&registry, compiled_template_path, &registered, PH_COPY | PH_SEPARATE TSRMLS_CC);
+		phalcon_update_static_property(SL("phalcon\\mvc\\view\\engine\\volt\\compiler"), SL("_registry"), registry TSRMLS_CC);
 	}
 	
 	phalcon_update_property_zval(this_ptr, SL("_compiledTemplatePath"), compiled_template_path TSRMLS_CC);
@@ -3158,6 +3908,409 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compile){
 	RETURN_CCTOR(compilation);
 }
 
+/**
+ * Returns the current time in seconds
+ */
+static double phalcon_mvc_view_engine_volt_compiler_time(void){
+
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return (double) tv.tv_sec + (double) tv.tv_usec / 1000000.0;
+}
+
+/**
+ * Compiles a list of templates adding the time spent on every one to the results. Exceptions are
+ * cleared and reported as the error of the template
+ */
+static void phalcon_mvc_view_engine_volt_compiler_compile_list(zval *compiler, zval *templates, zval *results TSRMLS_DC){
+
+	HashPosition pos;
+	zval **template_path, *function_name, *retval, *result, *message, *params[1];
+	double start;
+
+	MAKE_STD_ZVAL(function_name);
+	ZVAL_STRING(function_name, "compile", 1);
+
+	zend_hash_internal_pointer_reset_ex(Z_ARRVAL_P(templates), &pos);
+	while (zend_hash_get_current_data_ex(Z_ARRVAL_P(templates), (void **) &template_path, &pos) == SUCCESS) {
+
+		start = phalcon_mvc_view_engine_volt_compiler_time();
+
+		MAKE_STD_ZVAL(retval);
+		ZVAL_NULL(retval);
+
+		params[0] = *template_path;
+		call_user_function(NULL, &compiler, function_name, retval, 1, params TSRMLS_CC);
+		zval_ptr_dtor(&retval);
+
+		MAKE_STD_ZVAL(result);
+		array_init_size(result, 2);
+		add_assoc_double_ex(result, SS("time"), phalcon_mvc_view_engine_volt_compiler_time() - start);
+
+		if (EG(exception)) {
+			message = zend_read_property(zend_exception_get_default(TSRMLS_C), EG(exception), SL("message"), 1 TSRMLS_CC);
+			if (Z_TYPE_P(message) == IS_STRING) {
+				add_assoc_stringl_ex(result, SS("error"), Z_STRVAL_P(message), Z_STRLEN_P(message), 1);
+			} else {
+				add_assoc_stringl_ex(result, SS("error"), SL("The template could not be compiled"), 1);
+			}
+			zend_clear_exception(TSRMLS_C);
+		}
+
+		add_assoc_zval_ex(results, Z_STRVAL_PP(template_path), Z_STRLEN_PP(template_path) + 1, result);
+
+		zend_hash_move_forward_ex(Z_ARRVAL_P(templates), &pos);
+	}
+
+	zval_ptr_dtor(&function_name);
+}
+
+#ifndef PHP_WIN32
+
+/**
+ * Compiles a list of templates in a child process, the results are sent serialized through a pipe
+ */
+static pid_t phalcon_mvc_view_engine_volt_compiler_fork(zval *compiler, zval *templates, int *fd TSRMLS_DC){
+
+	int fds[2];
+	pid_t pid;
+	zval *results;
+	smart_str buffer = {0};
+	php_serialize_data_t var_hash;
+	size_t written = 0;
+	ssize_t length;
+
+	if (pipe(fds) == -1) {
+		return -1;
+	}
+
+	pid = fork();
+	if (pid == -1) {
+		close(fds[0]);
+		close(fds[1]);
+		return -1;
+	}
+
+	if (pid == 0) {
+
+		close(fds[0]);
+
+		MAKE_STD_ZVAL(results);
+		array_init(results);
+		phalcon_mvc_view_engine_volt_compiler_compile_list(compiler, templates, results TSRMLS_CC);
+
+		PHP_VAR_SERIALIZE_INIT(var_hash);
+		php_var_serialize(&buffer, &results, &var_hash TSRMLS_CC);
+		PHP_VAR_SERIALIZE_DESTROY(var_hash);
+
+		while (written < buffer.len) {
+			length = write(fds[1], buffer.c + written, buffer.len - written);
+			if (length <= 0) {
+				if (length == -1 && errno == EINTR) {
+					continue;
+				}
+				break;
+			}
+			written += length;
+		}
+		close(fds[1]);
+
+		/**
+		 * The child process leaves without running the shutdown of the request it was forked from
+		 */
+		_exit(0);
+	}
+
+	close(fds[1]);
+	*fd = fds[0];
+
+	return pid;
+}
+
+/**
+ * Reads the results of a child process and waits for it to finish
+ */
+static int phalcon_mvc_view_engine_volt_compiler_collect(pid_t pid, int fd, zval *results TSRMLS_DC){
+
+	smart_str buffer = {0};
+	char chunk[8192];
+	ssize_t length;
+	int exit_status, status = FAILURE;
+	zval *child_results;
+	const unsigned char *p;
+	php_unserialize_data_t var_hash;
+
+	while ((length = read(fd, chunk, sizeof(chunk))) != 0) {
+		if (length == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+			break;
+		}
+		smart_str_appendl(&buffer, chunk, length);
+	}
+	close(fd);
+
+	while (waitpid(pid, &exit_status, 0) == -1 && errno == EINTR);
+
+	if (buffer.len) {
+
+		MAKE_STD_ZVAL(child_results);
+		ZVAL_NULL(child_results);
+
+		p = (const unsigned char *) buffer.c;
+		PHP_VAR_UNSERIALIZE_INIT(var_hash);
+		if (php_var_unserialize(&child_results, &p, p + buffer.len, &var_hash TSRMLS_CC)) {
+			if (Z_TYPE_P(child_results) == IS_ARRAY) {
+				zend_hash_merge(Z_ARRVAL_P(results), Z_ARRVAL_P(child_results), (copy_ctor_func_t) zval_add_ref, NULL, sizeof(zval *), 1);
+				status = SUCCESS;
+			}
+		}
+		PHP_VAR_UNSERIALIZE_DESTROY(var_hash);
+
+		zval_ptr_dtor(&child_results);
+	}
+
+	smart_str_free(&buffer);
+
+	return status;
+}
+
+/**
+ * Reports the templates of a list without results as not compiled
+ */
+static void phalcon_mvc_view_engine_volt_compiler_fail_list(zval *templates, zval *results TSRMLS_DC){
+
+	HashPosition pos;
+	zval **template_path, *result;
+
+	zend_hash_internal_pointer_reset_ex(Z_ARRVAL_P(templates), &pos);
+	while (zend_hash_get_current_data_ex(Z_ARRVAL_P(templates), (void **) &template_path, &pos) == SUCCESS) {
+
+		if (!zend_hash_exists(Z_ARRVAL_P(results), Z_STRVAL_PP(template_path), Z_STRLEN_PP(template_path) + 1)) {
+			MAKE_STD_ZVAL(result);
+			array_init_size(result, 2);
+			add_assoc_double_ex(result, SS("time"), 0);
+			add_assoc_stringl_ex(result, SS("error"), SL("The compilation process exited unexpectedly"), 1);
+			add_assoc_zval_ex(results, Z_STRVAL_PP(template_path), Z_STRLEN_PP(template_path) + 1, result);
+		}
+
+		zend_hash_move_forward_ex(Z_ARRVAL_P(templates), &pos);
+	}
+}
+
+#endif
+
+/**
+ * Compiles ahead of time every template found in a directory and its subdirectories, so the first
+ * requests after a deploy don't have to compile them. The templates can be distributed among several
+ * processes with the 'workers' option. Returns the time spent on every template and the error
+ * produced if it couldn't be compiled
+ *
+ *<code>
+ *	$timings = $compiler->compileDirectory('app/views/', array('workers' => 4));
+ *	foreach ($timings as $path => $timing) {
+ *		echo $path, ' ', $timing['time'], PHP_EOL;
+ *	}
+ *</code>
+ *
+ * @param string $directory
+ * @param array $options
+ * @return array
+ */
+PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, compileDirectory){
+
+	zval *directory, *options = NULL, *extension = NULL, *workers;
+	zval *directories, *root = NULL, *templates, *current = NULL;
+	zval *entries = NULL, *entry = NULL, *path = NULL, *is_directory = NULL;
+	zval *directory_path = NULL, *exception_message = NULL, *results;
+	HashTable *ah0;
+	HashPosition hp0;
+	zval **hd;
+	long number_workers = 1;
+	unsigned long position = 0;
+	char *name;
+	int name_length;
+#ifndef PHP_WIN32
+	zval **chunks, **template_path;
+	HashPosition pos;
+	pid_t *pids;
+	int *fds;
+	long i, number_templates;
+#endif
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &directory, &options) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (Z_TYPE_P(directory) != IS_STRING) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_view_exception_ce, "The directory must be a string");
+		return;
+	}
+	
+	PHALCON_INIT_VAR(extension);
+	ZVAL_STRING(extension, ".volt", 1);
+	
+	if (options && Z_TYPE_P(options) == IS_ARRAY) { 
+	
+		/** 
+		 * Only the files with this extension are compiled
+		 */
+		if (phalcon_array_isset_string(options, SS("extension"))) {
+			PHALCON_OBS_NVAR(extension);
+			phalcon_array_fetch_string(&extension, options, SL("extension"), PH_NOISY_CC);
+			if (Z_TYPE_P(extension) != IS_STRING) {
+				PHALCON_THROW_EXCEPTION_STR(phalcon_mvc_view_exception_ce, "extension must be a string");
+				return;
+			}
+		}
+	
+		if (phalcon_array_isset_string(options, SS("workers"))) {
+			PHALCON_OBS_VAR(workers);
+			phalcon_array_fetch_string(&workers, options, SL("workers"), PH_NOISY_CC);
+			number_workers = phalcon_get_intval(workers);
+		}
+	}
+	
+	if (number_workers < 1) {
+		number_workers = 1;
+	}
+	
+	/** 
+	 * Directories are always traversed with a trailing separator
+	 */
+	if (Z_STRLEN_P(directory) && (Z_STRVAL_P(directory)[Z_STRLEN_P(directory) - 1] == '/' || Z_STRVAL_P(directory)[Z_STRLEN_P(directory) - 1] == '\\')) {
+		PHALCON_CPY_WRT(root, directory);
+	} else {
+		PHALCON_INIT_VAR(root);
+		PHALCON_CONCAT_VS(root, directory, "/");
+	}
+	
+	PHALCON_INIT_VAR(directories);
+	array_init(directories);
+	phalcon_array_append(&directories, root, PH_SEPARATE TSRMLS_CC);
+	
+	PHALCON_INIT_VAR(templates);
+	array_init(templates);
+	
+	while (position < zend_hash_num_elements(Z_ARRVAL_P(directories))) {
+	
+		PHALCON_OBS_NVAR(current);
+		phalcon_array_fetch_long(&current, directories, position, PH_NOISY_CC);
+		position++;
+	
+		PHALCON_INIT_NVAR(entries);
+		PHALCON_CALL_FUNC_PARAMS_1(entries, "scandir", current);
+		if (Z_TYPE_P(entries) != IS_ARRAY) { 
+			PHALCON_INIT_NVAR(exception_message);
+			PHALCON_CONCAT_SVS(exception_message, "Directory ", current, " can't be read");
+			PHALCON_THROW_EXCEPTION_ZVAL(phalcon_mvc_view_exception_ce, exception_message);
+			return;
+		}
+	
+		if (!phalcon_is_iterable(entries, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+			return;
+		}
+	
+		while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+			PHALCON_GET_FOREACH_VALUE(entry);
+	
+			/** 
+			 * Hidden files and directories are skipped
+			 */
+			if (Z_TYPE_P(entry) == IS_STRING && Z_STRLEN_P(entry) && Z_STRVAL_P(entry)[0] != '.') {
+	
+				PHALCON_INIT_NVAR(path);
+				PHALCON_CONCAT_VV(path, current, entry);
+	
+				PHALCON_INIT_NVAR(is_directory);
+				PHALCON_CALL_FUNC_PARAMS_1(is_directory, "is_dir", path);
+				if (zend_is_true(is_directory)) {
+					PHALCON_INIT_NVAR(directory_path);
+					PHALCON_CONCAT_VS(directory_path, path, "/");
+					phalcon_array_append(&directories, directory_path, PH_SEPARATE TSRMLS_CC);
+				} else {
+					name = Z_STRVAL_P(entry);
+					name_length = Z_STRLEN_P(entry);
+					if (name_length > Z_STRLEN_P(extension) && !memcmp(name + name_length - Z_STRLEN_P(extension), Z_STRVAL_P(extension), Z_STRLEN_P(extension))) {
+						phalcon_array_append(&templates, path, PH_SEPARATE TSRMLS_CC);
+					}
+				}
+			}
+	
+			zend_hash_move_forward_ex(ah0, &hp0);
+		}
+	
+	}
+	
+	PHALCON_INIT_VAR(results);
+	array_init(results);
+	
+#ifndef PHP_WIN32
+	number_templates = zend_hash_num_elements(Z_ARRVAL_P(templates));
+	if (number_workers > number_templates) {
+		number_workers = number_templates;
+	}
+	
+	if (number_workers > 1) {
+	
+		/** 
+		 * The templates are distributed among the workers in turns
+		 */
+		chunks = emalloc(sizeof(zval *) * number_workers);
+		for (i = 0; i < number_workers; i++) {
+			MAKE_STD_ZVAL(chunks[i]);
+			array_init(chunks[i]);
+		}
+	
+		i = 0;
+		zend_hash_internal_pointer_reset_ex(Z_ARRVAL_P(templates), &pos);
+		while (zend_hash_get_current_data_ex(Z_ARRVAL_P(templates), (void **) &template_path, &pos) == SUCCESS) {
+			Z_ADDREF_PP(template_path);
+			add_next_index_zval(chunks[i % number_workers], *template_path);
+			i++;
+			zend_hash_move_forward_ex(Z_ARRVAL_P(templates), &pos);
+		}
+	
+		pids = emalloc(sizeof(pid_t) * number_workers);
+		fds = emalloc(sizeof(int) * number_workers);
+	
+		for (i = 0; i < number_workers; i++) {
+			pids[i] = phalcon_mvc_view_engine_volt_compiler_fork(this_ptr, chunks[i], &fds[i] TSRMLS_CC);
+			if (pids[i] == -1) {
+				/** 
+				 * The templates are compiled by this process if a worker can't be forked
+				 */
+				phalcon_mvc_view_engine_volt_compiler_compile_list(this_ptr, chunks[i], results TSRMLS_CC);
+			}
+		}
+	
+		for (i = 0; i < number_workers; i++) {
+			if (pids[i] != -1) {
+				if (phalcon_mvc_view_engine_volt_compiler_collect(pids[i], fds[i], results TSRMLS_CC) == FAILURE) {
+					phalcon_mvc_view_engine_volt_compiler_fail_list(chunks[i], results TSRMLS_CC);
+				}
+			}
+			zval_ptr_dtor(&chunks[i]);
+		}
+	
+		efree(fds);
+		efree(pids);
+		efree(chunks);
+	
+		RETURN_CTOR(results);
+	}
+#endif
+	
+	phalcon_mvc_view_engine_volt_compiler_compile_list(this_ptr, templates, results TSRMLS_CC);
+	
+	RETURN_CTOR(results);
+}
+
 /**
  * Returns the path that is currently beign compiled
  *
@@ -3180,6 +4333,23 @@ PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, getCompiledTemplatePath){
 	RETURN_MEMBER(this_ptr, "_compiledTemplatePath");
 }
 
+/**
+ * Removes the templates registered by the current worker, the next compilation checks them again
+ */
+PHP_METHOD(Phalcon_Mvc_View_Engine_Volt_Compiler, clearRegistry){
+
+	zval *registry;
+
+	PHALCON_MM_GROW();
+
+	phalcon_persistent_cache_clear("volt" TSRMLS_CC);
+
+	PHALCON_INIT_VAR(registry);
+	phalcon_update_static_property(SL("phalcon\\mvc\\view\\engine\\volt\\compiler"), SL("_registry"), registry TSRMLS_CC);
+
+	PHALCON_MM_RESTORE();
+}
+
 /**
  * Parses a Volt template returning its intermediate representation
  *
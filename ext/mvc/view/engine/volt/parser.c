@@ -330,35 +330,18 @@ static zval *phvolt_ret_zval_list(zval *list_left, zval *right_list)
 {
 
 	zval *ret;
-	HashPosition pos;
-	HashTable *list;
-
-	MAKE_STD_ZVAL(ret);
-	array_init(ret);
 
+	/**
+	 * Lists are built from the left, so the new item is appended to the list already
+	 * created instead of copying the whole list on every reduction
+	 */
 	if (list_left) {
-
-		list = Z_ARRVAL_P(list_left);
-		if (zend_hash_index_exists(list, 0)) {
-			zend_hash_internal_pointer_reset_ex(list, &pos);
-			for (;; zend_hash_move_forward_ex(list, &pos)) {
-
-				zval ** item;
-
-				if (zend_hash_get_current_data_ex(list, (void**) &item, &pos) == FAILURE) {
-					break;
-				}
-
-				Z_ADDREF_PP(item);
-				add_next_index_zval(ret, *item);
-
-			}
-			zval_ptr_dtor(&list_left);
-		} else {
-			add_next_index_zval(ret, list_left);
-		}
+		add_next_index_zval(list_left, right_list);
+		return list_left;
 	}
 
+	MAKE_STD_ZVAL(ret);
+	array_init(ret);
 	add_next_index_zval(ret, right_list);
 
 	return ret;
@@ -456,7 +439,7 @@ static zval *phvolt_ret_func_call(zval *expr, zval *arguments, phvolt_scanner_st
 }
 
 
-// 460 "parser.c"
+// 443 "parser.c"
 /* Next is all token values, in a form suitable for use by makeheaders.
 ** This section will be null unless lemon is run with the -m switch.
 */
@@ -1256,7 +1239,7 @@ static void kk_destructor(KKCODETYPE kkmajor, KKMINORTYPE *kkpminor){
     case 60:
     case 61:
     case 62:
-// 539 "parser.lemon"
+// 522 "parser.lemon"
 {
 	if ((kkpminor->kk0)) {
 		if ((kkpminor->kk0)->free_flag) {
@@ -1265,7 +1248,7 @@ static void kk_destructor(KKCODETYPE kkmajor, KKMINORTYPE *kkpminor){
 		efree((kkpminor->kk0));
 	}
 }
-// 1269 "parser.c"
+// 1252 "parser.c"
       break;
     case 66:
     case 67:
@@ -1292,9 +1275,9 @@ static void kk_destructor(KKCODETYPE kkmajor, KKMINORTYPE *kkpminor){
     case 88:
     case 89:
     case 90:
-// 556 "parser.lemon"
+// 539 "parser.lemon"
 { zval_ptr_dtor(&(kkpminor->kk176)); }
-// 1298 "parser.c"
+// 1281 "parser.c"
       break;
     default:  break;   /* If no destructor action specified: do nothing */
   }
@@ -1604,11 +1587,11 @@ static void kk_reduce(
   **     break;
   */
       case 0:
-// 548 "parser.lemon"
+// 531 "parser.lemon"
 {
 	status->ret = kkmsp[0].minor.kk176;
 }
-// 1612 "parser.c"
+// 1595 "parser.c"
         break;
       case 1:
       case 4:
@@ -1628,30 +1611,30 @@ static void kk_reduce(
       case 18:
       case 19:
       case 83:
-// 552 "parser.lemon"
+// 535 "parser.lemon"
 {
 	kkgotominor.kk176 = kkmsp[0].minor.kk176;
 }
-// 1636 "parser.c"
+// 1619 "parser.c"
         break;
       case 2:
-// 558 "parser.lemon"
+// 541 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_zval_list(kkmsp[-1].minor.kk176, kkmsp[0].minor.kk176);
 }
-// 1643 "parser.c"
+// 1626 "parser.c"
         break;
       case 3:
       case 80:
       case 87:
-// 562 "parser.lemon"
+// 545 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_zval_list(NULL, kkmsp[0].minor.kk176);
 }
-// 1652 "parser.c"
+// 1635 "parser.c"
         break;
       case 20:
-// 634 "parser.lemon"
+// 617 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_if_statement(kkmsp[-5].minor.kk176, kkmsp[-3].minor.kk176, NULL, status->scanner_state);
   kk_destructor(1,&kkmsp[-7].minor);
@@ -1661,10 +1644,10 @@ static void kk_reduce(
   kk_destructor(31,&kkmsp[-1].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1665 "parser.c"
+// 1648 "parser.c"
         break;
       case 21:
-// 638 "parser.lemon"
+// 621 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_if_statement(kkmsp[-9].minor.kk176, kkmsp[-7].minor.kk176, kkmsp[-3].minor.kk176, status->scanner_state);
   kk_destructor(1,&kkmsp[-11].minor);
@@ -1677,30 +1660,30 @@ static void kk_reduce(
   kk_destructor(31,&kkmsp[-1].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1681 "parser.c"
+// 1664 "parser.c"
         break;
       case 22:
-// 644 "parser.lemon"
+// 627 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_elseif_statement(kkmsp[-1].minor.kk176, status->scanner_state);
   kk_destructor(1,&kkmsp[-3].minor);
   kk_destructor(33,&kkmsp[-2].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1691 "parser.c"
+// 1674 "parser.c"
         break;
       case 23:
-// 650 "parser.lemon"
+// 633 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_elsefor_statement(status->scanner_state);
   kk_destructor(1,&kkmsp[-2].minor);
   kk_destructor(34,&kkmsp[-1].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1701 "parser.c"
+// 1684 "parser.c"
         break;
       case 24:
-// 656 "parser.lemon"
+// 639 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_for_statement(kkmsp[-7].minor.kk0, NULL, kkmsp[-5].minor.kk176, NULL, kkmsp[-3].minor.kk176, status->scanner_state);
   kk_destructor(1,&kkmsp[-9].minor);
@@ -1711,10 +1694,10 @@ static void kk_reduce(
   kk_destructor(37,&kkmsp[-1].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1715 "parser.c"
+// 1698 "parser.c"
         break;
       case 25:
-// 660 "parser.lemon"
+// 643 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_for_statement(kkmsp[-9].minor.kk0, NULL, kkmsp[-7].minor.kk176, kkmsp[-5].minor.kk176, kkmsp[-3].minor.kk176, status->scanner_state);
   kk_destructor(1,&kkmsp[-11].minor);
@@ -1726,10 +1709,10 @@ static void kk_reduce(
   kk_destructor(37,&kkmsp[-1].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1730 "parser.c"
+// 1713 "parser.c"
         break;
       case 26:
-// 664 "parser.lemon"
+// 647 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_for_statement(kkmsp[-7].minor.kk0, kkmsp[-9].minor.kk0, kkmsp[-5].minor.kk176, NULL, kkmsp[-3].minor.kk176, status->scanner_state);
   kk_destructor(1,&kkmsp[-11].minor);
@@ -1741,10 +1724,10 @@ static void kk_reduce(
   kk_destructor(37,&kkmsp[-1].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1745 "parser.c"
+// 1728 "parser.c"
         break;
       case 27:
-// 668 "parser.lemon"
+// 651 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_for_statement(kkmsp[-9].minor.kk0, kkmsp[-11].minor.kk0, kkmsp[-7].minor.kk176, kkmsp[-5].minor.kk176, kkmsp[-3].minor.kk176, status->scanner_state);
   kk_destructor(1,&kkmsp[-13].minor);
@@ -1757,10 +1740,10 @@ static void kk_reduce(
   kk_destructor(37,&kkmsp[-1].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1761 "parser.c"
+// 1744 "parser.c"
         break;
       case 28:
-// 674 "parser.lemon"
+// 657 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_set_statement(kkmsp[-3].minor.kk0, kkmsp[-1].minor.kk176, status->scanner_state);
   kk_destructor(1,&kkmsp[-5].minor);
@@ -1768,28 +1751,28 @@ static void kk_reduce(
   kk_destructor(39,&kkmsp[-2].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1772 "parser.c"
+// 1755 "parser.c"
         break;
       case 29:
-// 680 "parser.lemon"
+// 663 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_empty_statement(status->scanner_state);
   kk_destructor(1,&kkmsp[-1].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1781 "parser.c"
+// 1764 "parser.c"
         break;
       case 30:
-// 686 "parser.lemon"
+// 669 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_echo_statement(kkmsp[-1].minor.kk176, status->scanner_state);
   kk_destructor(40,&kkmsp[-2].minor);
   kk_destructor(41,&kkmsp[0].minor);
 }
-// 1790 "parser.c"
+// 1773 "parser.c"
         break;
       case 31:
-// 692 "parser.lemon"
+// 675 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_block_statement(kkmsp[-5].minor.kk0, kkmsp[-3].minor.kk176, status->scanner_state);
   kk_destructor(1,&kkmsp[-7].minor);
@@ -1799,10 +1782,10 @@ static void kk_reduce(
   kk_destructor(43,&kkmsp[-1].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1803 "parser.c"
+// 1786 "parser.c"
         break;
       case 32:
-// 696 "parser.lemon"
+// 679 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_block_statement(kkmsp[-4].minor.kk0, NULL, status->scanner_state);
   kk_destructor(1,&kkmsp[-6].minor);
@@ -1812,10 +1795,10 @@ static void kk_reduce(
   kk_destructor(43,&kkmsp[-1].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1816 "parser.c"
+// 1799 "parser.c"
         break;
       case 33:
-// 702 "parser.lemon"
+// 685 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_cache_statement(kkmsp[-5].minor.kk176, NULL, kkmsp[-3].minor.kk176, status->scanner_state);
   kk_destructor(1,&kkmsp[-7].minor);
@@ -1825,10 +1808,10 @@ static void kk_reduce(
   kk_destructor(45,&kkmsp[-1].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1829 "parser.c"
+// 1812 "parser.c"
         break;
       case 34:
-// 706 "parser.lemon"
+// 689 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_cache_statement(kkmsp[-6].minor.kk176, kkmsp[-5].minor.kk0, kkmsp[-3].minor.kk176, status->scanner_state);
   kk_destructor(1,&kkmsp[-8].minor);
@@ -1838,40 +1821,40 @@ static void kk_reduce(
   kk_destructor(45,&kkmsp[-1].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1842 "parser.c"
+// 1825 "parser.c"
         break;
       case 35:
-// 712 "parser.lemon"
+// 695 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_extends_statement(kkmsp[-1].minor.kk0, status->scanner_state);
   kk_destructor(1,&kkmsp[-3].minor);
   kk_destructor(47,&kkmsp[-2].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1852 "parser.c"
+// 1835 "parser.c"
         break;
       case 36:
-// 718 "parser.lemon"
+// 701 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_include_statement(kkmsp[-1].minor.kk0, status->scanner_state);
   kk_destructor(1,&kkmsp[-3].minor);
   kk_destructor(49,&kkmsp[-2].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1862 "parser.c"
+// 1845 "parser.c"
         break;
       case 37:
-// 724 "parser.lemon"
+// 707 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_do_statement(kkmsp[-1].minor.kk176, status->scanner_state);
   kk_destructor(1,&kkmsp[-3].minor);
   kk_destructor(50,&kkmsp[-2].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1872 "parser.c"
+// 1855 "parser.c"
         break;
       case 38:
-// 730 "parser.lemon"
+// 713 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_autoescape_statement(0, kkmsp[-3].minor.kk176, status->scanner_state);
   kk_destructor(1,&kkmsp[-7].minor);
@@ -1882,10 +1865,10 @@ static void kk_reduce(
   kk_destructor(53,&kkmsp[-1].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1886 "parser.c"
+// 1869 "parser.c"
         break;
       case 39:
-// 734 "parser.lemon"
+// 717 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_autoescape_statement(1, kkmsp[-3].minor.kk176, status->scanner_state);
   kk_destructor(1,&kkmsp[-7].minor);
@@ -1896,418 +1879,418 @@ static void kk_reduce(
   kk_destructor(53,&kkmsp[-1].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1900 "parser.c"
+// 1883 "parser.c"
         break;
       case 40:
-// 740 "parser.lemon"
+// 723 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_break_statement(status->scanner_state);
   kk_destructor(1,&kkmsp[-2].minor);
   kk_destructor(55,&kkmsp[-1].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1910 "parser.c"
+// 1893 "parser.c"
         break;
       case 41:
-// 746 "parser.lemon"
+// 729 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_continue_statement(status->scanner_state);
   kk_destructor(1,&kkmsp[-2].minor);
   kk_destructor(56,&kkmsp[-1].minor);
   kk_destructor(30,&kkmsp[0].minor);
 }
-// 1920 "parser.c"
+// 1903 "parser.c"
         break;
       case 42:
-// 752 "parser.lemon"
+// 735 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_literal_zval(PHVOLT_T_RAW_FRAGMENT, kkmsp[0].minor.kk0, status->scanner_state);
 }
-// 1927 "parser.c"
+// 1910 "parser.c"
         break;
       case 43:
-// 758 "parser.lemon"
+// 741 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_MINUS, NULL, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(23,&kkmsp[-1].minor);
 }
-// 1935 "parser.c"
+// 1918 "parser.c"
         break;
       case 44:
-// 762 "parser.lemon"
+// 745 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_PLUS, NULL, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(22,&kkmsp[-1].minor);
 }
-// 1943 "parser.c"
+// 1926 "parser.c"
         break;
       case 45:
-// 766 "parser.lemon"
+// 749 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_SUB, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(23,&kkmsp[-1].minor);
 }
-// 1951 "parser.c"
+// 1934 "parser.c"
         break;
       case 46:
-// 770 "parser.lemon"
+// 753 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_ADD, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(22,&kkmsp[-1].minor);
 }
-// 1959 "parser.c"
+// 1942 "parser.c"
         break;
       case 47:
-// 774 "parser.lemon"
+// 757 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_MUL, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(20,&kkmsp[-1].minor);
 }
-// 1967 "parser.c"
+// 1950 "parser.c"
         break;
       case 48:
-// 778 "parser.lemon"
+// 761 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_DIV, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(19,&kkmsp[-1].minor);
 }
-// 1975 "parser.c"
+// 1958 "parser.c"
         break;
       case 49:
-// 782 "parser.lemon"
+// 765 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_MOD, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(21,&kkmsp[-1].minor);
 }
-// 1983 "parser.c"
+// 1966 "parser.c"
         break;
       case 50:
-// 786 "parser.lemon"
+// 769 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_AND, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(8,&kkmsp[-1].minor);
 }
-// 1991 "parser.c"
+// 1974 "parser.c"
         break;
       case 51:
-// 790 "parser.lemon"
+// 773 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_OR, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(9,&kkmsp[-1].minor);
 }
-// 1999 "parser.c"
+// 1982 "parser.c"
         break;
       case 52:
-// 794 "parser.lemon"
+// 777 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_CONCAT, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(24,&kkmsp[-1].minor);
 }
-// 2007 "parser.c"
+// 1990 "parser.c"
         break;
       case 53:
-// 798 "parser.lemon"
+// 781 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_PIPE, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(25,&kkmsp[-1].minor);
 }
-// 2015 "parser.c"
+// 1998 "parser.c"
         break;
       case 54:
-// 802 "parser.lemon"
+// 785 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_RANGE, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(7,&kkmsp[-1].minor);
 }
-// 2023 "parser.c"
+// 2006 "parser.c"
         break;
       case 55:
-// 806 "parser.lemon"
+// 789 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_EQUALS, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(11,&kkmsp[-1].minor);
 }
-// 2031 "parser.c"
+// 2014 "parser.c"
         break;
       case 56:
-// 810 "parser.lemon"
+// 793 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_NOT_ISSET, kkmsp[-3].minor.kk176, NULL, NULL, status->scanner_state);
   kk_destructor(10,&kkmsp[-2].minor);
   kk_destructor(26,&kkmsp[-1].minor);
   kk_destructor(58,&kkmsp[0].minor);
 }
-// 2041 "parser.c"
+// 2024 "parser.c"
         break;
       case 57:
-// 814 "parser.lemon"
+// 797 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_ISSET, kkmsp[-2].minor.kk176, NULL, NULL, status->scanner_state);
   kk_destructor(10,&kkmsp[-1].minor);
   kk_destructor(58,&kkmsp[0].minor);
 }
-// 2050 "parser.c"
+// 2033 "parser.c"
         break;
       case 58:
-// 818 "parser.lemon"
+// 801 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_IS, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(10,&kkmsp[-1].minor);
 }
-// 2058 "parser.c"
+// 2041 "parser.c"
         break;
       case 59:
-// 822 "parser.lemon"
+// 805 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_NOTEQUALS, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(12,&kkmsp[-1].minor);
 }
-// 2066 "parser.c"
+// 2049 "parser.c"
         break;
       case 60:
-// 826 "parser.lemon"
+// 809 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_IDENTICAL, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(17,&kkmsp[-1].minor);
 }
-// 2074 "parser.c"
+// 2057 "parser.c"
         break;
       case 61:
-// 830 "parser.lemon"
+// 813 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_NOTIDENTICAL, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(18,&kkmsp[-1].minor);
 }
-// 2082 "parser.c"
+// 2065 "parser.c"
         break;
       case 62:
-// 834 "parser.lemon"
+// 817 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_LESS, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(13,&kkmsp[-1].minor);
 }
-// 2090 "parser.c"
+// 2073 "parser.c"
         break;
       case 63:
-// 838 "parser.lemon"
+// 821 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_GREATER, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(14,&kkmsp[-1].minor);
 }
-// 2098 "parser.c"
+// 2081 "parser.c"
         break;
       case 64:
-// 842 "parser.lemon"
+// 825 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_GREATEREQUAL, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(15,&kkmsp[-1].minor);
 }
-// 2106 "parser.c"
+// 2089 "parser.c"
         break;
       case 65:
-// 846 "parser.lemon"
+// 829 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_LESSEQUAL, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(16,&kkmsp[-1].minor);
 }
-// 2114 "parser.c"
+// 2097 "parser.c"
         break;
       case 66:
-// 850 "parser.lemon"
+// 833 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_DOT, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(28,&kkmsp[-1].minor);
 }
-// 2122 "parser.c"
+// 2105 "parser.c"
         break;
       case 67:
-// 854 "parser.lemon"
+// 837 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_IN, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(3,&kkmsp[-1].minor);
 }
-// 2130 "parser.c"
+// 2113 "parser.c"
         break;
       case 68:
-// 858 "parser.lemon"
+// 841 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_NOT_IN, kkmsp[-3].minor.kk176, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(26,&kkmsp[-2].minor);
   kk_destructor(3,&kkmsp[-1].minor);
 }
-// 2139 "parser.c"
+// 2122 "parser.c"
         break;
       case 69:
-// 862 "parser.lemon"
+// 845 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_NOT, NULL, kkmsp[0].minor.kk176, NULL, status->scanner_state);
   kk_destructor(26,&kkmsp[-1].minor);
 }
-// 2147 "parser.c"
+// 2130 "parser.c"
         break;
       case 70:
-// 866 "parser.lemon"
+// 849 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_ENCLOSED, kkmsp[-1].minor.kk176, NULL, NULL, status->scanner_state);
   kk_destructor(27,&kkmsp[-2].minor);
   kk_destructor(59,&kkmsp[0].minor);
 }
-// 2156 "parser.c"
+// 2139 "parser.c"
         break;
       case 71:
-// 870 "parser.lemon"
+// 853 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_ARRAY, kkmsp[-1].minor.kk176, NULL, NULL, status->scanner_state);
   kk_destructor(6,&kkmsp[-2].minor);
   kk_destructor(60,&kkmsp[0].minor);
 }
-// 2165 "parser.c"
+// 2148 "parser.c"
         break;
       case 72:
-// 874 "parser.lemon"
+// 857 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_ARRAYACCESS, kkmsp[-3].minor.kk176, kkmsp[-1].minor.kk176, NULL, status->scanner_state);
   kk_destructor(6,&kkmsp[-2].minor);
   kk_destructor(60,&kkmsp[0].minor);
 }
-// 2174 "parser.c"
+// 2157 "parser.c"
         break;
       case 73:
-// 878 "parser.lemon"
+// 861 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_expr(PHVOLT_T_TERNARY, kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176, kkmsp[-4].minor.kk176, status->scanner_state);
   kk_destructor(4,&kkmsp[-3].minor);
   kk_destructor(5,&kkmsp[-1].minor);
 }
-// 2183 "parser.c"
+// 2166 "parser.c"
         break;
       case 74:
-// 882 "parser.lemon"
+// 865 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_slice(kkmsp[-4].minor.kk176, NULL, kkmsp[-1].minor.kk176, status->scanner_state);
   kk_destructor(6,&kkmsp[-3].minor);
   kk_destructor(5,&kkmsp[-2].minor);
   kk_destructor(60,&kkmsp[0].minor);
 }
-// 2193 "parser.c"
+// 2176 "parser.c"
         break;
       case 75:
-// 886 "parser.lemon"
+// 869 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_slice(kkmsp[-4].minor.kk176, kkmsp[-2].minor.kk176, NULL, status->scanner_state);
   kk_destructor(6,&kkmsp[-3].minor);
   kk_destructor(5,&kkmsp[-1].minor);
   kk_destructor(60,&kkmsp[0].minor);
 }
-// 2203 "parser.c"
+// 2186 "parser.c"
         break;
       case 76:
-// 890 "parser.lemon"
+// 873 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_slice(kkmsp[-5].minor.kk176, kkmsp[-3].minor.kk176, kkmsp[-1].minor.kk176, status->scanner_state);
   kk_destructor(6,&kkmsp[-4].minor);
   kk_destructor(5,&kkmsp[-2].minor);
   kk_destructor(60,&kkmsp[0].minor);
 }
-// 2213 "parser.c"
+// 2196 "parser.c"
         break;
       case 77:
       case 91:
-// 896 "parser.lemon"
+// 879 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_literal_zval(PHVOLT_T_INTEGER, kkmsp[0].minor.kk0, status->scanner_state);
 }
-// 2221 "parser.c"
+// 2204 "parser.c"
         break;
       case 78:
       case 90:
-// 900 "parser.lemon"
+// 883 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_literal_zval(PHVOLT_T_IDENTIFIER, kkmsp[0].minor.kk0, status->scanner_state);
 }
-// 2229 "parser.c"
+// 2212 "parser.c"
         break;
       case 79:
       case 86:
-// 906 "parser.lemon"
+// 889 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_zval_list(kkmsp[-2].minor.kk176, kkmsp[0].minor.kk176);
   kk_destructor(2,&kkmsp[-1].minor);
 }
-// 2238 "parser.c"
+// 2221 "parser.c"
         break;
       case 81:
       case 89:
-// 916 "parser.lemon"
+// 899 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_named_item(kkmsp[-2].minor.kk0, kkmsp[0].minor.kk176, status->scanner_state);
   kk_destructor(5,&kkmsp[-1].minor);
 }
-// 2247 "parser.c"
+// 2230 "parser.c"
         break;
       case 82:
       case 88:
-// 920 "parser.lemon"
+// 903 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_named_item(NULL, kkmsp[0].minor.kk176, status->scanner_state);
 }
-// 2255 "parser.c"
+// 2238 "parser.c"
         break;
       case 84:
-// 930 "parser.lemon"
+// 913 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_func_call(kkmsp[-3].minor.kk176, kkmsp[-1].minor.kk176, status->scanner_state);
   kk_destructor(27,&kkmsp[-2].minor);
   kk_destructor(59,&kkmsp[0].minor);
 }
-// 2264 "parser.c"
+// 2247 "parser.c"
         break;
       case 85:
-// 934 "parser.lemon"
+// 917 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_func_call(kkmsp[-2].minor.kk176, NULL, status->scanner_state);
   kk_destructor(27,&kkmsp[-1].minor);
   kk_destructor(59,&kkmsp[0].minor);
 }
-// 2273 "parser.c"
+// 2256 "parser.c"
         break;
       case 92:
-// 966 "parser.lemon"
+// 949 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_literal_zval(PHVOLT_T_STRING, kkmsp[0].minor.kk0, status->scanner_state);
 }
-// 2280 "parser.c"
+// 2263 "parser.c"
         break;
       case 93:
-// 970 "parser.lemon"
+// 953 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_literal_zval(PHVOLT_T_DOUBLE, kkmsp[0].minor.kk0, status->scanner_state);
 }
-// 2287 "parser.c"
+// 2270 "parser.c"
         break;
       case 94:
-// 974 "parser.lemon"
+// 957 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_literal_zval(PHVOLT_T_NULL, NULL, status->scanner_state);
   kk_destructor(62,&kkmsp[0].minor);
 }
-// 2295 "parser.c"
+// 2278 "parser.c"
         break;
       case 95:
-// 978 "parser.lemon"
+// 961 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_literal_zval(PHVOLT_T_FALSE, NULL, status->scanner_state);
   kk_destructor(52,&kkmsp[0].minor);
 }
-// 2303 "parser.c"
+// 2286 "parser.c"
         break;
       case 96:
-// 982 "parser.lemon"
+// 965 "parser.lemon"
 {
 	kkgotominor.kk176 = phvolt_ret_literal_zval(PHVOLT_T_TRUE, NULL, status->scanner_state);
   kk_destructor(54,&kkmsp[0].minor);
 }
-// 2311 "parser.c"
+// 2294 "parser.c"
         break;
   };
   kkgoto = kkRuleInfo[kkruleno].lhs;
@@ -2349,7 +2332,7 @@ static void kk_syntax_error(
 ){
   phvolt_ARG_FETCH;
 #define KTOKEN (kkminor.kk0)
-// 493 "parser.lemon"
+// 476 "parser.lemon"
 
 	if (status->scanner_state->start_length) {
 		{
@@ -2395,7 +2378,7 @@ static void kk_syntax_error(
 
 	status->status = PHVOLT_PARSING_FAILED;
 
-// 2399 "parser.c"
+// 2382 "parser.c"
   phvolt_ARG_STORE; /* Suppress warning about unused %extra_argument variable */
 }
 
@@ -0,0 +1,677 @@
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2013 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+#include "php_phalcon.h"
+#include "phalcon.h"
+
+#include "Zend/zend_operators.h"
+#include "Zend/zend_exceptions.h"
+#include "Zend/zend_interfaces.h"
+
+#include "kernel/main.h"
+#include "kernel/memory.h"
+
+#include "kernel/object.h"
+#include "kernel/array.h"
+#include "kernel/operators.h"
+#include "kernel/exception.h"
+#include "kernel/fcall.h"
+#include "kernel/concat.h"
+#include "kernel/string.h"
+
+/**
+ * Phalcon\Paginator\Adapter\QueryBuilder
+ *
+ * This adapter paginates a Phalcon\Mvc\Model\Query\Builder. Only the rows of the current page
+ * are requested from the database (LIMIT/OFFSET) and the total is obtained with a separate COUNT
+ * that can be stored in a cache backend
+ *
+ *<code>
+ * $builder = $this->modelsManager->createBuilder()
+ *		->from('Robots')
+ *		->orderBy('name');
+ *
+ * $paginator = new Phalcon\Paginator\Adapter\QueryBuilder(array(
+ *	'builder' => $builder,
+ *	'limit' => 20,
+ *	'page' => 3,
+ *	'countCache' => array('key' => 'robots-count', 'lifetime' => 300)
+ * ));
+ *</code>
+ *
+ * Deep pages can be requested with the seek method using a 'keyset' column instead of an OFFSET:
+ *
+ *<code>
+ * $paginator = new Phalcon\Paginator\Adapter\QueryBuilder(array(
+ *	'builder' => $builder,
+ *	'limit' => 20,
+ *	'keyset' => 'id'
+ * ));
+ * $paginator->setCursor($lastId);
+ *</code>
+ *
+ * When the keyset column isn't the primary key, rows with the same value are ordered by the primary
+ * key and the cursor is an array with both values, like the 'next' property of the page
+ */
+
+
+/**
+ * Phalcon\Paginator\Adapter\QueryBuilder initializer
+ */
+PHALCON_INIT_CLASS(Phalcon_Paginator_Adapter_QueryBuilder){
+
+	PHALCON_REGISTER_CLASS(Phalcon\\Paginator\\Adapter, QueryBuilder, paginator_adapter_querybuilder, phalcon_paginator_adapter_querybuilder_method_entry, 0);
+
+	zend_declare_property_null(phalcon_paginator_adapter_querybuilder_ce, SL("_config"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_paginator_adapter_querybuilder_ce, SL("_builder"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_paginator_adapter_querybuilder_ce, SL("_limitRows"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_paginator_adapter_querybuilder_ce, SL("_page"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_paginator_adapter_querybuilder_ce, SL("_cursor"), ZEND_ACC_PROTECTED TSRMLS_CC);
+
+	zend_class_implements(phalcon_paginator_adapter_querybuilder_ce TSRMLS_CC, 1, phalcon_paginator_adapterinterface_ce);
+
+	return SUCCESS;
+}
+
+/**
+ * Phalcon\Paginator\Adapter\QueryBuilder constructor
+ *
+ * @param array $config
+ */
+PHP_METHOD(Phalcon_Paginator_Adapter_QueryBuilder, __construct){
+
+	zval *config, *builder, *limit, *page, *cursor;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &config) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (Z_TYPE_P(config) != IS_ARRAY) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_paginator_exception_ce, "Invalid configuration for paginator");
+		return;
+	}
+
+	if (!phalcon_array_isset_string(config, SS("builder"))) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_paginator_exception_ce, "Parameter 'builder' is required");
+		return;
+	}
+
+	PHALCON_OBS_VAR(builder);
+	phalcon_array_fetch_string(&builder, config, SL("builder"), PH_NOISY_CC);
+	if (Z_TYPE_P(builder) != IS_OBJECT) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_paginator_exception_ce, "Invalid data for paginator");
+		return;
+	}
+
+	phalcon_update_property_zval(this_ptr, SL("_config"), config TSRMLS_CC);
+	phalcon_update_property_zval(this_ptr, SL("_builder"), builder TSRMLS_CC);
+
+	if (phalcon_array_isset_string(config, SS("limit"))) {
+		PHALCON_OBS_VAR(limit);
+		phalcon_array_fetch_string(&limit, config, SL("limit"), PH_NOISY_CC);
+		phalcon_update_property_zval(this_ptr, SL("_limitRows"), limit TSRMLS_CC);
+	}
+
+	if (phalcon_array_isset_string(config, SS("page"))) {
+		PHALCON_OBS_VAR(page);
+		phalcon_array_fetch_string(&page, config, SL("page"), PH_NOISY_CC);
+		phalcon_update_property_zval(this_ptr, SL("_page"), page TSRMLS_CC);
+	}
+
+	if (phalcon_array_isset_string(config, SS("cursor"))) {
+		PHALCON_OBS_VAR(cursor);
+		phalcon_array_fetch_string(&cursor, config, SL("cursor"), PH_NOISY_CC);
+		phalcon_update_property_zval(this_ptr, SL("_cursor"), cursor TSRMLS_CC);
+	}
+
+	PHALCON_MM_RESTORE();
+}
+
+/**
+ * Set the current page number
+ *
+ * @param int $page
+ */
+PHP_METHOD(Phalcon_Paginator_Adapter_QueryBuilder, setCurrentPage){
+
+	zval *page;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &page) == FAILURE) {
+		RETURN_NULL();
+	}
+
+	phalcon_update_property_zval(this_ptr, SL("_page"), page TSRMLS_CC);
+
+}
+
+/**
+ * Sets the cursor used in keyset mode, this is the value of the keyset column in the last row of the previous page.
+ * If the keyset column isn't the primary key the cursor is an array with the keyset and primary key values
+ *
+ * @param mixed $cursor
+ */
+PHP_METHOD(Phalcon_Paginator_Adapter_QueryBuilder, setCursor){
+
+	zval *cursor;
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &cursor) == FAILURE) {
+		RETURN_NULL();
+	}
+
+	phalcon_update_property_zval(this_ptr, SL("_cursor"), cursor TSRMLS_CC);
+
+}
+
+/**
+ * Returns the total number of rows matched by the builder, the COUNT is read from/stored in a cache backend
+ * when a 'countCache' option is passed in the configuration
+ *
+ * @return int
+ */
+PHP_METHOD(Phalcon_Paginator_Adapter_QueryBuilder, getTotalItems){
+
+	zval *config, *builder, *bind_params = NULL, *bind_types = NULL;
+	zval *count_cache = NULL, *key = NULL, *lifetime = NULL, *cache_service = NULL;
+	zval *dependency_injector = NULL, *cache = NULL, *total = NULL;
+	zval *count_builder, *group, *count_columns = NULL, *count_query;
+
+	PHALCON_MM_GROW();
+
+	PHALCON_OBS_VAR(config);
+	phalcon_read_property(&config, this_ptr, SL("_config"), PH_NOISY_CC);
+
+	PHALCON_OBS_VAR(builder);
+	phalcon_read_property(&builder, this_ptr, SL("_builder"), PH_NOISY_CC);
+
+	if (phalcon_array_isset_string(config, SS("bind"))) {
+		PHALCON_OBS_VAR(bind_params);
+		phalcon_array_fetch_string(&bind_params, config, SL("bind"), PH_NOISY_CC);
+	} else {
+		PHALCON_INIT_VAR(bind_params);
+	}
+
+	if (phalcon_array_isset_string(config, SS("bindTypes"))) {
+		PHALCON_OBS_VAR(bind_types);
+		phalcon_array_fetch_string(&bind_types, config, SL("bindTypes"), PH_NOISY_CC);
+	} else {
+		PHALCON_INIT_VAR(bind_types);
+	}
+
+	PHALCON_INIT_VAR(cache);
+
+	if (phalcon_array_isset_string(config, SS("countCache"))) {
+
+		PHALCON_OBS_VAR(count_cache);
+		phalcon_array_fetch_string(&count_cache, config, SL("countCache"), PH_NOISY_CC);
+		if (Z_TYPE_P(count_cache) != IS_ARRAY) {
+			PHALCON_THROW_EXCEPTION_STR(phalcon_paginator_exception_ce, "Invalid caching options");
+			return;
+		}
+
+		if (!phalcon_array_isset_string(count_cache, SS("key"))) {
+			PHALCON_THROW_EXCEPTION_STR(phalcon_paginator_exception_ce, "A cache key must be provided to identify the cached total");
+			return;
+		}
+
+		PHALCON_OBS_VAR(key);
+		phalcon_array_fetch_string(&key, count_cache, SL("key"), PH_NOISY_CC);
+
+		/**
+		 * By defaut use use 3600 seconds (1 hour) as cache lifetime
+		 */
+		if (phalcon_array_isset_string(count_cache, SS("lifetime"))) {
+			PHALCON_OBS_VAR(lifetime);
+			phalcon_array_fetch_string(&lifetime, count_cache, SL("lifetime"), PH_NOISY_CC);
+		} else {
+			PHALCON_INIT_VAR(lifetime);
+			ZVAL_LONG(lifetime, 3600);
+		}
+
+		/**
+		 * 'modelsCache' is the default name for the models cache service
+		 */
+		if (phalcon_array_isset_string(count_cache, SS("service"))) {
+			PHALCON_OBS_VAR(cache_service);
+			phalcon_array_fetch_string(&cache_service, count_cache, SL("service"), PH_NOISY_CC);
+		} else {
+			PHALCON_INIT_VAR(cache_service);
+			ZVAL_STRING(cache_service, "modelsCache", 1);
+		}
+
+		PHALCON_INIT_VAR(dependency_injector);
+		PHALCON_CALL_METHOD(dependency_injector, builder, "getdi");
+		if (Z_TYPE_P(dependency_injector) != IS_OBJECT) {
+			PHALCON_INIT_NVAR(dependency_injector);
+			PHALCON_CALL_STATIC(dependency_injector, "phalcon\\di", "getdefault");
+		}
+
+		PHALCON_INIT_NVAR(cache);
+		PHALCON_CALL_METHOD_PARAMS_1(cache, dependency_injector, "getshared", cache_service);
+		if (Z_TYPE_P(cache) != IS_OBJECT) {
+			PHALCON_THROW_EXCEPTION_STR(phalcon_paginator_exception_ce, "The cache service must be an object");
+			return;
+		}
+
+		PHALCON_INIT_VAR(total);
+		PHALCON_CALL_METHOD_PARAMS_2(total, cache, "get", key, lifetime);
+		if (Z_TYPE_P(total) != IS_NULL) {
+			RETURN_CCTOR(total);
+		}
+	}
+
+	/**
+	 * The COUNT is executed over a copy of the builder without ORDER and LIMIT clauses
+	 */
+	PHALCON_INIT_VAR(count_builder);
+	if (phalcon_clone(count_builder, builder TSRMLS_CC) == FAILURE) {
+		return;
+	}
+
+	phalcon_update_property_null(count_builder, SL("_order") TSRMLS_CC);
+	phalcon_update_property_null(count_builder, SL("_limit") TSRMLS_CC);
+	phalcon_update_property_null(count_builder, SL("_offset") TSRMLS_CC);
+
+	PHALCON_INIT_VAR(group);
+	PHALCON_CALL_METHOD(group, count_builder, "getgroupby");
+	if (Z_TYPE_P(group) == IS_NULL) {
+
+		PHALCON_INIT_VAR(count_columns);
+		ZVAL_STRING(count_columns, "COUNT(*) AS rowcount", 1);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(count_builder, "columns", count_columns);
+
+		PHALCON_INIT_VAR(count_query);
+		PHALCON_CALL_METHOD(count_query, count_builder, "getquery");
+
+		/**
+		 * The scalar is fetched without building a resultset
+		 */
+		PHALCON_INIT_NVAR(total);
+		PHALCON_CALL_METHOD_PARAMS_2(total, count_query, "getsinglescalar", bind_params, bind_types);
+	} else {
+		/**
+		 * Grouped builders are counted by the database wrapping the grouped query in a COUNT(*)
+		 */
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(count_builder, "columns", group);
+
+		PHALCON_INIT_VAR(count_query);
+		PHALCON_CALL_METHOD(count_query, count_builder, "getquery");
+
+		PHALCON_INIT_NVAR(total);
+		PHALCON_CALL_METHOD_PARAMS_2(total, count_query, "getrowcount", bind_params, bind_types);
+	}
+
+	convert_to_long(total);
+
+	if (Z_TYPE_P(cache) == IS_OBJECT) {
+		PHALCON_CALL_METHOD_PARAMS_3_NORETURN(cache, "save", key, total, lifetime);
+	}
+
+	RETURN_CCTOR(total);
+}
+
+/**
+ * Returns a slice of the resultset to show in the pagination
+ *
+ * @return stdClass
+ */
+PHP_METHOD(Phalcon_Paginator_Adapter_QueryBuilder, getPaginate){
+
+	zval *show, *config, *builder, *bind_params = NULL, *bind_types = NULL;
+	zval *page_builder, *page, *limit, *offset, *query, *items;
+	zval *page_number, *total, *first, *before, *current, *next = NULL;
+	zval *last, *keyset, *cursor, *descending = NULL, *conditions;
+	zval *keyset_condition, *new_conditions = NULL, *order;
+	zval *last_row, *attribute = NULL, *count, *model_alias = NULL;
+	zval *models, *model_name = NULL, *dependency_injector = NULL;
+	zval *service_name, *manager, *model, *meta_data, *primary_keys;
+	zval *primary_key = NULL, *column_map, *tie_breaker = NULL;
+	zval *cursor_value = NULL, *cursor_tie = NULL, *next_value = NULL, *next_tie;
+	long i_show, i_page, i_total, i_pages;
+	char *dot;
+
+	PHALCON_MM_GROW();
+
+	PHALCON_OBS_VAR(show);
+	phalcon_read_property(&show, this_ptr, SL("_limitRows"), PH_NOISY_CC);
+
+	i_show = phalcon_get_intval(show);
+	if (i_show <= 0) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_paginator_exception_ce, "The limit number is zero or less");
+		return;
+	}
+
+	PHALCON_OBS_VAR(config);
+	phalcon_read_property(&config, this_ptr, SL("_config"), PH_NOISY_CC);
+
+	PHALCON_OBS_VAR(builder);
+	phalcon_read_property(&builder, this_ptr, SL("_builder"), PH_NOISY_CC);
+
+	if (phalcon_array_isset_string(config, SS("bind"))) {
+		PHALCON_OBS_VAR(bind_params);
+		phalcon_array_fetch_string(&bind_params, config, SL("bind"), PH_NOISY_CC);
+	} else {
+		PHALCON_INIT_VAR(bind_params);
+	}
+
+	if (phalcon_array_isset_string(config, SS("bindTypes"))) {
+		PHALCON_OBS_VAR(bind_types);
+		phalcon_array_fetch_string(&bind_types, config, SL("bindTypes"), PH_NOISY_CC);
+	} else {
+		PHALCON_INIT_VAR(bind_types);
+	}
+
+	/**
+	 * The builder passed by the user is never modified
+	 */
+	PHALCON_INIT_VAR(page_builder);
+	if (phalcon_clone(page_builder, builder TSRMLS_CC) == FAILURE) {
+		return;
+	}
+
+	PHALCON_INIT_VAR(limit);
+	ZVAL_LONG(limit, i_show);
+
+	PHALCON_INIT_VAR(page);
+	object_init(page);
+
+	if (phalcon_array_isset_string(config, SS("keyset"))) {
+
+		/**
+		 * Keyset mode: the rows after the cursor are located using the index of the keyset column
+		 */
+		PHALCON_OBS_VAR(keyset);
+		phalcon_array_fetch_string(&keyset, config, SL("keyset"), PH_NOISY_CC);
+		if (Z_TYPE_P(keyset) != IS_STRING) {
+			PHALCON_THROW_EXCEPTION_STR(phalcon_paginator_exception_ce, "The keyset column must be a string");
+			return;
+		}
+
+		if (phalcon_array_isset_string(config, SS("descending"))) {
+			PHALCON_OBS_VAR(descending);
+			phalcon_array_fetch_string(&descending, config, SL("descending"), PH_NOISY_CC);
+		} else {
+			PHALCON_INIT_VAR(descending);
+			ZVAL_BOOL(descending, 0);
+		}
+
+		dot = strrchr(Z_STRVAL_P(keyset), '.');
+		if (dot) {
+			PHALCON_INIT_VAR(attribute);
+			ZVAL_STRING(attribute, dot + 1, 1);
+
+			PHALCON_INIT_VAR(model_alias);
+			ZVAL_STRINGL(model_alias, Z_STRVAL_P(keyset), dot - Z_STRVAL_P(keyset), 1);
+		} else {
+			PHALCON_CPY_WRT(attribute, keyset);
+		}
+
+		/**
+		 * Rows with the same keyset value are ordered by the primary key of the model, unless the
+		 * keyset column is the primary key itself
+		 */
+		PHALCON_INIT_VAR(models);
+		PHALCON_CALL_METHOD(models, page_builder, "getfrom");
+		if (Z_TYPE_P(models) == IS_ARRAY) {
+			if (model_alias && phalcon_array_isset(models, model_alias)) {
+				PHALCON_OBS_VAR(model_name);
+				phalcon_array_fetch(&model_name, models, model_alias, PH_NOISY_CC);
+			} else {
+				PHALCON_INIT_VAR(model_name);
+				phalcon_array_get_current(model_name, models TSRMLS_CC);
+			}
+		} else {
+			PHALCON_CPY_WRT(model_name, models);
+		}
+
+		PHALCON_INIT_VAR(dependency_injector);
+		PHALCON_CALL_METHOD(dependency_injector, page_builder, "getdi");
+		if (Z_TYPE_P(dependency_injector) != IS_OBJECT) {
+			PHALCON_INIT_NVAR(dependency_injector);
+			PHALCON_CALL_STATIC(dependency_injector, "phalcon\\di", "getdefault");
+		}
+
+		PHALCON_INIT_VAR(service_name);
+		ZVAL_STRING(service_name, "modelsManager", 1);
+
+		PHALCON_INIT_VAR(manager);
+		PHALCON_CALL_METHOD_PARAMS_1(manager, dependency_injector, "getshared", service_name);
+
+		PHALCON_INIT_VAR(model);
+		PHALCON_CALL_METHOD_PARAMS_1(model, manager, "load", model_name);
+
+		PHALCON_INIT_VAR(meta_data);
+		PHALCON_CALL_METHOD(meta_data, model, "getmodelsmetadata");
+
+		PHALCON_INIT_VAR(primary_keys);
+		PHALCON_CALL_METHOD_PARAMS_1(primary_keys, meta_data, "getprimarykeyattributes", model);
+		if (phalcon_fast_count_ev(primary_keys TSRMLS_CC) != 1 || !phalcon_array_isset_long(primary_keys, 0)) {
+			PHALCON_THROW_EXCEPTION_STR(phalcon_paginator_exception_ce, "The keyset mode requires a model with a single column primary key");
+			return;
+		}
+
+		PHALCON_OBS_VAR(primary_key);
+		phalcon_array_fetch_long(&primary_key, primary_keys, 0, PH_NOISY_CC);
+
+		/**
+		 * The PHQL contains the renamed columns if available
+		 */
+		if (PHALCON_GLOBAL(orm).column_renaming) {
+			PHALCON_INIT_VAR(column_map);
+			PHALCON_CALL_METHOD_PARAMS_1(column_map, meta_data, "getcolumnmap", model);
+			if (Z_TYPE_P(column_map) == IS_ARRAY && phalcon_array_isset(column_map, primary_key)) {
+				PHALCON_OBS_NVAR(primary_key);
+				phalcon_array_fetch(&primary_key, column_map, primary_key, PH_NOISY_CC);
+			}
+		}
+
+		if (!PHALCON_IS_EQUAL(primary_key, attribute)) {
+			if (model_alias) {
+				PHALCON_INIT_VAR(tie_breaker);
+				PHALCON_CONCAT_VSV(tie_breaker, model_alias, ".", primary_key);
+			} else {
+				PHALCON_CPY_WRT(tie_breaker, primary_key);
+			}
+		}
+
+		PHALCON_OBS_VAR(cursor);
+		phalcon_read_property(&cursor, this_ptr, SL("_cursor"), PH_NOISY_CC);
+		if (Z_TYPE_P(cursor) != IS_NULL) {
+
+			/**
+			 * The cursor has the keyset and primary key values of the last row when ties are broken
+			 */
+			if (tie_breaker) {
+				if (Z_TYPE_P(cursor) != IS_ARRAY || !phalcon_array_isset_long(cursor, 0) || !phalcon_array_isset_long(cursor, 1)) {
+					PHALCON_THROW_EXCEPTION_STR(phalcon_paginator_exception_ce, "The cursor must be an array with the keyset and primary key values");
+					return;
+				}
+
+				PHALCON_OBS_VAR(cursor_value);
+				phalcon_array_fetch_long(&cursor_value, cursor, 0, PH_NOISY_CC);
+
+				PHALCON_OBS_VAR(cursor_tie);
+				phalcon_array_fetch_long(&cursor_tie, cursor, 1, PH_NOISY_CC);
+			} else {
+				PHALCON_CPY_WRT(cursor_value, cursor);
+			}
+
+			PHALCON_INIT_VAR(keyset_condition);
+			if (tie_breaker) {
+				if (zend_is_true(descending)) {
+					PHALCON_CONCAT_VSVSVS(keyset_condition, keyset, " < :keysetCursor: OR (", keyset, " = :keysetValue: AND ", tie_breaker, " < :keysetTie:)");
+				} else {
+					PHALCON_CONCAT_VSVSVS(keyset_condition, keyset, " > :keysetCursor: OR (", keyset, " = :keysetValue: AND ", tie_breaker, " > :keysetTie:)");
+				}
+			} else {
+				if (zend_is_true(descending)) {
+					PHALCON_CONCAT_VS(keyset_condition, keyset, " < :keysetCursor:");
+				} else {
+					PHALCON_CONCAT_VS(keyset_condition, keyset, " > :keysetCursor:");
+				}
+			}
+
+			PHALCON_INIT_VAR(conditions);
+			PHALCON_CALL_METHOD(conditions, page_builder, "getwhere");
+			if (zend_is_true(conditions)) {
+				PHALCON_INIT_VAR(new_conditions);
+				PHALCON_CONCAT_SVSVS(new_conditions, "(", conditions, ") AND (", keyset_condition, ")");
+			} else {
+				PHALCON_CPY_WRT(new_conditions, keyset_condition);
+			}
+			PHALCON_CALL_METHOD_PARAMS_1_NORETURN(page_builder, "where", new_conditions);
+
+			if (Z_TYPE_P(bind_params) == IS_ARRAY) {
+				PHALCON_SEPARATE(bind_params);
+			} else {
+				PHALCON_INIT_NVAR(bind_params);
+				array_init(bind_params);
+			}
+			phalcon_array_update_string(&bind_params, SL("keysetCursor"), &cursor_value, PH_COPY | PH_SEPARATE TSRMLS_CC);
+			if (tie_breaker) {
+				phalcon_array_update_string(&bind_params, SL("keysetValue"), &cursor_value, PH_COPY | PH_SEPARATE TSRMLS_CC);
+				phalcon_array_update_string(&bind_params, SL("keysetTie"), &cursor_tie, PH_COPY | PH_SEPARATE TSRMLS_CC);
+			}
+		}
+
+		PHALCON_INIT_VAR(order);
+		if (tie_breaker) {
+			if (zend_is_true(descending)) {
+				PHALCON_CONCAT_VSVS(order, keyset, " DESC, ", tie_breaker, " DESC");
+			} else {
+				PHALCON_CONCAT_VSVS(order, keyset, " ASC, ", tie_breaker, " ASC");
+			}
+		} else {
+			if (zend_is_true(descending)) {
+				PHALCON_CONCAT_VS(order, keyset, " DESC");
+			} else {
+				PHALCON_CONCAT_VS(order, keyset, " ASC");
+			}
+		}
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(page_builder, "orderby", order);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(page_builder, "limit", limit);
+
+		PHALCON_INIT_VAR(query);
+		PHALCON_CALL_METHOD(query, page_builder, "getquery");
+
+		PHALCON_INIT_VAR(items);
+		PHALCON_CALL_METHOD_PARAMS_2(items, query, "execute", bind_params, bind_types);
+
+		PHALCON_INIT_VAR(count);
+		phalcon_fast_count(count, items TSRMLS_CC);
+
+		/**
+		 * A full page means there could be more rows, the next cursor is taken from the last row
+		 */
+		PHALCON_INIT_VAR(next);
+		if (phalcon_get_intval(count) == i_show) {
+
+			PHALCON_INIT_VAR(last_row);
+			PHALCON_CALL_METHOD(last_row, items, "getlast");
+			PHALCON_CALL_METHOD_NORETURN(items, "rewind");
+
+			if (Z_TYPE_P(last_row) == IS_OBJECT) {
+				PHALCON_OBS_NVAR(next);
+				phalcon_read_property_zval(&next, last_row, attribute, PH_NOISY_CC);
+				if (tie_breaker) {
+					PHALCON_OBS_VAR(next_tie);
+					phalcon_read_property_zval(&next_tie, last_row, primary_key, PH_NOISY_CC);
+
+					PHALCON_CPY_WRT(next_value, next);
+
+					PHALCON_INIT_NVAR(next);
+					array_init_size(next, 2);
+					phalcon_array_append(&next, next_value, PH_SEPARATE TSRMLS_CC);
+					phalcon_array_append(&next, next_tie, PH_SEPARATE TSRMLS_CC);
+				}
+			}
+		}
+
+		phalcon_update_property_zval(page, SL("items"), items TSRMLS_CC);
+		phalcon_update_property_zval(page, SL("current"), cursor TSRMLS_CC);
+		phalcon_update_property_zval(page, SL("next"), next TSRMLS_CC);
+
+		RETURN_CTOR(page);
+	}
+
+	PHALCON_OBS_VAR(page_number);
+	phalcon_read_property(&page_number, this_ptr, SL("_page"), PH_NOISY_CC);
+	if (Z_TYPE_P(page_number) == IS_NULL) {
+		i_page = 1;
+	} else {
+		i_page = phalcon_get_intval(page_number);
+	}
+
+	if (i_page <= 0) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_paginator_exception_ce, "The start page number is zero or less");
+		return;
+	}
+
+	/**
+	 * Only the rows in the requested page are fetched
+	 */
+	PHALCON_INIT_VAR(offset);
+	ZVAL_LONG(offset, (i_page - 1) * i_show);
+	PHALCON_CALL_METHOD_PARAMS_2_NORETURN(page_builder, "limit", limit, offset);
+
+	PHALCON_INIT_VAR(query);
+	PHALCON_CALL_METHOD(query, page_builder, "getquery");
+
+	PHALCON_INIT_VAR(items);
+	PHALCON_CALL_METHOD_PARAMS_2(items, query, "execute", bind_params, bind_types);
+
+	PHALCON_INIT_VAR(total);
+	PHALCON_CALL_METHOD(total, this_ptr, "gettotalitems");
+
+	i_total = phalcon_get_intval(total);
+	i_pages = (i_total + i_show - 1) / i_show;
+
+	PHALCON_INIT_VAR(first);
+	ZVAL_LONG(first, 1);
+
+	PHALCON_INIT_VAR(before);
+	ZVAL_LONG(before, i_page > 1 ? i_page - 1 : 1);
+
+	PHALCON_INIT_VAR(current);
+	ZVAL_LONG(current, i_page);
+
+	PHALCON_INIT_NVAR(next);
+	ZVAL_LONG(next, i_page < i_pages ? i_page + 1 : i_pages);
+
+	PHALCON_INIT_VAR(last);
+	ZVAL_LONG(last, i_pages);
+
+	phalcon_update_property_zval(page, SL("items"), items TSRMLS_CC);
+	phalcon_update_property_zval(page, SL("first"), first TSRMLS_CC);
+	phalcon_update_property_zval(page, SL("before"), before TSRMLS_CC);
+	phalcon_update_property_zval(page, SL("current"), current TSRMLS_CC);
+	phalcon_update_property_zval(page, SL("last"), last TSRMLS_CC);
+	phalcon_update_property_zval(page, SL("next"), next TSRMLS_CC);
+	phalcon_update_property_zval(page, SL("total_pages"), last TSRMLS_CC);
+	phalcon_update_property_zval(page, SL("total_items"), total TSRMLS_CC);
+
+	RETURN_CTOR(page);
+}
+
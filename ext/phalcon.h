@@ -116,6 +116,7 @@
 #include "paginator/exception.h"
 #include "paginator/adapter/model.h"
 #include "paginator/adapter/nativearray.h"
+#include "paginator/adapter/querybuilder.h"
 #include "validation.h"
 #include "validation/message.h"
 #include "validation/exception.h"
@@ -220,6 +221,7 @@
 #include "http/response/exception.h"
 #include "queue/beanstalk.h"
 #include "queue/beanstalk/job.h"
+#include "queue/beanstalk/worker.h"
 #include "mvc/view.h"
 #include "mvc/url.h"
 #include "mvc/micro.h"
@@ -231,6 +233,7 @@
 #include "mvc/collection/exception.h"
 #include "mvc/collection/manager.h"
 #include "mvc/collection/managerinterface.h"
+#include "mvc/collection/resultset.h"
 #include "mvc/controllerinterface.h"
 #include "mvc/dispatcher.h"
 #include "mvc/dispatcher/exception.h"
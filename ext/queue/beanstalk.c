@@ -40,6 +40,11 @@
 #include "kernel/concat.h"
 #include "kernel/operators.h"
 
+#define PHALCON_BEANSTALK_ENCODER_SERIALIZE 0
+#define PHALCON_BEANSTALK_ENCODER_RAW 1
+#define PHALCON_BEANSTALK_ENCODER_JSON 2
+#define PHALCON_BEANSTALK_ENCODER_IGBINARY 3
+
 /**
  * Phalcon\Queue\Beanstalk
  *
@@ -50,6 +55,67 @@
  */
 
 
+/**
+ * Encodes a job body with the encoder of the connection, it could be one of the ENCODER_* constants
+ * or an object implementing encode/decode
+ */
+static int phalcon_queue_beanstalk_encode(zval *return_value, zval *encoder, zval *data TSRMLS_DC){
+
+	if (Z_TYPE_P(encoder) == IS_OBJECT) {
+		return phalcon_call_method_one_param(return_value, encoder, SL("encode"), data, 1 PH_MEHASH_C TSRMLS_CC);
+	}
+
+	switch (phalcon_get_intval(encoder)) {
+
+		case PHALCON_BEANSTALK_ENCODER_RAW:
+			ZVAL_ZVAL(return_value, data, 1, 0);
+			convert_to_string(return_value);
+			return SUCCESS;
+
+		case PHALCON_BEANSTALK_ENCODER_JSON:
+			return phalcon_call_func_one_param(return_value, SL("json_encode"), data, 1 TSRMLS_CC);
+
+		case PHALCON_BEANSTALK_ENCODER_IGBINARY:
+			return phalcon_call_func_one_param(return_value, SL("igbinary_serialize"), data, 1 TSRMLS_CC);
+
+	}
+
+	return phalcon_call_func_one_param(return_value, SL("serialize"), data, 1 TSRMLS_CC);
+}
+
+/**
+ * Decodes a job body read from the server
+ */
+static int phalcon_queue_beanstalk_decode(zval *return_value, zval *encoder, zval *payload TSRMLS_DC){
+
+	zval *assoc;
+	int status;
+
+	if (Z_TYPE_P(encoder) == IS_OBJECT) {
+		return phalcon_call_method_one_param(return_value, encoder, SL("decode"), payload, 1 PH_MEHASH_C TSRMLS_CC);
+	}
+
+	switch (phalcon_get_intval(encoder)) {
+
+		case PHALCON_BEANSTALK_ENCODER_RAW:
+			ZVAL_ZVAL(return_value, payload, 1, 0);
+			return SUCCESS;
+
+		case PHALCON_BEANSTALK_ENCODER_JSON:
+			MAKE_STD_ZVAL(assoc);
+			ZVAL_BOOL(assoc, 1);
+			status = phalcon_call_func_two_params(return_value, SL("json_decode"), payload, assoc, 1 TSRMLS_CC);
+			zval_ptr_dtor(&assoc);
+			return status;
+
+		case PHALCON_BEANSTALK_ENCODER_IGBINARY:
+			return phalcon_call_func_one_param(return_value, SL("igbinary_unserialize"), payload, 1 TSRMLS_CC);
+
+	}
+
+	return phalcon_call_func_one_param(return_value, SL("unserialize"), payload, 1 TSRMLS_CC);
+}
+
 /**
  * Phalcon\Queue\Beanstalk initializer
  */
@@ -59,6 +125,12 @@ PHALCON_INIT_CLASS(Phalcon_Queue_Beanstalk){
 
 	zend_declare_property_null(phalcon_queue_beanstalk_ce, SL("_connection"), ZEND_ACC_PROTECTED TSRMLS_CC);
 	zend_declare_property_null(phalcon_queue_beanstalk_ce, SL("_parameters"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_long(phalcon_queue_beanstalk_ce, SL("_encoder"), 0, ZEND_ACC_PROTECTED TSRMLS_CC);
+
+	zend_declare_class_constant_long(phalcon_queue_beanstalk_ce, SL("ENCODER_SERIALIZE"), PHALCON_BEANSTALK_ENCODER_SERIALIZE TSRMLS_CC);
+	zend_declare_class_constant_long(phalcon_queue_beanstalk_ce, SL("ENCODER_RAW"), PHALCON_BEANSTALK_ENCODER_RAW TSRMLS_CC);
+	zend_declare_class_constant_long(phalcon_queue_beanstalk_ce, SL("ENCODER_JSON"), PHALCON_BEANSTALK_ENCODER_JSON TSRMLS_CC);
+	zend_declare_class_constant_long(phalcon_queue_beanstalk_ce, SL("ENCODER_IGBINARY"), PHALCON_BEANSTALK_ENCODER_IGBINARY TSRMLS_CC);
 
 	return SUCCESS;
 }
@@ -70,7 +142,7 @@ PHALCON_INIT_CLASS(Phalcon_Queue_Beanstalk){
  */
 PHP_METHOD(Phalcon_Queue_Beanstalk, __construct){
 
-	zval *options = NULL, *parameters = NULL;
+	zval *options = NULL, *parameters = NULL, *encoder;
 
 	PHALCON_MM_GROW();
 
@@ -96,6 +168,12 @@ PHP_METHOD(Phalcon_Queue_Beanstalk, __construct){
 		phalcon_array_update_string_long(&parameters, SL("port"), 11300, PH_SEPARATE TSRMLS_CC);
 	}
 	
+	if (phalcon_array_isset_string(parameters, SS("encoder"))) {
+		PHALCON_OBS_VAR(encoder);
+		phalcon_array_fetch_string(&encoder, parameters, SL("encoder"), PH_NOISY_CC);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(this_ptr, "setencoder", encoder);
+	}
+	
 	phalcon_update_property_zval(this_ptr, SL("_parameters"), parameters TSRMLS_CC);
 	
 	PHALCON_MM_RESTORE();
@@ -155,6 +233,59 @@ PHP_METHOD(Phalcon_Queue_Beanstalk, connect){
 	RETURN_CCTOR(connection);
 }
 
+/**
+ * Sets the encoder used for the job bodies, it could be one of the ENCODER_* constants
+ * or an object implementing encode($data) and decode($payload). ENCODER_IGBINARY requires
+ * the igbinary extension
+ *
+ *<code>
+ * $queue->setEncoder(Phalcon\Queue\Beanstalk::ENCODER_JSON);
+ *</code>
+ *
+ * @param int|object $encoder
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk, setEncoder){
+
+	zval *encoder;
+	long type;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &encoder) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (Z_TYPE_P(encoder) != IS_OBJECT) {
+		type = phalcon_get_intval(encoder);
+		if (Z_TYPE_P(encoder) != IS_LONG || type < PHALCON_BEANSTALK_ENCODER_SERIALIZE || type > PHALCON_BEANSTALK_ENCODER_IGBINARY) {
+			PHALCON_THROW_EXCEPTION_STR(phalcon_exception_ce, "Invalid encoder");
+			return;
+		}
+
+		if (type == PHALCON_BEANSTALK_ENCODER_IGBINARY) {
+			if (phalcon_function_exists_ex(SS("igbinary_serialize") TSRMLS_CC) == FAILURE || phalcon_function_exists_ex(SS("igbinary_unserialize") TSRMLS_CC) == FAILURE) {
+				PHALCON_THROW_EXCEPTION_STR(phalcon_exception_ce, "The igbinary extension is required by ENCODER_IGBINARY");
+				return;
+			}
+		}
+	}
+	
+	phalcon_update_property_zval(this_ptr, SL("_encoder"), encoder TSRMLS_CC);
+	
+	PHALCON_MM_RESTORE();
+}
+
+/**
+ * Returns the encoder used for the job bodies
+ *
+ * @return int|object
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk, getEncoder){
+
+
+	RETURN_MEMBER(this_ptr, "_encoder");
+}
+
 /**
  * Inserts jobs into the queue
  *
@@ -165,7 +296,7 @@ PHP_METHOD(Phalcon_Queue_Beanstalk, put){
 
 	zval *data, *options = NULL, *priority = NULL, *delay = NULL, *ttr = NULL, *serialized;
 	zval *serialized_length, *command, *response;
-	zval *status, *job_id = NULL;
+	zval *status, *job_id = NULL, *encoder;
 
 	PHALCON_MM_GROW();
 
@@ -204,10 +335,15 @@ PHP_METHOD(Phalcon_Queue_Beanstalk, put){
 	}
 	
 	/** 
-	 * Data is automatically serialized before be sent to the server
+	 * Data is automatically encoded before be sent to the server
 	 */
+	PHALCON_OBS_VAR(encoder);
+	phalcon_read_property(&encoder, this_ptr, SL("_encoder"), PH_NOISY_CC);
+	
 	PHALCON_INIT_VAR(serialized);
-	PHALCON_CALL_FUNC_PARAMS_1(serialized, "serialize", data);
+	if (phalcon_queue_beanstalk_encode(serialized, encoder, data TSRMLS_CC) == FAILURE) {
+		return;
+	}
 	
 	PHALCON_INIT_VAR(serialized_length);
 	phalcon_fast_strlen(serialized_length, serialized);
@@ -241,14 +377,185 @@ PHP_METHOD(Phalcon_Queue_Beanstalk, put){
 	RETURN_MM_FALSE;
 }
 
+/**
+ * Inserts several jobs into the queue pipelining the commands: every window of 'batchSize'
+ * jobs is sent in a single buffered write and then all the responses are read in order.
+ * Returns the job id or false for every job, preserving the keys of the passed array
+ *
+ *<code>
+ * $ids = $queue->putMany(array($first, $second, $third), array('priority' => 50));
+ *</code>
+ *
+ * @param array $jobs
+ * @param array $options
+ * @return array
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk, putMany){
+
+	zval *jobs, *options = NULL, *priority = NULL, *delay = NULL, *ttr = NULL;
+	zval *batch_size = NULL, *encoder, *preserve_keys, *chunks, *results;
+	zval *chunk = NULL, *commands = NULL, *keys = NULL, *key = NULL, *data = NULL;
+	zval *serialized = NULL, *serialized_length = NULL, *command = NULL;
+	zval *buffer = NULL, *response = NULL, *status = NULL, *job_id = NULL;
+	zval *job_key = NULL;
+	HashTable *ah0, *ah1, *ah2;
+	HashPosition hp0, hp1, hp2;
+	zval **hd;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &jobs, &options) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!options) {
+		PHALCON_INIT_VAR(options);
+	}
+	
+	if (Z_TYPE_P(jobs) != IS_ARRAY) { 
+		PHALCON_THROW_EXCEPTION_STR(phalcon_exception_ce, "Jobs must be an Array");
+		return;
+	}
+	
+	if (phalcon_array_isset_string(options, SS("priority"))) {
+		PHALCON_OBS_VAR(priority);
+		phalcon_array_fetch_string(&priority, options, SL("priority"), PH_NOISY_CC);
+	} else {
+		PHALCON_INIT_NVAR(priority);
+		ZVAL_STRING(priority, "100", 1);
+	}
+	
+	if (phalcon_array_isset_string(options, SS("delay"))) {
+		PHALCON_OBS_VAR(delay);
+		phalcon_array_fetch_string(&delay, options, SL("delay"), PH_NOISY_CC);
+	} else {
+		PHALCON_INIT_NVAR(delay);
+		ZVAL_STRING(delay, "0", 1);
+	}
+	
+	if (phalcon_array_isset_string(options, SS("ttr"))) {
+		PHALCON_OBS_VAR(ttr);
+		phalcon_array_fetch_string(&ttr, options, SL("ttr"), PH_NOISY_CC);
+	} else {
+		PHALCON_INIT_NVAR(ttr);
+		ZVAL_STRING(ttr, "86400", 1);
+	}
+	
+	/** 
+	 * The window is bounded to avoid filling the socket buffers of both sides without reading the responses
+	 */
+	if (phalcon_array_isset_string(options, SS("batchSize"))) {
+		PHALCON_OBS_VAR(batch_size);
+		phalcon_array_fetch_string(&batch_size, options, SL("batchSize"), PH_NOISY_CC);
+		if (phalcon_get_intval(batch_size) <= 0) {
+			PHALCON_THROW_EXCEPTION_STR(phalcon_exception_ce, "The batch size must be greater than zero");
+			return;
+		}
+	} else {
+		PHALCON_INIT_NVAR(batch_size);
+		ZVAL_LONG(batch_size, 1000);
+	}
+	
+	PHALCON_OBS_VAR(encoder);
+	phalcon_read_property(&encoder, this_ptr, SL("_encoder"), PH_NOISY_CC);
+	
+	PHALCON_INIT_VAR(preserve_keys);
+	ZVAL_BOOL(preserve_keys, 1);
+	
+	PHALCON_INIT_VAR(chunks);
+	PHALCON_CALL_FUNC_PARAMS_3(chunks, "array_chunk", jobs, batch_size, preserve_keys);
+	
+	PHALCON_INIT_VAR(results);
+	array_init(results);
+	
+	if (!phalcon_is_iterable(chunks, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_VALUE(chunk);
+	
+		PHALCON_INIT_NVAR(commands);
+		array_init(commands);
+	
+		PHALCON_INIT_NVAR(keys);
+		array_init(keys);
+	
+		if (!phalcon_is_iterable(chunk, &ah1, &hp1, 0, 0 TSRMLS_CC)) {
+			return;
+		}
+	
+		while (zend_hash_get_current_data_ex(ah1, (void**) &hd, &hp1) == SUCCESS) {
+	
+			PHALCON_GET_FOREACH_KEY(key, ah1, hp1);
+			PHALCON_GET_FOREACH_VALUE(data);
+	
+			PHALCON_INIT_NVAR(serialized);
+			if (phalcon_queue_beanstalk_encode(serialized, encoder, data TSRMLS_CC) == FAILURE) {
+				return;
+			}
+	
+			PHALCON_INIT_NVAR(serialized_length);
+			phalcon_fast_strlen(serialized_length, serialized);
+	
+			PHALCON_INIT_NVAR(command);
+			PHALCON_CONCAT_SVSV(command, "put ", priority, " ", delay);
+			PHALCON_SCONCAT_SVSV(command, " ", ttr, " ", serialized_length);
+			PHALCON_SCONCAT_SV(command, "\r\n", serialized);
+			phalcon_array_append(&commands, command, PH_SEPARATE TSRMLS_CC);
+			phalcon_array_append(&keys, key, PH_SEPARATE TSRMLS_CC);
+	
+			zend_hash_move_forward_ex(ah1, &hp1);
+		}
+	
+		/** 
+		 * The whole window is sent in one write, the last "\r\n" is appended by write()
+		 */
+		PHALCON_INIT_NVAR(buffer);
+		phalcon_fast_join_str(buffer, SL("\r\n"), commands TSRMLS_CC);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(this_ptr, "write", buffer);
+	
+		/** 
+		 * The server answers the commands in the same order they were sent
+		 */
+		if (!phalcon_is_iterable(keys, &ah2, &hp2, 0, 0 TSRMLS_CC)) {
+			return;
+		}
+	
+		while (zend_hash_get_current_data_ex(ah2, (void**) &hd, &hp2) == SUCCESS) {
+	
+			PHALCON_GET_FOREACH_VALUE(job_key);
+	
+			PHALCON_INIT_NVAR(response);
+			PHALCON_CALL_METHOD(response, this_ptr, "readstatus");
+	
+			PHALCON_OBS_NVAR(status);
+			phalcon_array_fetch_long(&status, response, 0, PH_NOISY_CC);
+			if (PHALCON_IS_STRING(status, "INSERTED") || PHALCON_IS_STRING(status, "BURIED")) {
+				PHALCON_OBS_NVAR(job_id);
+				phalcon_array_fetch_long(&job_id, response, 1, PH_NOISY_CC);
+				phalcon_array_update_zval(&results, job_key, &job_id, PH_COPY | PH_SEPARATE TSRMLS_CC);
+			} else {
+				phalcon_array_update_zval_bool(&results, job_key, 0, PH_SEPARATE TSRMLS_CC);
+			}
+	
+			zend_hash_move_forward_ex(ah2, &hp2);
+		}
+	
+		zend_hash_move_forward_ex(ah0, &hp0);
+	}
+	
+	RETURN_CTOR(results);
+}
+
 /**
  *
  * @return boolean|Phalcon\Queue\Beanstalk\Job
  */
 PHP_METHOD(Phalcon_Queue_Beanstalk, reserve){
 
-	zval *timeout = NULL, *command = NULL, *response, *status, *job_id;
-	zval *length, *serialized_body, *body, *job;
+	zval *timeout = NULL, *command = NULL, *job;
 
 	PHALCON_MM_GROW();
 
@@ -269,6 +576,25 @@ PHP_METHOD(Phalcon_Queue_Beanstalk, reserve){
 	}
 	PHALCON_CALL_METHOD_PARAMS_1_NORETURN(this_ptr, "write", command);
 	
+	PHALCON_INIT_VAR(job);
+	PHALCON_CALL_METHOD(job, this_ptr, "readjob");
+	
+	RETURN_CCTOR(job);
+}
+
+/**
+ * Reads the response to a reserve command already sent to the server.
+ * Returns false if the reserve timed out
+ *
+ * @return boolean|Phalcon\Queue\Beanstalk\Job
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk, readJob){
+
+	zval *response, *status, *job_id;
+	zval *length, *serialized_body, *body, *job, *encoder;
+
+	PHALCON_MM_GROW();
+
 	PHALCON_INIT_VAR(response);
 	PHALCON_CALL_METHOD(response, this_ptr, "readstatus");
 	
@@ -288,13 +614,18 @@ PHP_METHOD(Phalcon_Queue_Beanstalk, reserve){
 		phalcon_array_fetch_long(&length, response, 2, PH_NOISY_CC);
 	
 		/** 
-		 * The body is serialized
+		 * The body is encoded
 		 */
 		PHALCON_INIT_VAR(serialized_body);
 		PHALCON_CALL_METHOD_PARAMS_1(serialized_body, this_ptr, "read", length);
 	
+		PHALCON_OBS_VAR(encoder);
+		phalcon_read_property(&encoder, this_ptr, SL("_encoder"), PH_NOISY_CC);
+	
 		PHALCON_INIT_VAR(body);
-		PHALCON_CALL_FUNC_PARAMS_1(body, "unserialize", serialized_body);
+		if (phalcon_queue_beanstalk_decode(body, encoder, serialized_body TSRMLS_CC) == FAILURE) {
+			return;
+		}
 	
 		/** 
 		 * Create a beanstalk job abstraction
@@ -309,6 +640,117 @@ PHP_METHOD(Phalcon_Queue_Beanstalk, reserve){
 	RETURN_MM_FALSE;
 }
 
+/**
+ * Runs a worker loop reserving jobs with a timeout and passing them to the handler.
+ * The loop stops when the handler returns false, after 'maxJobs' jobs, after 'idleTimeouts'
+ * consecutive reserves without jobs or when the connection is lost.
+ * Returns the number of jobs passed to the handler
+ *
+ *<code>
+ * $queue->work(function($job) {
+ *     process($job->getBody());
+ *     $job->delete();
+ * }, array('timeout' => 5, 'maxJobs' => 1000));
+ *</code>
+ *
+ * @param callable $handler
+ * @param array $options
+ * @return int
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk, work){
+
+	zval *handler, *options = NULL, *timeout = NULL, *max_jobs, *idle_timeouts;
+	zval *job = NULL, *connection = NULL, *is_eof = NULL, *params = NULL, *status = NULL;
+	long processed = 0, idle = 0, max = 0, max_idle = 0;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &handler, &options) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!options) {
+		PHALCON_INIT_VAR(options);
+	}
+	
+	if (!phalcon_is_callable(handler TSRMLS_CC)) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_exception_ce, "The worker handler is not callable");
+		return;
+	}
+	
+	/** 
+	 * A worker never blocks forever, reserves time out every 5 seconds by default
+	 */
+	if (phalcon_array_isset_string(options, SS("timeout"))) {
+		PHALCON_OBS_VAR(timeout);
+		phalcon_array_fetch_string(&timeout, options, SL("timeout"), PH_NOISY_CC);
+	} else {
+		PHALCON_INIT_NVAR(timeout);
+		ZVAL_LONG(timeout, 5);
+	}
+	
+	if (phalcon_array_isset_string(options, SS("maxJobs"))) {
+		PHALCON_OBS_VAR(max_jobs);
+		phalcon_array_fetch_string(&max_jobs, options, SL("maxJobs"), PH_NOISY_CC);
+		max = phalcon_get_intval(max_jobs);
+	}
+	
+	if (phalcon_array_isset_string(options, SS("idleTimeouts"))) {
+		PHALCON_OBS_VAR(idle_timeouts);
+		phalcon_array_fetch_string(&idle_timeouts, options, SL("idleTimeouts"), PH_NOISY_CC);
+		max_idle = phalcon_get_intval(idle_timeouts);
+	}
+	
+	while (1) {
+	
+		PHALCON_INIT_NVAR(job);
+		PHALCON_CALL_METHOD_PARAMS_1(job, this_ptr, "reserve", timeout);
+		if (Z_TYPE_P(job) != IS_OBJECT) {
+	
+			/** 
+			 * A reserve without a job is a timeout unless the server closed the connection
+			 */
+			PHALCON_OBS_NVAR(connection);
+			phalcon_read_property(&connection, this_ptr, SL("_connection"), PH_NOISY_CC);
+			if (Z_TYPE_P(connection) != IS_RESOURCE) {
+				break;
+			}
+	
+			PHALCON_INIT_NVAR(is_eof);
+			PHALCON_CALL_FUNC_PARAMS_1(is_eof, "feof", connection);
+			if (zend_is_true(is_eof)) {
+				break;
+			}
+	
+			idle++;
+			if (max_idle > 0 && idle >= max_idle) {
+				break;
+			}
+			continue;
+		}
+	
+		idle = 0;
+		processed++;
+	
+		PHALCON_INIT_NVAR(params);
+		array_init_size(params, 1);
+		phalcon_array_append(&params, job, PH_SEPARATE TSRMLS_CC);
+	
+		PHALCON_INIT_NVAR(status);
+		PHALCON_CALL_USER_FUNC_ARRAY(status, handler, params);
+		if (PHALCON_IS_FALSE(status)) {
+			break;
+		}
+	
+		if (max > 0 && processed >= max) {
+			break;
+		}
+	}
+	
+	PHALCON_MM_RESTORE();
+	RETURN_LONG(processed);
+}
+
 /**
  * Change the active tube. By default the tube is 'default'
  *
@@ -377,6 +819,114 @@ PHP_METHOD(Phalcon_Queue_Beanstalk, watch){
 	RETURN_MM_FALSE;
 }
 
+/**
+ * Deletes several jobs pipelining the commands in windows of 'batchSize' jobs.
+ * Returns an array indexed by job id with the success of every delete
+ *
+ * @param array $ids
+ * @param array $options
+ * @return array
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk, deleteMany){
+
+	zval *ids, *options = NULL, *batch_size = NULL, *chunks, *results;
+	zval *chunk = NULL, *commands = NULL, *job_id = NULL, *command = NULL;
+	zval *buffer = NULL, *response = NULL, *status = NULL;
+	HashTable *ah0, *ah1, *ah2;
+	HashPosition hp0, hp1, hp2;
+	zval **hd;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &ids, &options) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!options) {
+		PHALCON_INIT_VAR(options);
+	}
+	
+	if (Z_TYPE_P(ids) != IS_ARRAY) { 
+		PHALCON_THROW_EXCEPTION_STR(phalcon_exception_ce, "Job ids must be an Array");
+		return;
+	}
+	
+	if (phalcon_array_isset_string(options, SS("batchSize"))) {
+		PHALCON_OBS_VAR(batch_size);
+		phalcon_array_fetch_string(&batch_size, options, SL("batchSize"), PH_NOISY_CC);
+		if (phalcon_get_intval(batch_size) <= 0) {
+			PHALCON_THROW_EXCEPTION_STR(phalcon_exception_ce, "The batch size must be greater than zero");
+			return;
+		}
+	} else {
+		PHALCON_INIT_NVAR(batch_size);
+		ZVAL_LONG(batch_size, 1000);
+	}
+	
+	PHALCON_INIT_VAR(chunks);
+	PHALCON_CALL_FUNC_PARAMS_2(chunks, "array_chunk", ids, batch_size);
+	
+	PHALCON_INIT_VAR(results);
+	array_init(results);
+	
+	if (!phalcon_is_iterable(chunks, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_VALUE(chunk);
+	
+		PHALCON_INIT_NVAR(commands);
+		array_init(commands);
+	
+		if (!phalcon_is_iterable(chunk, &ah1, &hp1, 0, 0 TSRMLS_CC)) {
+			return;
+		}
+	
+		while (zend_hash_get_current_data_ex(ah1, (void**) &hd, &hp1) == SUCCESS) {
+	
+			PHALCON_GET_FOREACH_VALUE(job_id);
+	
+			PHALCON_INIT_NVAR(command);
+			PHALCON_CONCAT_SV(command, "delete ", job_id);
+			phalcon_array_append(&commands, command, PH_SEPARATE TSRMLS_CC);
+	
+			zend_hash_move_forward_ex(ah1, &hp1);
+		}
+	
+		PHALCON_INIT_NVAR(buffer);
+		phalcon_fast_join_str(buffer, SL("\r\n"), commands TSRMLS_CC);
+		PHALCON_CALL_METHOD_PARAMS_1_NORETURN(this_ptr, "write", buffer);
+	
+		if (!phalcon_is_iterable(chunk, &ah2, &hp2, 0, 0 TSRMLS_CC)) {
+			return;
+		}
+	
+		while (zend_hash_get_current_data_ex(ah2, (void**) &hd, &hp2) == SUCCESS) {
+	
+			PHALCON_GET_FOREACH_VALUE(job_id);
+	
+			PHALCON_INIT_NVAR(response);
+			PHALCON_CALL_METHOD(response, this_ptr, "readstatus");
+	
+			PHALCON_OBS_NVAR(status);
+			phalcon_array_fetch_long(&status, response, 0, PH_NOISY_CC);
+			if (PHALCON_IS_STRING(status, "DELETED")) {
+				phalcon_array_update_zval_bool(&results, job_id, 1, PH_SEPARATE TSRMLS_CC);
+			} else {
+				phalcon_array_update_zval_bool(&results, job_id, 0, PH_SEPARATE TSRMLS_CC);
+			}
+	
+			zend_hash_move_forward_ex(ah2, &hp2);
+		}
+	
+		zend_hash_move_forward_ex(ah0, &hp0);
+	}
+	
+	RETURN_CTOR(results);
+}
+
 /**
  * Inspect the next ready job.
  *
@@ -385,7 +935,7 @@ PHP_METHOD(Phalcon_Queue_Beanstalk, watch){
 PHP_METHOD(Phalcon_Queue_Beanstalk, peekReady){
 
 	zval *command, *response, *status, *job_id, *length;
-	zval *serialized_body, *body, *job;
+	zval *serialized_body, *body, *job, *encoder;
 
 	PHALCON_MM_GROW();
 
@@ -408,8 +958,13 @@ PHP_METHOD(Phalcon_Queue_Beanstalk, peekReady){
 		PHALCON_INIT_VAR(serialized_body);
 		PHALCON_CALL_METHOD_PARAMS_1(serialized_body, this_ptr, "read", length);
 	
+		PHALCON_OBS_VAR(encoder);
+		phalcon_read_property(&encoder, this_ptr, SL("_encoder"), PH_NOISY_CC);
+	
 		PHALCON_INIT_VAR(body);
-		PHALCON_CALL_FUNC_PARAMS_1(body, "unserialize", serialized_body);
+		if (phalcon_queue_beanstalk_decode(body, encoder, serialized_body TSRMLS_CC) == FAILURE) {
+			return;
+		}
 	
 		PHALCON_INIT_VAR(job);
 		object_init_ex(job, phalcon_queue_beanstalk_job_ce);
@@ -486,8 +1041,11 @@ PHP_METHOD(Phalcon_Queue_Beanstalk, read){
 		PHALCON_INIT_VAR(total_length);
 		phalcon_add_function(total_length, length, eof_chars TSRMLS_CC);
 	
+		/** 
+		 * fread() returns a single packet from sockets, stream_get_contents() reads until the whole body is received
+		 */
 		PHALCON_INIT_VAR(data);
-		PHALCON_CALL_FUNC_PARAMS_2(data, "fread", connection, total_length);
+		PHALCON_CALL_FUNC_PARAMS_2(data, "stream_get_contents", connection, total_length);
 	
 		PHALCON_INIT_VAR(meta);
 		PHALCON_CALL_FUNC_PARAMS_1(meta, "stream_get_meta_data", connection);
@@ -23,10 +23,16 @@ PHALCON_INIT_CLASS(Phalcon_Queue_Beanstalk);
 
 PHP_METHOD(Phalcon_Queue_Beanstalk, __construct);
 PHP_METHOD(Phalcon_Queue_Beanstalk, connect);
+PHP_METHOD(Phalcon_Queue_Beanstalk, setEncoder);
+PHP_METHOD(Phalcon_Queue_Beanstalk, getEncoder);
 PHP_METHOD(Phalcon_Queue_Beanstalk, put);
+PHP_METHOD(Phalcon_Queue_Beanstalk, putMany);
 PHP_METHOD(Phalcon_Queue_Beanstalk, reserve);
+PHP_METHOD(Phalcon_Queue_Beanstalk, readJob);
+PHP_METHOD(Phalcon_Queue_Beanstalk, work);
 PHP_METHOD(Phalcon_Queue_Beanstalk, choose);
 PHP_METHOD(Phalcon_Queue_Beanstalk, watch);
+PHP_METHOD(Phalcon_Queue_Beanstalk, deleteMany);
 PHP_METHOD(Phalcon_Queue_Beanstalk, peekReady);
 PHP_METHOD(Phalcon_Queue_Beanstalk, readStatus);
 PHP_METHOD(Phalcon_Queue_Beanstalk, read);
@@ -37,15 +43,29 @@ ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_queue_beanstalk___construct, 0, 0, 0)
 	ZEND_ARG_INFO(0, options)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_queue_beanstalk_setencoder, 0, 0, 1)
+	ZEND_ARG_INFO(0, encoder)
+ZEND_END_ARG_INFO()
+
 ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_queue_beanstalk_put, 0, 0, 1)
 	ZEND_ARG_INFO(0, data)
 	ZEND_ARG_INFO(0, options)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_queue_beanstalk_putmany, 0, 0, 1)
+	ZEND_ARG_INFO(0, jobs)
+	ZEND_ARG_INFO(0, options)
+ZEND_END_ARG_INFO()
+
 ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_queue_beanstalk_reserve, 0, 0, 0)
 	ZEND_ARG_INFO(0, timeout)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_queue_beanstalk_work, 0, 0, 1)
+	ZEND_ARG_INFO(0, handler)
+	ZEND_ARG_INFO(0, options)
+ZEND_END_ARG_INFO()
+
 ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_queue_beanstalk_choose, 0, 0, 1)
 	ZEND_ARG_INFO(0, tube)
 ZEND_END_ARG_INFO()
@@ -54,6 +74,11 @@ ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_queue_beanstalk_watch, 0, 0, 1)
 	ZEND_ARG_INFO(0, tube)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_queue_beanstalk_deletemany, 0, 0, 1)
+	ZEND_ARG_INFO(0, ids)
+	ZEND_ARG_INFO(0, options)
+ZEND_END_ARG_INFO()
+
 ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_queue_beanstalk_read, 0, 0, 0)
 	ZEND_ARG_INFO(0, length)
 ZEND_END_ARG_INFO()
@@ -61,10 +86,16 @@ ZEND_END_ARG_INFO()
 PHALCON_INIT_FUNCS(phalcon_queue_beanstalk_method_entry){
 	PHP_ME(Phalcon_Queue_Beanstalk, __construct, arginfo_phalcon_queue_beanstalk___construct, ZEND_ACC_PUBLIC|ZEND_ACC_CTOR) 
 	PHP_ME(Phalcon_Queue_Beanstalk, connect, NULL, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Queue_Beanstalk, setEncoder, arginfo_phalcon_queue_beanstalk_setencoder, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Queue_Beanstalk, getEncoder, NULL, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Queue_Beanstalk, put, arginfo_phalcon_queue_beanstalk_put, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Queue_Beanstalk, putMany, arginfo_phalcon_queue_beanstalk_putmany, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Queue_Beanstalk, reserve, arginfo_phalcon_queue_beanstalk_reserve, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Queue_Beanstalk, readJob, NULL, ZEND_ACC_PROTECTED) 
+	PHP_ME(Phalcon_Queue_Beanstalk, work, arginfo_phalcon_queue_beanstalk_work, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Queue_Beanstalk, choose, arginfo_phalcon_queue_beanstalk_choose, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Queue_Beanstalk, watch, arginfo_phalcon_queue_beanstalk_watch, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Queue_Beanstalk, deleteMany, arginfo_phalcon_queue_beanstalk_deletemany, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Queue_Beanstalk, peekReady, NULL, ZEND_ACC_PUBLIC) 
 	PHP_ME(Phalcon_Queue_Beanstalk, readStatus, NULL, ZEND_ACC_PROTECTED) 
 	PHP_ME(Phalcon_Queue_Beanstalk, read, arginfo_phalcon_queue_beanstalk_read, ZEND_ACC_PUBLIC) 
@@ -69,6 +69,28 @@ PHP_METHOD(Phalcon_Queue_Beanstalk_Job, __construct){
 	
 }
 
+/**
+ * Returns the job id
+ *
+ * @return string
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk_Job, getId){
+
+
+	RETURN_MEMBER(this_ptr, "_id");
+}
+
+/**
+ * Returns the job body decoded by the queue encoder
+ *
+ * @return mixed
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk_Job, getBody){
+
+
+	RETURN_MEMBER(this_ptr, "_body");
+}
+
 /**
  * Removes a job from the server entirely
  *
@@ -103,3 +125,86 @@ PHP_METHOD(Phalcon_Queue_Beanstalk_Job, delete){
 	RETURN_MM_FALSE;
 }
 
+/**
+ * Asks the server for more time to work on the job, the time-to-run of the job is restarted
+ *
+ * @return boolean
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk_Job, touch){
+
+	zval *id, *command, *queue, *response, *status;
+
+	PHALCON_MM_GROW();
+
+	PHALCON_OBS_VAR(id);
+	phalcon_read_property(&id, this_ptr, SL("_id"), PH_NOISY_CC);
+	
+	PHALCON_INIT_VAR(command);
+	PHALCON_CONCAT_SV(command, "touch ", id);
+	
+	PHALCON_OBS_VAR(queue);
+	phalcon_read_property(&queue, this_ptr, SL("_queue"), PH_NOISY_CC);
+	PHALCON_CALL_METHOD_PARAMS_1_NORETURN(queue, "write", command);
+	
+	PHALCON_INIT_VAR(response);
+	PHALCON_CALL_METHOD(response, queue, "readstatus");
+	
+	PHALCON_OBS_VAR(status);
+	phalcon_array_fetch_long(&status, response, 0, PH_NOISY_CC);
+	if (PHALCON_IS_STRING(status, "TOUCHED")) {
+		RETURN_MM_TRUE;
+	}
+	
+	RETURN_MM_FALSE;
+}
+
+/**
+ * Puts a reserved job back into the ready queue
+ *
+ * @param int $priority
+ * @param int $delay
+ * @return boolean
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk_Job, release){
+
+	zval *priority = NULL, *delay = NULL, *id, *command, *queue, *response;
+	zval *status;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "|zz", &priority, &delay) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!priority) {
+		PHALCON_INIT_VAR(priority);
+		ZVAL_LONG(priority, 100);
+	}
+	
+	if (!delay) {
+		PHALCON_INIT_VAR(delay);
+		ZVAL_LONG(delay, 0);
+	}
+	
+	PHALCON_OBS_VAR(id);
+	phalcon_read_property(&id, this_ptr, SL("_id"), PH_NOISY_CC);
+	
+	PHALCON_INIT_VAR(command);
+	PHALCON_CONCAT_SVSVSV(command, "release ", id, " ", priority, " ", delay);
+	
+	PHALCON_OBS_VAR(queue);
+	phalcon_read_property(&queue, this_ptr, SL("_queue"), PH_NOISY_CC);
+	PHALCON_CALL_METHOD_PARAMS_1_NORETURN(queue, "write", command);
+	
+	PHALCON_INIT_VAR(response);
+	PHALCON_CALL_METHOD(response, queue, "readstatus");
+	
+	PHALCON_OBS_VAR(status);
+	phalcon_array_fetch_long(&status, response, 0, PH_NOISY_CC);
+	if (PHALCON_IS_STRING(status, "RELEASED")) {
+		RETURN_MM_TRUE;
+	}
+	
+	RETURN_MM_FALSE;
+}
+
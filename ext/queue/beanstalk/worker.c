@@ -0,0 +1,766 @@
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2013 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+#include "php_phalcon.h"
+#include "phalcon.h"
+
+#include "Zend/zend_operators.h"
+#include "Zend/zend_exceptions.h"
+#include "Zend/zend_interfaces.h"
+
+#include "kernel/main.h"
+#include "kernel/memory.h"
+
+
+#include "kernel/object.h"
+#include "kernel/array.h"
+#include "kernel/fcall.h"
+#include "kernel/exception.h"
+#include "kernel/string.h"
+#include "kernel/concat.h"
+#include "kernel/operators.h"
+
+/**
+ * Phalcon\Queue\Beanstalk\Worker
+ *
+ * Consumes jobs from several Beanstalk connections in a single process. The connections are
+ * multiplexed with stream_select, up to 'prefetch' reserved jobs are kept in memory and the
+ * jobs waiting to be processed are touched every 'touchInterval' seconds so they aren't
+ * released by the server while other jobs are processed
+ *
+ *<code>
+ * $emails = new Phalcon\Queue\Beanstalk(array('host' => '192.168.0.21'));
+ * $emails->watch('emails');
+ *
+ * $reports = new Phalcon\Queue\Beanstalk(array('host' => '192.168.0.21'));
+ * $reports->watch('reports');
+ *
+ * $worker = new Phalcon\Queue\Beanstalk\Worker(array($emails, $reports), array('prefetch' => 20));
+ * $worker->run(function($job) use ($worker) {
+ *     process($job->getBody(), $worker);
+ *     $job->delete();
+ * });
+ *</code>
+ */
+
+
+/**
+ * Phalcon\Queue\Beanstalk\Worker initializer
+ */
+PHALCON_INIT_CLASS(Phalcon_Queue_Beanstalk_Worker){
+
+	PHALCON_REGISTER_CLASS(Phalcon\\Queue\\Beanstalk, Worker, queue_beanstalk_worker, phalcon_queue_beanstalk_worker_method_entry, 0);
+
+	zend_declare_property_null(phalcon_queue_beanstalk_worker_ce, SL("_queues"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_long(phalcon_queue_beanstalk_worker_ce, SL("_prefetch"), 10, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_long(phalcon_queue_beanstalk_worker_ce, SL("_timeout"), 1, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_long(phalcon_queue_beanstalk_worker_ce, SL("_touchInterval"), 30, ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_queue_beanstalk_worker_ce, SL("_pending"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_queue_beanstalk_worker_ce, SL("_jobs"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_queue_beanstalk_worker_ce, SL("_queueOf"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_null(phalcon_queue_beanstalk_worker_ce, SL("_touchedAt"), ZEND_ACC_PROTECTED TSRMLS_CC);
+	zend_declare_property_long(phalcon_queue_beanstalk_worker_ce, SL("_sequence"), 0, ZEND_ACC_PROTECTED TSRMLS_CC);
+
+	return SUCCESS;
+}
+
+/**
+ * Phalcon\Queue\Beanstalk\Worker constructor
+ *
+ * @param Phalcon\Queue\Beanstalk[] $queues
+ * @param array $options
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk_Worker, __construct){
+
+	zval *queues, *options = NULL, *queue = NULL, *prefetch, *timeout;
+	zval *touch_interval;
+	HashTable *ah0;
+	HashPosition hp0;
+	zval **hd;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &queues, &options) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!options) {
+		PHALCON_INIT_VAR(options);
+	}
+	
+	if (Z_TYPE_P(queues) != IS_ARRAY) { 
+		PHALCON_THROW_EXCEPTION_STR(phalcon_exception_ce, "Queues must be an Array");
+		return;
+	}
+	
+	if (!phalcon_is_iterable(queues, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_VALUE(queue);
+	
+		if (Z_TYPE_P(queue) != IS_OBJECT || !instanceof_function(Z_OBJCE_P(queue), phalcon_queue_beanstalk_ce TSRMLS_CC)) {
+			PHALCON_THROW_EXCEPTION_STR(phalcon_exception_ce, "Queues must be instances of Phalcon\\Queue\\Beanstalk");
+			return;
+		}
+	
+		zend_hash_move_forward_ex(ah0, &hp0);
+	}
+	
+	phalcon_update_property_zval(this_ptr, SL("_queues"), queues TSRMLS_CC);
+	
+	if (Z_TYPE_P(options) == IS_ARRAY) { 
+	
+		/** 
+		 * Maximum number of reserved jobs kept in memory
+		 */
+		if (phalcon_array_isset_string(options, SS("prefetch"))) {
+			PHALCON_OBS_VAR(prefetch);
+			phalcon_array_fetch_string(&prefetch, options, SL("prefetch"), PH_NOISY_CC);
+			if (phalcon_get_intval(prefetch) <= 0) {
+				PHALCON_THROW_EXCEPTION_STR(phalcon_exception_ce, "The prefetch must be greater than zero");
+				return;
+			}
+			phalcon_update_property_zval(this_ptr, SL("_prefetch"), prefetch TSRMLS_CC);
+		}
+	
+		/** 
+		 * Seconds to wait for jobs in every reserve
+		 */
+		if (phalcon_array_isset_string(options, SS("timeout"))) {
+			PHALCON_OBS_VAR(timeout);
+			phalcon_array_fetch_string(&timeout, options, SL("timeout"), PH_NOISY_CC);
+			phalcon_update_property_zval(this_ptr, SL("_timeout"), timeout TSRMLS_CC);
+		}
+	
+		/** 
+		 * Seconds after a reserved job is touched, zero disables the touches
+		 */
+		if (phalcon_array_isset_string(options, SS("touchInterval"))) {
+			PHALCON_OBS_VAR(touch_interval);
+			phalcon_array_fetch_string(&touch_interval, options, SL("touchInterval"), PH_NOISY_CC);
+			phalcon_update_property_zval(this_ptr, SL("_touchInterval"), touch_interval TSRMLS_CC);
+		}
+	}
+	
+	phalcon_update_property_empty_array(phalcon_queue_beanstalk_worker_ce, this_ptr, SL("_pending") TSRMLS_CC);
+	phalcon_update_property_empty_array(phalcon_queue_beanstalk_worker_ce, this_ptr, SL("_jobs") TSRMLS_CC);
+	phalcon_update_property_empty_array(phalcon_queue_beanstalk_worker_ce, this_ptr, SL("_queueOf") TSRMLS_CC);
+	phalcon_update_property_empty_array(phalcon_queue_beanstalk_worker_ce, this_ptr, SL("_touchedAt") TSRMLS_CC);
+	
+	PHALCON_MM_RESTORE();
+}
+
+/**
+ * Processes jobs until the handler returns false, after 'maxJobs' jobs, after 'idleTimeouts'
+ * consecutive waits without jobs or when all the connections are lost. The jobs still
+ * prefetched are released before returning, also when the handler throws an exception. Returns
+ * the number of jobs passed to the handler
+ *
+ * @param callable $handler
+ * @param array $options
+ * @return int
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk_Worker, run){
+
+	zval *handler, *options = NULL, *max_jobs, *idle_timeouts, *wait, *no_wait;
+	zval *jobs = NULL, *queues = NULL, *found = NULL, *sequence = NULL, *job = NULL;
+	zval *params = NULL, *status = NULL, *exception;
+	HashTable *ah0;
+	HashPosition hp0;
+	zval **hd;
+	long processed = 0, idle = 0, max = 0, max_idle = 0, current;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z|z", &handler, &options) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	if (!options) {
+		PHALCON_INIT_VAR(options);
+	}
+	
+	if (!phalcon_is_callable(handler TSRMLS_CC)) {
+		PHALCON_THROW_EXCEPTION_STR(phalcon_exception_ce, "The worker handler is not callable");
+		return;
+	}
+	
+	if (phalcon_array_isset_string(options, SS("maxJobs"))) {
+		PHALCON_OBS_VAR(max_jobs);
+		phalcon_array_fetch_string(&max_jobs, options, SL("maxJobs"), PH_NOISY_CC);
+		max = phalcon_get_intval(max_jobs);
+	}
+	
+	if (phalcon_array_isset_string(options, SS("idleTimeouts"))) {
+		PHALCON_OBS_VAR(idle_timeouts);
+		phalcon_array_fetch_string(&idle_timeouts, options, SL("idleTimeouts"), PH_NOISY_CC);
+		max_idle = phalcon_get_intval(idle_timeouts);
+	}
+	
+	PHALCON_INIT_VAR(wait);
+	ZVAL_BOOL(wait, 1);
+	
+	PHALCON_INIT_VAR(no_wait);
+	ZVAL_BOOL(no_wait, 0);
+	
+	while (1) {
+	
+		PHALCON_OBS_NVAR(jobs);
+		phalcon_read_property(&jobs, this_ptr, SL("_jobs"), PH_NOISY_CC);
+		if (!phalcon_fast_count_ev(jobs TSRMLS_CC)) {
+	
+			PHALCON_OBS_NVAR(queues);
+			phalcon_read_property(&queues, this_ptr, SL("_queues"), PH_NOISY_CC);
+			if (!phalcon_fast_count_ev(queues TSRMLS_CC)) {
+				break;
+			}
+	
+			/** 
+			 * There are no jobs in memory, wait for any of the connections
+			 */
+			PHALCON_INIT_NVAR(found);
+			PHALCON_CALL_METHOD_PARAMS_1(found, this_ptr, "_poll", wait);
+			if (!zend_is_true(found)) {
+				idle++;
+				if (max_idle > 0 && idle >= max_idle) {
+					break;
+				}
+				continue;
+			}
+	
+			PHALCON_OBS_NVAR(jobs);
+			phalcon_read_property(&jobs, this_ptr, SL("_jobs"), PH_NOISY_CC);
+		} else {
+			/** 
+			 * Jobs that arrived in the other connections are collected without waiting
+			 */
+			PHALCON_CALL_METHOD_PARAMS_1_NORETURN(this_ptr, "_poll", no_wait);
+		}
+	
+		idle = 0;
+	
+		if (!phalcon_is_iterable(jobs, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+			return;
+		}
+	
+		if (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) != SUCCESS) {
+			continue;
+		}
+	
+		/** 
+		 * Jobs are processed in the order they were reserved, the job stays tracked while
+		 * the handler runs so touch() keeps it alive
+		 */
+		PHALCON_GET_FOREACH_KEY(sequence, ah0, hp0);
+		PHALCON_GET_FOREACH_VALUE(job);
+	
+		processed++;
+	
+		PHALCON_INIT_NVAR(params);
+		array_init_size(params, 1);
+		phalcon_array_append(&params, job, PH_SEPARATE TSRMLS_CC);
+	
+		current = phalcon_get_intval(sequence);
+	
+		PHALCON_INIT_NVAR(status);
+		if (phalcon_call_user_func_array(status, handler, params TSRMLS_CC) == FAILURE) {
+	
+			/** 
+			 * The handler threw, the memory frame is already restored. The prefetched jobs are
+			 * released so they don't stay reserved until their TTR, then the exception is rethrown
+			 */
+			if (EG(exception)) {
+				exception = EG(exception);
+				EG(exception) = NULL;
+	
+				PHALCON_MM_GROW();
+	
+				PHALCON_INIT_NVAR(sequence);
+				ZVAL_LONG(sequence, current);
+				phalcon_unset_property_array(this_ptr, SL("_jobs"), sequence TSRMLS_CC);
+				phalcon_unset_property_array(this_ptr, SL("_queueOf"), sequence TSRMLS_CC);
+				phalcon_unset_property_array(this_ptr, SL("_touchedAt"), sequence TSRMLS_CC);
+	
+				if (phalcon_call_method(NULL, this_ptr, SL("_release"), 0 PH_MEHASH_C TSRMLS_CC) == SUCCESS) {
+					PHALCON_MM_RESTORE();
+				}
+	
+				if (EG(exception)) {
+					zend_clear_exception(TSRMLS_C);
+				}
+				EG(exception) = exception;
+			}
+			return;
+		}
+	
+		phalcon_unset_property_array(this_ptr, SL("_jobs"), sequence TSRMLS_CC);
+		phalcon_unset_property_array(this_ptr, SL("_queueOf"), sequence TSRMLS_CC);
+		phalcon_unset_property_array(this_ptr, SL("_touchedAt"), sequence TSRMLS_CC);
+	
+		if (PHALCON_IS_FALSE(status)) {
+			break;
+		}
+	
+		if (max > 0 && processed >= max) {
+			break;
+		}
+	
+		PHALCON_CALL_METHOD_NORETURN(this_ptr, "touch");
+	}
+	
+	PHALCON_CALL_METHOD_NORETURN(this_ptr, "_release");
+	
+	PHALCON_MM_RESTORE();
+	RETURN_LONG(processed);
+}
+
+/**
+ * Touches the reserved jobs kept in memory, including the job being processed, that weren't
+ * touched in the last 'touchInterval' seconds. Long running handlers can call it periodically.
+ * Returns the number of jobs touched
+ *
+ * @return int
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk_Worker, touch){
+
+	zval *touch_interval, *jobs, *queue_of, *touched_at, *pending;
+	zval *now, *sequence = NULL, *job = NULL, *touched = NULL, *index = NULL;
+	HashTable *ah0;
+	HashPosition hp0;
+	zval **hd;
+	long interval, count = 0;
+
+	PHALCON_MM_GROW();
+
+	PHALCON_OBS_VAR(touch_interval);
+	phalcon_read_property(&touch_interval, this_ptr, SL("_touchInterval"), PH_NOISY_CC);
+	
+	interval = phalcon_get_intval(touch_interval);
+	if (interval <= 0) {
+		PHALCON_MM_RESTORE();
+		RETURN_LONG(0);
+	}
+	
+	PHALCON_INIT_VAR(now);
+	ZVAL_LONG(now, (long) time(NULL));
+	
+	PHALCON_OBS_VAR(jobs);
+	phalcon_read_property(&jobs, this_ptr, SL("_jobs"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(queue_of);
+	phalcon_read_property(&queue_of, this_ptr, SL("_queueOf"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(touched_at);
+	phalcon_read_property(&touched_at, this_ptr, SL("_touchedAt"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(pending);
+	phalcon_read_property(&pending, this_ptr, SL("_pending"), PH_NOISY_CC);
+	
+	if (!phalcon_is_iterable(jobs, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_KEY(sequence, ah0, hp0);
+		PHALCON_GET_FOREACH_VALUE(job);
+	
+		PHALCON_OBS_NVAR(touched);
+		phalcon_array_fetch(&touched, touched_at, sequence, PH_NOISY_CC);
+	
+		PHALCON_OBS_NVAR(index);
+		phalcon_array_fetch(&index, queue_of, sequence, PH_NOISY_CC);
+	
+		/** 
+		 * A connection waiting for a reserve can't be used until the server answers it
+		 */
+		if (Z_LVAL_P(now) - phalcon_get_intval(touched) >= interval && !phalcon_array_isset(pending, index)) {
+			PHALCON_CALL_METHOD_NORETURN(job, "touch");
+			phalcon_update_property_array(this_ptr, SL("_touchedAt"), sequence, now TSRMLS_CC);
+			count++;
+		}
+	
+		zend_hash_move_forward_ex(ah0, &hp0);
+	}
+	
+	PHALCON_MM_RESTORE();
+	RETURN_LONG(count);
+}
+
+/**
+ * Sends a reserve to the idle connections and reads the responses of the connections that
+ * are ready, waiting for them only if requested. Returns the number of jobs added to memory
+ *
+ * @param boolean $wait
+ * @return int
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk_Worker, _poll){
+
+	zval *wait, *queues, *timeout, *pending = NULL, *prefetch, *jobs, *total;
+	zval *queue_of, *busy, *command, *index = NULL, *queue = NULL, *yes;
+	zval *pending_index = NULL, *flag = NULL, *connection = NULL;
+	zval *read, *write, *except, *seconds, *microseconds, *one, *r0 = NULL;
+	zval *ready_index = NULL, *ready = NULL, *job = NULL, *prefetched = NULL;
+	zval *is_eof = NULL;
+	zval *p0[] = { NULL, NULL, NULL, NULL, NULL };
+	HashTable *ah0, *ah1, *ah2;
+	HashPosition hp0, hp1, hp2;
+	zval **hd;
+	long count = 0;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &wait) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	PHALCON_OBS_VAR(queues);
+	phalcon_read_property(&queues, this_ptr, SL("_queues"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(timeout);
+	phalcon_read_property(&timeout, this_ptr, SL("_timeout"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(pending);
+	phalcon_read_property(&pending, this_ptr, SL("_pending"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(prefetch);
+	phalcon_read_property(&prefetch, this_ptr, SL("_prefetch"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(jobs);
+	phalcon_read_property(&jobs, this_ptr, SL("_jobs"), PH_NOISY_CC);
+	
+	PHALCON_INIT_VAR(total);
+	phalcon_fast_count(total, jobs TSRMLS_CC);
+	
+	/** 
+	 * Connections with jobs in memory don't receive reserves, the handlers use them to delete,
+	 * release or touch those jobs and the responses would be mixed
+	 */
+	PHALCON_OBS_VAR(queue_of);
+	phalcon_read_property(&queue_of, this_ptr, SL("_queueOf"), PH_NOISY_CC);
+	
+	PHALCON_INIT_VAR(busy);
+	PHALCON_CALL_FUNC_PARAMS_1(busy, "array_flip", queue_of);
+	
+	if (phalcon_get_intval(total) < phalcon_get_intval(prefetch)) {
+	
+		PHALCON_INIT_VAR(command);
+		PHALCON_CONCAT_SV(command, "reserve-with-timeout ", timeout);
+	
+		PHALCON_INIT_VAR(yes);
+		ZVAL_BOOL(yes, 1);
+	
+		if (!phalcon_is_iterable(queues, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+			return;
+		}
+	
+		while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+			PHALCON_GET_FOREACH_KEY(index, ah0, hp0);
+			PHALCON_GET_FOREACH_VALUE(queue);
+	
+			if (!phalcon_array_isset(pending, index) && !phalcon_array_isset(busy, index)) {
+				PHALCON_CALL_METHOD_PARAMS_1_NORETURN(queue, "write", command);
+				phalcon_update_property_array(this_ptr, SL("_pending"), index, yes TSRMLS_CC);
+			}
+	
+			zend_hash_move_forward_ex(ah0, &hp0);
+		}
+	}
+	
+	PHALCON_OBS_NVAR(pending);
+	phalcon_read_property(&pending, this_ptr, SL("_pending"), PH_NOISY_CC);
+	if (!phalcon_fast_count_ev(pending TSRMLS_CC)) {
+		PHALCON_MM_RESTORE();
+		RETURN_LONG(0);
+	}
+	
+	PHALCON_INIT_VAR(read);
+	array_init(read);
+	
+	if (!phalcon_is_iterable(pending, &ah1, &hp1, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah1, (void**) &hd, &hp1) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_KEY(pending_index, ah1, hp1);
+		PHALCON_GET_FOREACH_VALUE(flag);
+	
+		PHALCON_OBS_NVAR(queue);
+		phalcon_array_fetch(&queue, queues, pending_index, PH_NOISY_CC);
+	
+		PHALCON_OBS_NVAR(connection);
+		phalcon_read_property(&connection, queue, SL("_connection"), PH_NOISY_CC);
+		phalcon_array_update_zval(&read, pending_index, &connection, PH_COPY | PH_SEPARATE TSRMLS_CC);
+	
+		zend_hash_move_forward_ex(ah1, &hp1);
+	}
+	
+	/** 
+	 * Waits one second more than the reserves so the responses of timed out reserves are received
+	 */
+	PHALCON_INIT_VAR(seconds);
+	if (zend_is_true(wait)) {
+		PHALCON_INIT_VAR(one);
+		ZVAL_LONG(one, 1);
+		phalcon_add_function(seconds, timeout, one TSRMLS_CC);
+	} else {
+		ZVAL_LONG(seconds, 0);
+	}
+	
+	PHALCON_INIT_VAR(microseconds);
+	ZVAL_LONG(microseconds, 0);
+	
+	PHALCON_INIT_VAR(write);
+	
+	PHALCON_INIT_VAR(except);
+	Z_SET_ISREF_P(read);
+	p0[0] = read;
+	Z_SET_ISREF_P(write);
+	p0[1] = write;
+	Z_SET_ISREF_P(except);
+	p0[2] = except;
+	p0[3] = seconds;
+	p0[4] = microseconds;
+	
+	PHALCON_INIT_VAR(r0);
+	PHALCON_CALL_FUNC_PARAMS(r0, "stream_select", 5, p0);
+	Z_UNSET_ISREF_P(p0[0]);
+	Z_UNSET_ISREF_P(p0[1]);
+	Z_UNSET_ISREF_P(p0[2]);
+	if (!zend_is_true(r0)) {
+		PHALCON_MM_RESTORE();
+		RETURN_LONG(0);
+	}
+	
+	if (!phalcon_is_iterable(read, &ah2, &hp2, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah2, (void**) &hd, &hp2) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_KEY(ready_index, ah2, hp2);
+		PHALCON_GET_FOREACH_VALUE(ready);
+	
+		phalcon_unset_property_array(this_ptr, SL("_pending"), ready_index TSRMLS_CC);
+	
+		PHALCON_OBS_NVAR(queue);
+		phalcon_array_fetch(&queue, queues, ready_index, PH_NOISY_CC);
+	
+		PHALCON_INIT_NVAR(job);
+		PHALCON_CALL_METHOD(job, queue, "readjob");
+		if (Z_TYPE_P(job) == IS_OBJECT) {
+			PHALCON_CALL_METHOD_PARAMS_2_NORETURN(this_ptr, "_addjob", job, ready_index);
+			count++;
+	
+			/** 
+			 * The connection is free again, it's used to fill the prefetch without waiting
+			 */
+			PHALCON_INIT_NVAR(prefetched);
+			PHALCON_CALL_METHOD_PARAMS_1(prefetched, this_ptr, "_prefetch", ready_index);
+			count += phalcon_get_intval(prefetched);
+		} else {
+			/** 
+			 * Connections closed by the server aren't used anymore
+			 */
+			PHALCON_INIT_NVAR(is_eof);
+			PHALCON_CALL_FUNC_PARAMS_1(is_eof, "feof", ready);
+			if (zend_is_true(is_eof)) {
+				phalcon_unset_property_array(this_ptr, SL("_queues"), ready_index TSRMLS_CC);
+			}
+		}
+	
+		zend_hash_move_forward_ex(ah2, &hp2);
+	}
+	
+	PHALCON_MM_RESTORE();
+	RETURN_LONG(count);
+}
+
+/**
+ * Reserves jobs without waiting in a connection until the prefetch is full, all the
+ * reserves are sent in one write. Returns the number of jobs added to memory
+ *
+ * @param int $index
+ * @return int
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk_Worker, _prefetch){
+
+	zval *index, *prefetch, *jobs, *total, *queues, *queue, *commands;
+	zval *buffer, *job = NULL;
+	long capacity, i, count = 0;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "z", &index) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	PHALCON_OBS_VAR(prefetch);
+	phalcon_read_property(&prefetch, this_ptr, SL("_prefetch"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(jobs);
+	phalcon_read_property(&jobs, this_ptr, SL("_jobs"), PH_NOISY_CC);
+	
+	PHALCON_INIT_VAR(total);
+	phalcon_fast_count(total, jobs TSRMLS_CC);
+	
+	capacity = phalcon_get_intval(prefetch) - phalcon_get_intval(total);
+	if (capacity <= 0) {
+		PHALCON_MM_RESTORE();
+		RETURN_LONG(0);
+	}
+	
+	PHALCON_OBS_VAR(queues);
+	phalcon_read_property(&queues, this_ptr, SL("_queues"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(queue);
+	phalcon_array_fetch(&queue, queues, index, PH_NOISY_CC);
+	
+	PHALCON_INIT_VAR(commands);
+	array_init_size(commands, capacity);
+	for (i = 0; i < capacity; i++) {
+		add_next_index_stringl(commands, SL("reserve-with-timeout 0"), 1);
+	}
+	
+	PHALCON_INIT_VAR(buffer);
+	phalcon_fast_join_str(buffer, SL("\r\n"), commands TSRMLS_CC);
+	PHALCON_CALL_METHOD_PARAMS_1_NORETURN(queue, "write", buffer);
+	
+	for (i = 0; i < capacity; i++) {
+		PHALCON_INIT_NVAR(job);
+		PHALCON_CALL_METHOD(job, queue, "readjob");
+		if (Z_TYPE_P(job) == IS_OBJECT) {
+			PHALCON_CALL_METHOD_PARAMS_2_NORETURN(this_ptr, "_addjob", job, index);
+			count++;
+		}
+	}
+	
+	PHALCON_MM_RESTORE();
+	RETURN_LONG(count);
+}
+
+/**
+ * Keeps a reserved job in memory
+ *
+ * @param Phalcon\Queue\Beanstalk\Job $job
+ * @param int $index
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk_Worker, _addJob){
+
+	zval *job, *index, *sequence, *now;
+
+	PHALCON_MM_GROW();
+
+	if (zend_parse_parameters(ZEND_NUM_ARGS() TSRMLS_CC, "zz", &job, &index) == FAILURE) {
+		RETURN_MM_NULL();
+	}
+
+	phalcon_property_incr(this_ptr, SL("_sequence") TSRMLS_CC);
+	
+	PHALCON_OBS_VAR(sequence);
+	phalcon_read_property(&sequence, this_ptr, SL("_sequence"), PH_NOISY_CC);
+	
+	PHALCON_INIT_VAR(now);
+	ZVAL_LONG(now, (long) time(NULL));
+	
+	phalcon_update_property_array(this_ptr, SL("_jobs"), sequence, job TSRMLS_CC);
+	phalcon_update_property_array(this_ptr, SL("_queueOf"), sequence, index TSRMLS_CC);
+	phalcon_update_property_array(this_ptr, SL("_touchedAt"), sequence, now TSRMLS_CC);
+	
+	PHALCON_MM_RESTORE();
+}
+
+/**
+ * Waits the responses of the reserves sent and releases all the jobs kept in memory
+ */
+PHP_METHOD(Phalcon_Queue_Beanstalk_Worker, _release){
+
+	zval *queues, *pending, *index = NULL, *flag = NULL, *queue = NULL, *job = NULL;
+	zval *jobs;
+	HashTable *ah0, *ah1;
+	HashPosition hp0, hp1;
+	zval **hd;
+
+	PHALCON_MM_GROW();
+
+	PHALCON_OBS_VAR(queues);
+	phalcon_read_property(&queues, this_ptr, SL("_queues"), PH_NOISY_CC);
+	
+	PHALCON_OBS_VAR(pending);
+	phalcon_read_property(&pending, this_ptr, SL("_pending"), PH_NOISY_CC);
+	
+	if (!phalcon_is_iterable(pending, &ah0, &hp0, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah0, (void**) &hd, &hp0) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_KEY(index, ah0, hp0);
+		PHALCON_GET_FOREACH_VALUE(flag);
+	
+		if (phalcon_array_isset(queues, index)) {
+	
+			PHALCON_OBS_NVAR(queue);
+			phalcon_array_fetch(&queue, queues, index, PH_NOISY_CC);
+	
+			PHALCON_INIT_NVAR(job);
+			PHALCON_CALL_METHOD(job, queue, "readjob");
+			if (Z_TYPE_P(job) == IS_OBJECT) {
+				PHALCON_CALL_METHOD_NORETURN(job, "release");
+			}
+		}
+	
+		zend_hash_move_forward_ex(ah0, &hp0);
+	}
+	
+	phalcon_update_property_empty_array(phalcon_queue_beanstalk_worker_ce, this_ptr, SL("_pending") TSRMLS_CC);
+	
+	PHALCON_OBS_VAR(jobs);
+	phalcon_read_property(&jobs, this_ptr, SL("_jobs"), PH_NOISY_CC);
+	
+	if (!phalcon_is_iterable(jobs, &ah1, &hp1, 0, 0 TSRMLS_CC)) {
+		return;
+	}
+	
+	while (zend_hash_get_current_data_ex(ah1, (void**) &hd, &hp1) == SUCCESS) {
+	
+		PHALCON_GET_FOREACH_VALUE(job);
+	
+		PHALCON_CALL_METHOD_NORETURN(job, "release");
+	
+		zend_hash_move_forward_ex(ah1, &hp1);
+	}
+	
+	phalcon_update_property_empty_array(phalcon_queue_beanstalk_worker_ce, this_ptr, SL("_jobs") TSRMLS_CC);
+	phalcon_update_property_empty_array(phalcon_queue_beanstalk_worker_ce, this_ptr, SL("_queueOf") TSRMLS_CC);
+	phalcon_update_property_empty_array(phalcon_queue_beanstalk_worker_ce, this_ptr, SL("_touchedAt") TSRMLS_CC);
+	
+	PHALCON_MM_RESTORE();
+}
+
@@ -0,0 +1,65 @@
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2013 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+extern zend_class_entry *phalcon_queue_beanstalk_worker_ce;
+
+PHALCON_INIT_CLASS(Phalcon_Queue_Beanstalk_Worker);
+
+PHP_METHOD(Phalcon_Queue_Beanstalk_Worker, __construct);
+PHP_METHOD(Phalcon_Queue_Beanstalk_Worker, run);
+PHP_METHOD(Phalcon_Queue_Beanstalk_Worker, touch);
+PHP_METHOD(Phalcon_Queue_Beanstalk_Worker, _poll);
+PHP_METHOD(Phalcon_Queue_Beanstalk_Worker, _prefetch);
+PHP_METHOD(Phalcon_Queue_Beanstalk_Worker, _addJob);
+PHP_METHOD(Phalcon_Queue_Beanstalk_Worker, _release);
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_queue_beanstalk_worker___construct, 0, 0, 1)
+	ZEND_ARG_INFO(0, queues)
+	ZEND_ARG_INFO(0, options)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_queue_beanstalk_worker_run, 0, 0, 1)
+	ZEND_ARG_INFO(0, handler)
+	ZEND_ARG_INFO(0, options)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_queue_beanstalk_worker__poll, 0, 0, 1)
+	ZEND_ARG_INFO(0, wait)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_queue_beanstalk_worker__prefetch, 0, 0, 1)
+	ZEND_ARG_INFO(0, index)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_INFO_EX(arginfo_phalcon_queue_beanstalk_worker__addjob, 0, 0, 2)
+	ZEND_ARG_INFO(0, job)
+	ZEND_ARG_INFO(0, index)
+ZEND_END_ARG_INFO()
+
+PHALCON_INIT_FUNCS(phalcon_queue_beanstalk_worker_method_entry){
+	PHP_ME(Phalcon_Queue_Beanstalk_Worker, __construct, arginfo_phalcon_queue_beanstalk_worker___construct, ZEND_ACC_PUBLIC|ZEND_ACC_CTOR) 
+	PHP_ME(Phalcon_Queue_Beanstalk_Worker, run, arginfo_phalcon_queue_beanstalk_worker_run, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Queue_Beanstalk_Worker, touch, NULL, ZEND_ACC_PUBLIC) 
+	PHP_ME(Phalcon_Queue_Beanstalk_Worker, _poll, arginfo_phalcon_queue_beanstalk_worker__poll, ZEND_ACC_PROTECTED) 
+	PHP_ME(Phalcon_Queue_Beanstalk_Worker, _prefetch, arginfo_phalcon_queue_beanstalk_worker__prefetch, ZEND_ACC_PROTECTED) 
+	PHP_ME(Phalcon_Queue_Beanstalk_Worker, _addJob, arginfo_phalcon_queue_beanstalk_worker__addjob, ZEND_ACC_PROTECTED) 
+	PHP_ME(Phalcon_Queue_Beanstalk_Worker, _release, NULL, ZEND_ACC_PROTECTED) 
+	PHP_FE_END
+};
+
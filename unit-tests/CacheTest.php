@@ -140,6 +140,12 @@ class CacheTest extends PHPUnit_Framework_TestCase
 		$cachedContent = $cache->get('test-data');
 		$this->assertEquals($cachedContent, "sure, nothing interesting");
 
+		//Get many
+		$this->assertEquals($cache->getMany(array('test-data', 'test-missing')), array(
+			'test-data' => "sure, nothing interesting",
+			'test-missing' => null
+		));
+
 		//Exists
 		$this->assertTrue($cache->exists('test-data'));
 
@@ -270,6 +276,13 @@ class CacheTest extends PHPUnit_Framework_TestCase
 			0 => 'test-data',
 		));
 
+		//Get many in a single request
+		$memcache->delete('test-missing');
+		$this->assertEquals($cache->getMany(array('test-data', 'test-missing')), array(
+			'test-data' => "sure, nothing interesting",
+			'test-missing' => null
+		));
+
 		//Check if exists
 		$this->assertTrue($cache->exists('test-data'));
 
@@ -196,6 +196,127 @@ class CollectionsTest extends PHPUnit_Framework_TestCase
 			array('artist' => 'Massive Attack')
 		)), 2);
 
+		//Cursor resultsets
+		$songs = Songs::find(array(
+			'conditions' => array('artist' => 'Massive Attack'),
+			'sort' => array('name' => 1),
+			'fields' => array('name' => 1),
+			'batchSize' => 1,
+			'cursor' => true
+		));
+		$this->assertInstanceOf('Phalcon\Mvc\Collection\Resultset', $songs);
+		$this->assertInstanceOf('MongoCursor', $songs->getCursor());
+		$this->assertEquals(count($songs), 2);
+
+		$names = array();
+		foreach ($songs as $position => $song) {
+			$this->assertInstanceOf('Songs', $song);
+			$this->assertFalse(isset($song->artist));
+			$names[$position] = $song->name;
+		}
+		$this->assertEquals($names, array('Paradise Circus', 'Teardrop'));
+
+		$songs = Songs::find(array(
+			'conditions' => array('artist' => 'Lana'),
+			'cursor' => true
+		));
+		$this->assertEquals(count($songs), 0);
+		foreach ($songs as $song) {
+			$this->fail('The cursor must be empty');
+		}
+
+		$song = Songs::findFirst(array(
+			'conditions' => array('artist' => 'Radiohead'),
+			'fields' => array('artist' => 1)
+		));
+		$this->assertEquals($song->artist, 'Radiohead');
+		$this->assertFalse(isset($song->name));
+
+		//Projected documents can't be saved, the missing fields would be lost
+		try {
+			$song->save();
+			$this->fail('Saving a projected document must throw');
+		} catch (Phalcon\Mvc\Collection\Exception $e) {
+			$this->assertEquals($e->getMessage(), "The document was hydrated using a 'fields' projection and can't be saved");
+		}
+
+		$song = Songs::findFirst(array(
+			'conditions' => array('artist' => 'Radiohead')
+		));
+		$this->assertTrue($song->save());
+
+	}
+
+	public function testCollectionsSaveMany()
+	{
+
+		Phalcon\DI::reset();
+
+		$di = new Phalcon\DI();
+
+		$di->set('mongo', function(){
+			$mongo = new Mongo();
+			return $mongo->phalcon_test;
+		});
+
+		$di->set('collectionManager', function(){
+			return new Phalcon\Mvc\Collection\Manager();
+		});
+
+		$total = Songs::count();
+
+		$songs = array();
+		foreach (array('Angel', 'Protection', 'Unfinished Sympathy') as $name) {
+			$song = new Songs();
+			$song->artist = 'Massive Attack (bulk)';
+			$song->name = $name;
+			$songs['song-' . $name] = $song;
+		}
+
+		$results = Songs::saveMany($songs, array('batchSize' => 2));
+		$this->assertEquals($results, array(
+			'song-Angel' => true,
+			'song-Protection' => true,
+			'song-Unfinished Sympathy' => true
+		));
+		$this->assertEquals(Songs::count(), $total + 3);
+
+		foreach ($songs as $song) {
+			$this->assertInstanceOf('MongoId', $song->_id);
+		}
+
+		//Documents with an _id are upserted
+		$songs['song-Angel']->name = 'Angel (Remix)';
+
+		$results = Songs::saveMany(array($songs['song-Angel']), array('events' => false));
+		$this->assertEquals($results, array(true));
+		$this->assertEquals(Songs::count(), $total + 3);
+
+		$song = Songs::findById($songs['song-Angel']->_id);
+		$this->assertEquals($song->name, 'Angel (Remix)');
+
+		//A projected document in the set throws before any document is written
+		$songs['song-Protection']->name = 'Protection (Edit)';
+
+		$projected = Songs::findFirst(array(
+			'conditions' => array('_id' => $songs['song-Angel']->_id),
+			'fields' => array('artist' => 1)
+		));
+
+		try {
+			Songs::saveMany(array($songs['song-Protection'], $projected));
+			$this->fail('Saving a projected document must throw');
+		} catch (Phalcon\Mvc\Collection\Exception $e) {
+			$this->assertEquals($e->getMessage(), "The document was hydrated using a 'fields' projection and can't be saved");
+		}
+
+		$song = Songs::findById($songs['song-Protection']->_id);
+		$this->assertEquals($song->name, 'Protection');
+
+		foreach ($songs as $song) {
+			$this->assertTrue($song->delete());
+		}
+		$this->assertEquals(Songs::count(), $total);
 	}
 
-}
\ No newline at end of file
+}
@@ -34,6 +34,7 @@ class DbBindTest extends PHPUnit_Framework_TestCase
 		$this->_executeRawBindTests($connection);
 		$this->_executeRawBindTestsMysql($connection);
 		$this->_executeConvertBindTests($connection);
+		$this->_executeConvertBindTestsMysql($connection);
 		$this->_executeBindByTypeTests($connection);
 	}
 
@@ -46,6 +47,8 @@ class DbBindTest extends PHPUnit_Framework_TestCase
 
 		$this->_executeRawBindTests($connection);
 		$this->_executeRawBindTestsPostgresql($connection);
+		$this->_executeConvertBindTests($connection);
+		$this->_executeConvertBindTestsStandard($connection);
 		$this->_executeBindByTypeTests($connection);
 	}
 
@@ -58,6 +61,8 @@ class DbBindTest extends PHPUnit_Framework_TestCase
 
    		$this->_executeRawBindTests($connection);
    		$this->_executeRawBindTestsSqlite($connection);
+   		$this->_executeConvertBindTests($connection);
+   		$this->_executeConvertBindTestsStandard($connection);
    		$this->_executeBindByTypeTests($connection);
    	}
 
@@ -137,6 +142,27 @@ class DbBindTest extends PHPUnit_Framework_TestCase
 
 		$params = $connection->convertBoundParams("a=?1 AND b = ?0 AND c > :c: AND d = ?3", array('c' => 1000, 1 => 'some-name', 0 => 15, 3 => 400));
 		$this->assertEquals($params, array('sql' => "a=? AND b = ? AND c > ? AND d = ?", 'params' => array(0 => 'some-name', 1 => 15, 2 => 1000, 3 => 400)));
+
+		$params = $connection->convertBoundParams("a=?1 AND b = ?0 AND c > :c: AND d = ?3", array('c' => 2000, 1 => 'other-name', 0 => 16, 3 => 401));
+		$this->assertEquals($params, array('sql' => "a=? AND b = ? AND c > ? AND d = ?", 'params' => array(0 => 'other-name', 1 => 16, 2 => 2000, 3 => 401)));
+
+		$params = $connection->convertBoundParams("a = ':c:' AND b = :b: AND c = '?0''s :b:' /* ?0 */ AND d = ?0 -- :c:", array('b' => 10, 0 => 20));
+		$this->assertEquals($params, array('sql' => "a = ':c:' AND b = ? AND c = '?0''s :b:' /* ?0 */ AND d = ? -- :c:", 'params' => array(0 => 10, 1 => 20)));
+	}
+
+	protected function _executeConvertBindTestsMysql($connection)
+	{
+		$params = $connection->convertBoundParams("a = 'C:\\\\' AND b = ?0", array(0 => 20));
+		$this->assertEquals($params, array('sql' => "a = 'C:\\\\' AND b = ?", 'params' => array(0 => 20)));
+
+		$params = $connection->convertBoundParams("a = 'It\\'s ?0' AND b = ?1", array(0 => 10, 1 => 20));
+		$this->assertEquals($params, array('sql' => "a = 'It\\'s ?0' AND b = ?", 'params' => array(0 => 20)));
+	}
+
+	protected function _executeConvertBindTestsStandard($connection)
+	{
+		$params = $connection->convertBoundParams("a = 'C:\\' AND b = ?0", array(0 => 20));
+		$this->assertEquals($params, array('sql' => "a = 'C:\\' AND b = ?", 'params' => array(0 => 20)));
 	}
 
    	protected function _executeBindByTypeTests($connection)
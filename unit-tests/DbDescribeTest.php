@@ -777,4 +777,90 @@ class DbDescribeTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($describeReferences, $expectedReferences);
 	}
 
+	protected function _executeSchemaCacheTests($connection, $expectedColumns)
+	{
+		$queries = 0;
+
+		$eventsManager = new Phalcon\Events\Manager();
+		$eventsManager->attach('db', function($event, $connection) use (&$queries) {
+			if ($event->getType() == 'beforeQuery') {
+				$queries++;
+			}
+		});
+		$connection->setEventsManager($eventsManager);
+
+		$expectedIndexes = $connection->describeIndexes('robots_parts');
+		$expectedReferences = $connection->describeReferences('robots_parts');
+
+		$tables = $connection->loadSchema();
+		$this->assertTrue(in_array('personas', $tables));
+		$this->assertTrue(in_array('robots_parts', $tables));
+
+		//Everything is served from the schema cache
+		$queries = 0;
+		$this->assertEquals($connection->describeColumns('personas'), $expectedColumns);
+		$this->assertEquals($connection->describeColumns('personas'), $expectedColumns);
+		$this->assertEquals($connection->describeIndexes('robots_parts'), $expectedIndexes);
+		$this->assertEquals($connection->describeReferences('robots_parts'), $expectedReferences);
+		$this->assertEquals($connection->tableExists('personas'), 1);
+		$this->assertEquals($queries, 0);
+
+		//Negative lookups are cached too
+		$this->assertEquals($connection->tableExists('schema_cache_test'), 0);
+		$this->assertEquals($connection->tableExists('schema_cache_test'), 0);
+		$this->assertEquals($queries, 1);
+
+		//DDL methods invalidate the cache of the table
+		$connection->createTable('schema_cache_test', null, array(
+			'columns' => array(
+				new Phalcon\Db\Column('id', array(
+					'type' => Phalcon\Db\Column::TYPE_INTEGER,
+					'size' => 10,
+					'notNull' => true
+				))
+			)
+		));
+		$this->assertEquals($connection->tableExists('schema_cache_test'), 1);
+		$this->assertEquals(count($connection->describeColumns('schema_cache_test')), 1);
+
+		$connection->dropTable('schema_cache_test', null);
+		$this->assertEquals($connection->tableExists('schema_cache_test'), 0);
+
+		$connection->clearSchemaCache();
+		$queries = 0;
+		$this->assertEquals($connection->describeColumns('personas'), $expectedColumns);
+		$this->assertEquals($queries, 1);
+
+		$connection->useSchemaCache(false);
+		$this->assertEquals($connection->describeColumns('personas'), $expectedColumns);
+		$this->assertEquals($queries, 2);
+	}
+
+	public function testSchemaCacheMysql()
+	{
+		require 'unit-tests/config.db.php';
+
+		$connection = new Phalcon\Db\Adapter\Pdo\Mysql($configMysql);
+
+		$this->_executeSchemaCacheTests($connection, $this->getExpectedColumnsMysql());
+	}
+
+	public function testSchemaCachePostgresql()
+	{
+		require 'unit-tests/config.db.php';
+
+		$connection = new Phalcon\Db\Adapter\Pdo\Postgresql($configPostgresql);
+
+		$this->_executeSchemaCacheTests($connection, $this->getExpectedColumnsPostgresql());
+	}
+
+	public function testSchemaCacheSqlite()
+	{
+		require 'unit-tests/config.db.php';
+
+		$connection = new Phalcon\Db\Adapter\Pdo\Sqlite($configSqlite);
+
+		$this->_executeSchemaCacheTests($connection, $this->getExpectedColumnsSqlite());
+	}
+
 }
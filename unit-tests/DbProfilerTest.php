@@ -76,6 +76,7 @@ class DbProfilerTest extends PHPUnit_Framework_TestCase
 		$connection = new Phalcon\Db\Adapter\Pdo\Mysql($configMysql);
 
 		$this->_executeTests($connection);
+		$this->_executeRingBufferTests($connection);
 	}
 
 	public function testDbPostgresql()
@@ -86,6 +87,7 @@ class DbProfilerTest extends PHPUnit_Framework_TestCase
 		$connection = new Phalcon\Db\Adapter\Pdo\Postgresql($configPostgresql);
 
 		$this->_executeTests($connection);
+		$this->_executeRingBufferTests($connection);
 	}
 
 	public function _executeTests($connection)
@@ -139,4 +141,62 @@ class DbProfilerTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($profiler->getNumberTotalStatements(), 0);
 	}
 
+	public function _executeRingBufferTests($connection)
+	{
+
+		$profiler = new Phalcon\Db\Profiler();
+		$profiler->setRingBuffer(3, 2);
+
+		$eventsManager = new Phalcon\Events\Manager();
+
+		$eventsManager->attach('db', function($event, $connection) use ($profiler) {
+			if ($event->getType() == 'beforeQuery') {
+				$profiler->startProfile($connection->getSQLStatement());
+			}
+			if ($event->getType() == 'afterQuery') {
+				$profiler->stopProfile(1);
+			}
+		});
+
+		$connection->setEventsManager($eventsManager);
+
+		$connection->query("SELECT * FROM personas LIMIT 3");
+		$connection->query("SELECT * FROM personas LIMIT 5");
+		$connection->query("SELECT * FROM personas  LIMIT 10");
+		$connection->query("SELECT * FROM personas WHERE estado = 'A' LIMIT 1");
+		$connection->query("SELECT COUNT(*) FROM personas");
+
+		$this->assertEquals($profiler->getNumberTotalStatements(), 5);
+		$this->assertEquals(count($profiler->getProfiles()), 0);
+
+		$export = $profiler->export();
+		$this->assertEquals($export['statements'], 5);
+		$this->assertEquals(gettype($export['totalSeconds']), "double");
+
+		//Only the last three profiles are kept
+		$this->assertEquals(count($export['profiles']), 3);
+		$this->assertEquals($export['profiles'][0]['sql'], "SELECT * FROM personas  LIMIT 10");
+		$this->assertEquals($export['profiles'][2]['sql'], "SELECT COUNT(*) FROM personas");
+
+		//Fingerprints are limited to two including the entry where the rest is merged
+		$this->assertEquals(array_keys($export['fingerprints']), array(
+			'SELECT * FROM personas LIMIT ?',
+			'(other)'
+		));
+		$this->assertEquals($export['fingerprints']['(other)']['count'], 2);
+
+		$aggregate = $export['fingerprints']['SELECT * FROM personas LIMIT ?'];
+		$this->assertEquals($aggregate['count'], 3);
+		$this->assertEquals($aggregate['rows'], 3);
+		$this->assertTrue($aggregate['minSeconds'] <= $aggregate['p95Seconds']);
+		$this->assertTrue($aggregate['p95Seconds'] <= $aggregate['maxSeconds']);
+
+		$profiler->reset();
+
+		$this->assertEquals($profiler->getNumberTotalStatements(), 0);
+		$export = $profiler->export();
+		$this->assertEquals(count($export['profiles']), 0);
+		$this->assertEquals(count($export['fingerprints']), 0);
+	}
+
 }
@@ -77,6 +77,67 @@ class DbTest extends PHPUnit_Framework_TestCase
 
 	}
 
+	protected function _getPoolCounter($counter)
+	{
+		$total = 0;
+		foreach (Phalcon\Db\Adapter\Pdo::getPoolStats() as $pool) {
+			$total += $pool[$counter];
+		}
+		return $total;
+	}
+
+	public function testDbPersistentPoolMysql()
+	{
+
+		require 'unit-tests/config.db.php';
+
+		$config = array_merge($configMysql, array(
+			'persistent' => true,
+			'poolSize' => 2,
+			'pingInterval' => 0
+		));
+
+		$overflows = $this->_getPoolCounter('overflows');
+		$rollbacks = $this->_getPoolCounter('rollbacks');
+		$pings = $this->_getPoolCounter('pings');
+
+		//Every slot of the pool is a different connection
+		$connection1 = new Phalcon\Db\Adapter\Pdo\Mysql($config);
+		$connection2 = new Phalcon\Db\Adapter\Pdo\Mysql($config);
+
+		$id1 = $connection1->fetchOne('SELECT CONNECTION_ID()', Phalcon\Db::FETCH_NUM);
+		$id2 = $connection2->fetchOne('SELECT CONNECTION_ID()', Phalcon\Db::FETCH_NUM);
+		$this->assertNotEquals($id1[0], $id2[0]);
+
+		//The pool is full, a non-persistent connection is used
+		$connection3 = new Phalcon\Db\Adapter\Pdo\Mysql($config);
+		$this->assertEquals($this->_getPoolCounter('overflows'), $overflows + 1);
+		$connection3->close();
+
+		//Open transactions are rolled back when the connection is returned to the pool
+		$this->assertTrue($connection1->begin());
+		$this->assertTrue($connection1->close());
+		$this->assertEquals($this->_getPoolCounter('rollbacks'), $rollbacks + 1);
+
+		//The released connection is reused and validated
+		$connection4 = new Phalcon\Db\Adapter\Pdo\Mysql($config);
+		$this->assertFalse($connection4->isUnderTransaction());
+		$this->assertEquals($this->_getPoolCounter('pings'), $pings + 1);
+
+		$id4 = $connection4->fetchOne('SELECT CONNECTION_ID()', Phalcon\Db::FETCH_NUM);
+		$this->assertEquals($id1[0], $id4[0]);
+
+		$connection2->close();
+		$connection4->close();
+
+		//Adapters destroyed without being closed return their connection to the pool too
+		$inUse = $this->_getPoolCounter('inUse');
+		$connection5 = new Phalcon\Db\Adapter\Pdo\Mysql($config);
+		$this->assertEquals($this->_getPoolCounter('inUse'), $inUse + 1);
+		unset($connection5);
+		$this->assertEquals($this->_getPoolCounter('inUse'), $inUse);
+	}
+
 	public function testDbSqlite()
 	{
 
@@ -143,6 +204,27 @@ class DbTest extends PHPUnit_Framework_TestCase
 		$row = $result->fetch();
 		$this->assertEquals($row, false);
 
+		$result = $connection->query("SELECT * FROM personas LIMIT 5");
+		$batch = $result->fetchBatch(2);
+		$this->assertEquals(count($batch), 2);
+		$batch = $result->fetchBatch(2);
+		$this->assertEquals(count($batch), 2);
+		$batch = $result->fetchBatch(2);
+		$this->assertEquals(count($batch), 1);
+		$batch = $result->fetchBatch(2);
+		$this->assertEquals($batch, array());
+
+		$number = 0;
+		$result = $connection->query("SELECT * FROM personas WHERE estado = ? LIMIT 7", array("A"), null, true);
+		$result->setFetchMode(Phalcon\Db::FETCH_NUM);
+		while ($rows = $result->fetchBatch(3)) {
+			foreach ($rows as $row) {
+				$this->assertEquals(count($row), 11);
+				$number++;
+			}
+		}
+		$this->assertEquals($number, 7);
+
 		$result = $connection->execute("DELETE FROM prueba");
 		$this->assertTrue($result);
 
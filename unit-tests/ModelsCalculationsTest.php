@@ -323,6 +323,21 @@ class ModelsCalculationsTest extends PHPUnit_Framework_TestCase
 		$group = Pessoas::minimum(array("column" => "cidadeId", "group" => "estado", "order" => "minimum ASC"));
 		$this->assertEquals($group[0]->minimum, 20404);
 
+		//Bound parameters on renamed columns
+		$rowcount = Pessoas::count(array("estado = ?0", "bind" => array('I'), "bindTypes" => array(Phalcon\Db\Column::BIND_PARAM_STR)));
+		$this->assertEquals($rowcount, 2);
+
+		$total = Pessoas::sum(array("column" => "credito", "conditions" => "estado = :estado:", "bind" => array('estado' => 'I')));
+		$this->assertEquals(567020.00, $total);
+
+		$rowcount = Pessoas::count(array("estado = 'A'", "limit" => 10));
+		$this->assertEquals($rowcount, 2178);
+
+		//Scalars from PHQL
+		$manager = Phalcon\DI::getDefault()->getShared('modelsManager');
+		$query = $manager->createQuery("SELECT MAX(cidadeId) FROM Pessoas WHERE estado = ?0");
+		$this->assertEquals($query->getSingleScalar(array('I')), 127591);
+
 	}
 
 
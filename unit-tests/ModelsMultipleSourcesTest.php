@@ -96,4 +96,84 @@ class ModelsMultipleSourcesTest extends PHPUnit_Framework_TestCase
 		$this->assertFalse($robot->save());
 	}
 
+	public function testReadReplicas()
+	{
+		require 'unit-tests/config.db.php';
+		if (empty($configMysql)) {
+			$this->markTestSkipped('Test skipped');
+			return;
+		}
+
+		Phalcon\DI::reset();
+
+		$di = new Phalcon\DI();
+
+		$di->set('modelsManager', function() {
+			return new Phalcon\Mvc\Model\Manager();
+		}, true);
+
+		$di->set('modelsMetadata', function() {
+			return new Phalcon\Mvc\Model\Metadata\Memory();
+		}, true);
+
+		$di->set('db', function() {
+			require 'unit-tests/config.db.php';
+			return new Phalcon\Db\Adapter\Pdo\Mysql($configMysql);
+		}, true);
+
+		$di->set('dbReplica', function() {
+			require 'unit-tests/config.db.php';
+			return new Phalcon\Db\Adapter\Pdo\Mysql($configMysql);
+		}, true);
+
+		$di->set('dbBroken', function() {
+			throw new PDOException('Connection refused');
+		}, true);
+
+		$manager = $di->getShared('modelsManager');
+		$manager->setReadReplicas(array('dbBroken' => 1, 'dbReplica' => 1), 'weighted');
+
+		$robot = new Robots();
+
+		//The broken replica is skipped and marked as unhealthy
+		$connection = $manager->getReadConnection($robot);
+		$this->assertSame($connection, $di->getShared('dbReplica'));
+
+		$unhealthy = $manager->getUnhealthyReplicas();
+		$this->assertTrue(isset($unhealthy['dbBroken']));
+
+		$connection = $manager->getReadConnection($robot);
+		$this->assertSame($connection, $di->getShared('dbReplica'));
+
+		$this->assertTrue(is_object(Robots::findFirst()));
+
+		//Obtaining the write connection alone doesn't pin the reads
+		$manager->getWriteConnection($robot);
+		$connection = $manager->getReadConnection($robot);
+		$this->assertSame($connection, $di->getShared('dbReplica'));
+
+		//Reads are pinned to the primary after a write
+		$robot = Robots::findFirst();
+		$this->assertTrue($robot->save());
+		$connection = $manager->getReadConnection($robot);
+		$this->assertSame($connection, $di->getShared('db'));
+
+		$manager->releasePinnedReads();
+		$connection = $manager->getReadConnection($robot);
+		$this->assertSame($connection, $di->getShared('dbReplica'));
+
+		//All the replicas are unhealthy, the primary is used
+		$manager->markReplicaUnhealthy('dbReplica');
+		$connection = $manager->getReadConnection($robot);
+		$this->assertSame($connection, $di->getShared('db'));
+
+		try {
+			$manager->setReadReplicas(array('dbReplica'), 'random');
+			$this->assertTrue(false);
+		}
+		catch (Phalcon\Mvc\Model\Exception $e) {
+			$this->assertEquals($e->getMessage(), 'Unknown replica selection policy');
+		}
+	}
+
 }
\ No newline at end of file
@@ -69,6 +69,7 @@ class ModelsRelationsTest extends PHPUnit_Framework_TestCase
 
 		$this->_executeTestsNormal($di);
 		$this->_executeTestsRenamed($di);
+		$this->_executeTestsIdentityMap($di);
 
 	}
 
@@ -84,6 +85,7 @@ class ModelsRelationsTest extends PHPUnit_Framework_TestCase
 
 		$this->_executeTestsNormal($di);
 		$this->_executeTestsRenamed($di);
+		$this->_executeTestsIdentityMap($di);
 
 	}
 
@@ -99,6 +101,7 @@ class ModelsRelationsTest extends PHPUnit_Framework_TestCase
 
 		$this->_executeTestsNormal($di);
 		$this->_executeTestsRenamed($di);
+		$this->_executeTestsIdentityMap($di);
 
 	}
 
@@ -192,6 +195,130 @@ class ModelsRelationsTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals(count($robotsParts), 2);
 		$this->assertEquals($robotsParts->getFirst()->parts_id, 3);
 
+		/** Eager loading of relations */
+		$numberQueries = 0;
+
+		$eventsManager = new Phalcon\Events\Manager();
+		$eventsManager->attach('db', function($event, $connection) use (&$numberQueries) {
+			if ($event->getType() == 'beforeQuery') {
+				$numberQueries++;
+			}
+		});
+
+		$connection = $di->getShared('db');
+		$connection->setEventsManager($eventsManager);
+
+		$robots = Robots::find(array("with" => "robotsParts"));
+		$this->assertEquals($numberQueries, 2);
+
+		$total = 0;
+		foreach ($robots as $robot) {
+			$robotsParts = $robot->robotsParts;
+			$this->assertEquals(get_class($robotsParts), 'Phalcon\Mvc\Model\Resultset\Simple');
+			foreach ($robotsParts as $robotPart) {
+				$this->assertEquals($robotPart->robots_id, $robot->id);
+				$total++;
+			}
+		}
+		$this->assertEquals($total, RobotsParts::count());
+		$this->assertEquals($numberQueries, 3);
+
+		$numberQueries = 0;
+
+		$robotsParts = RobotsParts::query()->with(array("robots", "parts"))->execute();
+		$this->assertEquals($numberQueries, 3);
+
+		foreach ($robotsParts as $robotPart) {
+			$this->assertEquals(get_class($robotPart->robots), 'Robots');
+			$this->assertEquals(get_class($robotPart->parts), 'Parts');
+			$this->assertEquals($robotPart->robots->id, $robotPart->robots_id);
+		}
+		$this->assertEquals($numberQueries, 3);
+
+		/** Writing to the referenced model discards the records loaded in advance */
+		$di->getShared('modelsManager')->invalidateQueryCache('RobotsParts');
+
+		$numberQueries = 0;
+		foreach ($robots as $robot) {
+			$robot->robotsParts;
+		}
+		$this->assertEquals($numberQueries, count($robots));
+
+		/** Eager loading through the query builder */
+		$builder = new Phalcon\Mvc\Model\Query\Builder();
+		$builder->setDI($di);
+		$robots = $builder->from('Robots')->with('robotsParts')->getQuery()->execute();
+		$this->assertEquals($builder->getWith(), 'robotsParts');
+
+		$numberQueries = 0;
+		foreach ($robots as $robot) {
+			foreach ($robot->robotsParts as $robotPart) {
+				$this->assertEquals($robotPart->robots_id, $robot->id);
+			}
+		}
+		$this->assertEquals($numberQueries, 0);
+
+		/** The relations of a single record are loaded once */
+		$numberQueries = 0;
+		$robot = Robots::findFirst(array("with" => "robotsParts"));
+		$this->assertEquals($numberQueries, 2);
+
+		foreach ($robot->robotsParts as $robotPart) {
+			$this->assertEquals($robotPart->robots_id, $robot->id);
+		}
+		$this->assertEquals($numberQueries, 2);
+
+		$connection->setEventsManager(null);
+
+	}
+
+	public function _executeTestsIdentityMap($di)
+	{
+
+		$manager = $di->getShared('modelsManager');
+		$this->assertFalse($manager->isUsingIdentityMap());
+
+		$robot = Robots::findFirst(1);
+		$this->assertNotSame($robot, Robots::findFirst(1));
+
+		$manager->useIdentityMap(true);
+		$this->assertTrue($manager->isUsingIdentityMap());
+
+		$robot = Robots::findFirst(1);
+		$this->assertEquals($manager->getIdentityKey($robot), 'robots$1');
+		$this->assertSame($robot, Robots::findFirst(1));
+		$this->assertSame($robot, Robots::findFirst("id = 1"));
+		$this->assertSame($robot, $manager->getIdentityRecord('Robots', 1));
+
+		$stats = $manager->getIdentityMapStats();
+		$this->assertEquals($stats['hits'], 2);
+		$this->assertEquals($stats['misses'], 1);
+		$this->assertEquals($stats['records'], 1);
+
+		/** belongsTo relations use the identity map */
+		$robotPart = RobotsParts::findFirst("robots_id = 1");
+		$this->assertSame($robotPart->getRobots(), $robot);
+
+		/** Saving and refreshing keep the identity map consistent */
+		$name = $robot->name;
+		$robot->name = 'Identity';
+		$this->assertTrue($robot->save());
+		$this->assertEquals(Robots::findFirst(1)->name, 'Identity');
+
+		$robot->name = $name;
+		$this->assertTrue($robot->save());
+
+		$otherRobot = Robots::findFirst(array("id = 1", "columns" => "id, name"));
+		$this->assertEquals($otherRobot->name, $name);
+
+		$manager->removeIdentityRecord($robot);
+		$this->assertFalse($manager->getIdentityRecord('Robots', 1));
+
+		$manager->clearIdentityMap();
+		$stats = $manager->getIdentityMapStats();
+		$this->assertEquals($stats['records'], 0);
+
+		$manager->useIdentityMap(false);
 	}
 
 	public function _executeTestsRenamed($di)
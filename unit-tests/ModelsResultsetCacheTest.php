@@ -200,6 +200,103 @@ class ModelsResultsetCacheTest extends PHPUnit_Framework_TestCase
 		));
 	}
 
+	protected function _testCacheManagedByOrm($di)
+	{
+
+		$di->set('modelsCache', function(){
+			$frontCache = new Phalcon\Cache\Frontend\Data();
+			return new Phalcon\Cache\Backend\File($frontCache, array(
+				'cacheDir' => 'unit-tests/cache/'
+			));
+		}, true);
+
+		$di->getShared('modelsManager')->setQueryCacheService('modelsCache', 3600);
+
+		$robots = Robots::find(array(
+			'cache' => array('lifetime' => 3600),
+			'order' => 'id'
+		));
+		$this->assertEquals(count($robots), 3);
+		$this->assertTrue($robots->isFresh());
+
+		$robots = Robots::find(array(
+			'cache' => array('lifetime' => 3600),
+			'order' => 'id'
+		));
+		$this->assertEquals(count($robots), 3);
+		$this->assertFalse($robots->isFresh());
+
+		//Different bound values produce a different key
+		$robots = Robots::find(array(
+			'conditions' => 'id > ?0',
+			'bind' => array(1),
+			'cache' => array('lifetime' => 3600)
+		));
+		$this->assertEquals(count($robots), 2);
+		$this->assertTrue($robots->isFresh());
+
+		//Saving a record bumps the version of the model
+		$robot = Robots::findFirst(1);
+		$this->assertTrue($robot->save());
+
+		$robots = Robots::find(array(
+			'cache' => array('lifetime' => 3600),
+			'order' => 'id'
+		));
+		$this->assertEquals(count($robots), 3);
+		$this->assertTrue($robots->isFresh());
+
+		$robots = Robots::find(array(
+			'cache' => array('lifetime' => 3600),
+			'order' => 'id'
+		));
+		$this->assertFalse($robots->isFresh());
+
+		$di->getShared('modelsManager')->invalidateQueryCache('Robots');
+
+		$robots = Robots::find(array(
+			'cache' => array('lifetime' => 3600),
+			'order' => 'id'
+		));
+		$this->assertTrue($robots->isFresh());
+
+		//Writing a joined model invalidates the query too
+		$query = new Phalcon\Mvc\Model\Query('SELECT Robots.* FROM Robots JOIN RobotsParts ON RobotsParts.robots_id = Robots.id');
+		$query->setDI($di);
+		$query->cache(array('lifetime' => 3600));
+		$this->assertTrue($query->execute()->isFresh());
+		$this->assertFalse($query->execute()->isFresh());
+
+		$di->getShared('modelsManager')->invalidateQueryCache('RobotsParts');
+		$this->assertTrue($query->execute()->isFresh());
+
+		//Inside a transaction the shared version changes after the commit
+		$cache = $di->getShared('modelsCache');
+		$version = $cache->get('phqlv-robots');
+
+		$connection = $di->getShared('db');
+		$connection->begin();
+		$robot = Robots::findFirst(1);
+		$this->assertTrue($robot->save());
+		$this->assertEquals($cache->get('phqlv-robots'), $version);
+		$connection->commit();
+		$this->assertNotEquals($cache->get('phqlv-robots'), $version);
+
+		$version = $cache->get('phqlv-robots');
+		$connection->begin();
+		$this->assertTrue($robot->save());
+		$connection->rollback();
+		$this->assertEquals($cache->get('phqlv-robots'), $version);
+
+		//Versions are seeded from the timestamp plus a random part
+		if (PHP_INT_SIZE > 4) {
+			$versions = $di->getShared('modelsManager')->getQueryCacheVersions(array('Robots'));
+			$this->assertGreaterThan(time(), $versions['robots']);
+		}
+
+		$di->getShared('modelsManager')->setQueryCacheService(null);
+	}
+
 	public function testCacheDefaultDIMysql()
 	{
 		$di = $this->_prepareTestMysql();
@@ -254,4 +351,22 @@ class ModelsResultsetCacheTest extends PHPUnit_Framework_TestCase
 		$robots = $this->_testCacheOtherService($di);
 	}
 
+	public function testCacheManagedByOrmMysql()
+	{
+		$di = $this->_prepareTestMysql();
+		$this->_testCacheManagedByOrm($di);
+	}
+
+	public function testCacheManagedByOrmPostgresql()
+	{
+		$di = $this->_prepareTestPostgresql();
+		$this->_testCacheManagedByOrm($di);
+	}
+
+	public function testCacheManagedByOrmSqlite()
+	{
+		$di = $this->_prepareTestSqlite();
+		$this->_testCacheManagedByOrm($di);
+	}
+
 }
@@ -146,6 +146,167 @@ class PaginatorTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($page->total_pages, 4);
 	}
 
+	public function testQueryBuilderPaginator()
+	{
+		$this->_loadDI();
+
+		$di = Phalcon\DI::getDefault();
+
+		$di->set('modelsCache', function(){
+			$frontCache = new Phalcon\Cache\Frontend\Data();
+			return new Phalcon\Cache\Backend\Memory($frontCache);
+		}, true);
+
+		$builder = $di->get('modelsManager')->createBuilder()
+			->from('Personnes')
+			->orderBy('cedula');
+
+		$total = Personnes::count();
+
+		$paginator = new Phalcon\Paginator\Adapter\QueryBuilder(array(
+			'builder' => $builder,
+			'limit' => 10,
+			'page' => 1,
+			'countCache' => array('key' => 'personnes-count')
+		));
+
+		//First Page
+		$page = $paginator->getPaginate();
+		$this->assertEquals(get_class($page), 'stdClass');
+
+		$this->assertEquals(count($page->items), 10);
+
+		$this->assertEquals($page->before, 1);
+		$this->assertEquals($page->next, 2);
+		$this->assertEquals($page->last, ceil($total / 10));
+
+		$this->assertEquals($page->current, 1);
+		$this->assertEquals($page->total_pages, ceil($total / 10));
+		$this->assertEquals($page->total_items, $total);
+
+		//The total is served from the cache
+		$this->assertEquals($di->getShared('modelsCache')->get('personnes-count'), $total);
+
+		//Middle Page
+		$paginator->setCurrentPage(50);
+
+		$page = $paginator->getPaginate();
+		$this->assertEquals(count($page->items), 10);
+		$this->assertEquals($page->before, 49);
+		$this->assertEquals($page->next, 51);
+		$this->assertEquals($page->current, 50);
+
+		//The builder passed to the paginator is not modified
+		$this->assertEquals($builder->getLimit(), null);
+	}
+
+	public function testQueryBuilderPaginatorKeyset()
+	{
+		$this->_loadDI();
+
+		$builder = Phalcon\DI::getDefault()->get('modelsManager')->createBuilder()
+			->from('Personnes')
+			->where('estado = :estado:');
+
+		$paginator = new Phalcon\Paginator\Adapter\QueryBuilder(array(
+			'builder' => $builder,
+			'bind' => array('estado' => 'A'),
+			'limit' => 10,
+			'keyset' => 'cedula'
+		));
+
+		$page = $paginator->getPaginate();
+		$this->assertEquals(count($page->items), 10);
+		$this->assertEquals($page->current, null);
+
+		$cedulas = array();
+		foreach ($page->items as $personne) {
+			$cedulas[] = $personne->cedula;
+		}
+		$this->assertEquals($page->next, $cedulas[9]);
+
+		$paginator->setCursor($page->next);
+
+		$page = $paginator->getPaginate();
+		$this->assertEquals(count($page->items), 10);
+		foreach ($page->items as $personne) {
+			$this->assertTrue(strcmp($personne->cedula, $cedulas[9]) > 0);
+			$this->assertEquals($personne->estado, 'A');
+		}
+	}
+
+	public function testQueryBuilderPaginatorKeysetTies()
+	{
+		$this->_loadDI();
+
+		$builder = Phalcon\DI::getDefault()->get('modelsManager')->createBuilder()
+			->from('Personnes')
+			->where('estado = :estado:');
+
+		$paginator = new Phalcon\Paginator\Adapter\QueryBuilder(array(
+			'builder' => $builder,
+			'bind' => array('estado' => 'A'),
+			'limit' => 10,
+			'keyset' => 'estado'
+		));
+
+		//Every row has the same keyset value, the primary key orders them
+		$cedulas = array();
+		for ($i = 0; $i < 3; $i++) {
+			$page = $paginator->getPaginate();
+			$this->assertEquals(count($page->items), 10);
+			foreach ($page->items as $personne) {
+				$cedulas[] = $personne->cedula;
+			}
+			$this->assertEquals($page->next, array('A', $cedulas[count($cedulas) - 1]));
+			$paginator->setCursor($page->next);
+		}
+
+		$this->assertEquals(count(array_unique($cedulas)), 30);
+
+		$sorted = $cedulas;
+		sort($sorted, SORT_STRING);
+		$this->assertEquals($cedulas, $sorted);
+
+		try {
+			$paginator->setCursor('A');
+			$paginator->getPaginate();
+			$this->assertTrue(false);
+		}
+		catch (Phalcon\Paginator\Exception $e) {
+			$this->assertEquals($e->getMessage(), 'The cursor must be an array with the keyset and primary key values');
+		}
+	}
+
+	public function testQueryBuilderPaginatorGrouped()
+	{
+		$this->_loadDI();
+
+		$di = Phalcon\DI::getDefault();
+
+		$groups = $di->get('modelsManager')->executeQuery('SELECT ciudad_id FROM Personnes GROUP BY ciudad_id HAVING COUNT(*) > 1');
+
+		$builder = $di->get('modelsManager')->createBuilder()
+			->columns('ciudad_id, COUNT(*) AS total')
+			->from('Personnes')
+			->groupBy('ciudad_id')
+			->having('COUNT(*) > 1');
+
+		$paginator = new Phalcon\Paginator\Adapter\QueryBuilder(array(
+			'builder' => $builder,
+			'limit' => 10,
+			'page' => 1
+		));
+
+		//The groups are counted by the database
+		$page = $paginator->getPaginate();
+		$this->assertEquals($page->total_items, count($groups));
+		$this->assertEquals($page->total_pages, ceil(count($groups) / 10));
+
+		$query = $di->get('modelsManager')->createQuery('SELECT ciudad_id FROM Personnes GROUP BY ciudad_id HAVING COUNT(*) > 1');
+		$this->assertSame($query->getRowCount(), count($groups));
+	}
+
 	public function testArrayPaginator()
 	{
 
@@ -0,0 +1,278 @@
+<?php
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2013 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+/**
+ * The server side of a socket pair stands in for beanstalkd, the responses are written
+ * in advance and the commands sent by the client are read back
+ */
+class BeanstalkStandIn extends Phalcon\Queue\Beanstalk
+{
+
+	public function setConnection($connection)
+	{
+		$this->_connection = $connection;
+	}
+
+}
+
+class Base64Encoder
+{
+
+	public function encode($data)
+	{
+		return base64_encode($data);
+	}
+
+	public function decode($payload)
+	{
+		return base64_decode($payload);
+	}
+
+}
+
+class QueueBeanstalkTest extends PHPUnit_Framework_TestCase
+{
+
+	protected function _getQueue($options=null)
+	{
+		if (!function_exists('stream_socket_pair')) {
+			$this->markTestSkipped('Socket pairs are not available');
+			return false;
+		}
+
+		$pair = stream_socket_pair(STREAM_PF_UNIX, STREAM_SOCK_STREAM, STREAM_IPPROTO_IP);
+
+		$queue = new BeanstalkStandIn($options);
+		$queue->setConnection($pair[0]);
+
+		return array($queue, $pair[1]);
+	}
+
+	protected function _readCommands($server)
+	{
+		stream_set_blocking($server, 0);
+		$commands = '';
+		while (($data = fread($server, 8192)) != '') {
+			$commands .= $data;
+		}
+		return $commands;
+	}
+
+	public function testEncoders()
+	{
+		$queue = new Phalcon\Queue\Beanstalk();
+		$this->assertEquals($queue->getEncoder(), Phalcon\Queue\Beanstalk::ENCODER_SERIALIZE);
+
+		$queue = new Phalcon\Queue\Beanstalk(array('encoder' => Phalcon\Queue\Beanstalk::ENCODER_JSON));
+		$this->assertEquals($queue->getEncoder(), Phalcon\Queue\Beanstalk::ENCODER_JSON);
+
+		$encoder = new Base64Encoder();
+		$queue->setEncoder($encoder);
+		$this->assertSame($queue->getEncoder(), $encoder);
+
+		try {
+			$queue->setEncoder(100);
+			$this->assertTrue(false);
+		}
+		catch (Phalcon\Exception $e) {
+			$this->assertEquals($e->getMessage(), 'Invalid encoder');
+		}
+
+		if (!function_exists('igbinary_serialize')) {
+			try {
+				$queue->setEncoder(Phalcon\Queue\Beanstalk::ENCODER_IGBINARY);
+				$this->assertTrue(false);
+			}
+			catch (Phalcon\Exception $e) {
+				$this->assertEquals($e->getMessage(), 'The igbinary extension is required by ENCODER_IGBINARY');
+			}
+			$this->assertSame($queue->getEncoder(), $encoder);
+		}
+	}
+
+	public function testPutMany()
+	{
+		list($queue, $server) = $this->_getQueue(array('encoder' => Phalcon\Queue\Beanstalk::ENCODER_JSON));
+
+		fwrite($server, "INSERTED 1\r\nINSERTED 2\r\nBURIED 3\r\nJOB_TOO_BIG\r\n");
+
+		$ids = $queue->putMany(array(
+			'first' => array('a' => 1),
+			'second' => array('b' => 2),
+			'third' => array('c' => 3),
+			'fourth' => array('d' => 4)
+		), array('priority' => 50, 'batchSize' => 3));
+
+		$this->assertEquals($ids, array(
+			'first' => '1',
+			'second' => '2',
+			'third' => '3',
+			'fourth' => false
+		));
+
+		$this->assertEquals($this->_readCommands($server),
+			"put 50 0 86400 7\r\n{\"a\":1}\r\n" .
+			"put 50 0 86400 7\r\n{\"b\":2}\r\n" .
+			"put 50 0 86400 7\r\n{\"c\":3}\r\n" .
+			"put 50 0 86400 7\r\n{\"d\":4}\r\n"
+		);
+
+		list($queue, $server) = $this->_getQueue(array('encoder' => Phalcon\Queue\Beanstalk::ENCODER_RAW));
+		$this->assertEquals($queue->putMany(array()), array());
+		$this->assertEquals($this->_readCommands($server), '');
+	}
+
+	public function testDeleteMany()
+	{
+		list($queue, $server) = $this->_getQueue();
+
+		fwrite($server, "DELETED\r\nNOT_FOUND\r\nDELETED\r\n");
+
+		$this->assertEquals($queue->deleteMany(array(10, 11, 12), array('batchSize' => 2)), array(
+			10 => true,
+			11 => false,
+			12 => true
+		));
+
+		$this->assertEquals($this->_readCommands($server), "delete 10\r\ndelete 11\r\ndelete 12\r\n");
+	}
+
+	public function testWork()
+	{
+		list($queue, $server) = $this->_getQueue(array('encoder' => new Base64Encoder()));
+
+		fwrite($server, "RESERVED 7 8\r\n" . base64_encode('hello') . "\r\nTIMED_OUT\r\nRESERVED 8 8\r\n" . base64_encode('world') . "\r\nTIMED_OUT\r\nTIMED_OUT\r\n");
+
+		$bodies = array();
+		$processed = $queue->work(function($job) use (&$bodies) {
+			$bodies[$job->getId()] = $job->getBody();
+		}, array('timeout' => 1, 'idleTimeouts' => 2));
+
+		$this->assertEquals($processed, 2);
+		$this->assertEquals($bodies, array(7 => 'hello', 8 => 'world'));
+		$this->assertEquals($this->_readCommands($server), str_repeat("reserve-with-timeout 1\r\n", 5));
+
+		list($queue, $server) = $this->_getQueue(array('encoder' => Phalcon\Queue\Beanstalk::ENCODER_RAW));
+
+		fwrite($server, "RESERVED 1 3\r\nabc\r\nRESERVED 2 3\r\ndef\r\n");
+
+		$processed = $queue->work(function($job) {
+			return false;
+		});
+		$this->assertEquals($processed, 1);
+
+		$processed = $queue->work(function($job) {
+			return true;
+		}, array('maxJobs' => 1));
+		$this->assertEquals($processed, 1);
+	}
+
+	public function testWorker()
+	{
+		list($first, $firstServer) = $this->_getQueue(array('encoder' => Phalcon\Queue\Beanstalk::ENCODER_RAW));
+		list($second, $secondServer) = $this->_getQueue(array('encoder' => Phalcon\Queue\Beanstalk::ENCODER_RAW));
+
+		fwrite($firstServer, "RESERVED 1 1\r\na\r\nRESERVED 2 1\r\nb\r\n");
+		fwrite($secondServer, "RESERVED 3 1\r\nc\r\n");
+
+		$worker = new Phalcon\Queue\Beanstalk\Worker(array($first, $second), array(
+			'prefetch' => 2,
+			'timeout' => 1,
+			'touchInterval' => 0
+		));
+
+		$bodies = array();
+		$processed = $worker->run(function($job) use (&$bodies, $firstServer, $secondServer) {
+			$bodies[] = $job->getBody();
+			if ($job->getBody() == 'c') {
+				fwrite($firstServer, "TIMED_OUT\r\n");
+				fwrite($secondServer, "TIMED_OUT\r\n");
+			}
+		}, array('idleTimeouts' => 1));
+
+		$this->assertEquals($processed, 3);
+		$this->assertEquals($bodies, array('a', 'b', 'c'));
+
+		//The second reserve of the first connection prefetches without waiting
+		$this->assertEquals($this->_readCommands($firstServer), "reserve-with-timeout 1\r\nreserve-with-timeout 0\r\nreserve-with-timeout 1\r\n");
+		$this->assertEquals($this->_readCommands($secondServer), "reserve-with-timeout 1\r\nreserve-with-timeout 1\r\n");
+	}
+
+	public function testWorkerReleaseAndTouch()
+	{
+		list($queue, $server) = $this->_getQueue(array('encoder' => Phalcon\Queue\Beanstalk::ENCODER_RAW));
+
+		fwrite($server, "RESERVED 1 1\r\na\r\nRESERVED 2 1\r\nb\r\nRELEASED\r\n");
+
+		$worker = new Phalcon\Queue\Beanstalk\Worker(array($queue), array('prefetch' => 2));
+
+		$processed = $worker->run(function($job) {
+			return false;
+		});
+
+		$this->assertEquals($processed, 1);
+		$this->assertEquals($this->_readCommands($server), "reserve-with-timeout 1\r\nreserve-with-timeout 0\r\nrelease 2 100 0\r\n");
+
+		list($queue, $server) = $this->_getQueue(array('encoder' => Phalcon\Queue\Beanstalk::ENCODER_RAW));
+
+		fwrite($server, "RESERVED 1 1\r\na\r\nRESERVED 2 1\r\nb\r\nTOUCHED\r\n");
+
+		$worker = new Phalcon\Queue\Beanstalk\Worker(array($queue), array('prefetch' => 2, 'touchInterval' => 1));
+
+		$processed = $worker->run(function($job) {
+			if ($job->getBody() == 'a') {
+				sleep(1);
+				return true;
+			}
+			return false;
+		});
+
+		$this->assertEquals($processed, 2);
+		$this->assertEquals($this->_readCommands($server), "reserve-with-timeout 1\r\nreserve-with-timeout 0\r\ntouch 2\r\n");
+
+		//The prefetched jobs are released before an exception of the handler is rethrown
+		list($queue, $server) = $this->_getQueue(array('encoder' => Phalcon\Queue\Beanstalk::ENCODER_RAW));
+
+		fwrite($server, "RESERVED 1 1\r\na\r\nRESERVED 2 1\r\nb\r\nRELEASED\r\n");
+
+		$worker = new Phalcon\Queue\Beanstalk\Worker(array($queue), array('prefetch' => 2));
+
+		try {
+			$worker->run(function($job) {
+				throw new Exception('failed ' . $job->getBody());
+			});
+			$this->assertTrue(false);
+		}
+		catch (Exception $e) {
+			$this->assertEquals($e->getMessage(), 'failed a');
+		}
+
+		$this->assertEquals($this->_readCommands($server), "reserve-with-timeout 1\r\nreserve-with-timeout 0\r\nrelease 2 100 0\r\n");
+
+		try {
+			new Phalcon\Queue\Beanstalk\Worker(array(new stdClass()));
+			$this->assertTrue(false);
+		}
+		catch (Phalcon\Exception $e) {
+			$this->assertEquals($e->getMessage(), 'Queues must be instances of Phalcon\Queue\Beanstalk');
+		}
+	}
+
+}
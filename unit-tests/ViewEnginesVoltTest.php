@@ -130,6 +130,15 @@ class ViewEnginesVoltTest extends PHPUnit_Framework_TestCase
 		$this->assertTrue(is_array($intermediate));
 		$this->assertEquals(count($intermediate), 5);
 
+		$intermediate = $volt->parse('a{{ "b" }}c{{ "d" }}e');
+		$this->assertEquals($intermediate[0]['value'], 'a');
+		$this->assertEquals($intermediate[1]['expr']['value'], 'b');
+		$this->assertEquals($intermediate[3]['expr']['value'], 'd');
+		$this->assertEquals($intermediate[4]['value'], 'e');
+
+		$intermediate = $volt->parse(str_repeat('{{ a }}-', 2000));
+		$this->assertEquals(count($intermediate), 4000);
+
 		$intermediate = $volt->parse('Some = {{ 100+50 }}');
 		$this->assertTrue(is_array($intermediate));
 		$this->assertEquals(count($intermediate), 2);
@@ -767,13 +776,13 @@ class ViewEnginesVoltTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($compilation, "-<?php echo 'hello'; ?>-<?php echo 'hello'; ?>-");
 
 		$compilation = $volt->compileString('Some = {{ 100+50 }}');
-		$this->assertEquals($compilation, "Some = <?php echo 100 + 50; ?>");
+		$this->assertEquals($compilation, "Some = <?php echo 150; ?>");
 
 		$compilation = $volt->compileString('Some = {{ 100-50 }}');
-		$this->assertEquals($compilation, "Some = <?php echo 100 - 50; ?>");
+		$this->assertEquals($compilation, "Some = <?php echo 50; ?>");
 
 		$compilation = $volt->compileString('Some = {{ 100*50 }}');
-		$this->assertEquals($compilation, "Some = <?php echo 100 * 50; ?>");
+		$this->assertEquals($compilation, "Some = <?php echo 5000; ?>");
 
 		$compilation = $volt->compileString('Some = {{ 100/50 }}');
 		$this->assertEquals($compilation, "Some = <?php echo 100 / 50; ?>");
@@ -782,7 +791,7 @@ class ViewEnginesVoltTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($compilation, "Some = <?php echo 100 % 50; ?>");
 
 		$compilation = $volt->compileString('Some = {{ 100~50 }}');
-		$this->assertEquals($compilation, "Some = <?php echo 100 . 50; ?>");
+		$this->assertEquals($compilation, "Some = <?php echo '10050'; ?>");
 
 		//Unary operators
 		$compilation = $volt->compileString('{{ -10 }}');
@@ -880,10 +889,10 @@ class ViewEnginesVoltTest extends PHPUnit_Framework_TestCase
 
 		//Filters
 		$compilation = $volt->compileString('{{ "hello"|e }}');
-		$this->assertEquals($compilation, '<?php echo $this->escaper->escapeHtml(\'hello\'); ?>');
+		$this->assertEquals($compilation, "<?php \$__escaper = \$this->escaper; ?>\n<?php echo \$__escaper->escapeHtml('hello'); ?>");
 
 		$compilation = $volt->compileString('{{ "hello"|escape }}');
-		$this->assertEquals($compilation, '<?php echo $this->escaper->escapeHtml(\'hello\'); ?>');
+		$this->assertEquals($compilation, "<?php \$__escaper = \$this->escaper; ?>\n<?php echo \$__escaper->escapeHtml('hello'); ?>");
 
 		$compilation = $volt->compileString('{{ "hello"|trim }}');
 		$this->assertEquals($compilation, '<?php echo trim(\'hello\'); ?>');
@@ -898,20 +907,20 @@ class ViewEnginesVoltTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($compilation, '<?php echo urlencode(\'hello\'); ?>');
 
 		$compilation = $volt->compileString('{{ "hello"|uppercase }}');
-		$this->assertEquals($compilation, '<?php echo Phalcon\Text::upper(\'hello\'); ?>');
+		$this->assertEquals($compilation, (function_exists('mb_strtoupper') ? '<?php echo mb_strtoupper(\'hello\'); ?>' : '<?php echo strtoupper(\'hello\'); ?>'));
 
 		$compilation = $volt->compileString('{{ "hello"|lowercase }}');
-		$this->assertEquals($compilation, '<?php echo Phalcon\Text::lower(\'hello\'); ?>');
+		$this->assertEquals($compilation, (function_exists('mb_strtolower') ? '<?php echo mb_strtolower(\'hello\'); ?>' : '<?php echo strtolower(\'hello\'); ?>'));
 
 		$compilation = $volt->compileString('{{ ("hello" ~ "lol")|e|length }}');
-		$this->assertEquals($compilation, '<?php echo $this->length($this->escaper->escapeHtml((\'hello\' . \'lol\'))); ?>');
+		$this->assertEquals($compilation, "<?php \$__escaper = \$this->escaper; ?>\n<?php echo \$this->length(\$__escaper->escapeHtml('hellolol')); ?>");
 
 		//Filters with parameters
 		$compilation = $volt->compileString('{{ "My name is %s, %s"|format(name, "thanks") }}');
 		$this->assertEquals($compilation, "<?php echo sprintf('My name is %s, %s', \$name, 'thanks'); ?>");
 
 		$compilation = $volt->compileString('{{ "some name"|convert_encoding("utf-8", "latin1") }}');
-		$this->assertEquals($compilation, "<?php echo \$this->convertEncoding('some name', 'utf-8', 'latin1'); ?>");
+		$this->assertEquals($compilation, (function_exists('mb_convert_encoding') ? "<?php echo mb_convert_encoding('some name', 'utf-8', 'latin1'); ?>" : "<?php echo \$this->convertEncoding('some name', 'utf-8', 'latin1'); ?>"));
 
 		//if statement
 		$compilation = $volt->compileString('{% if a==b %} hello {% endif %}');
@@ -1044,14 +1053,14 @@ class ViewEnginesVoltTest extends PHPUnit_Framework_TestCase
 
 		// Cache statement
 		$compilation = $volt->compileString('{% cache somekey %} hello {% endcache %}');
-		$this->assertEquals($compilation, '<?php $_cache[$somekey] = $this->di->get(\'viewCache\'); $_cacheKey[$somekey] = $_cache[$somekey]->start($somekey); if ($_cacheKey[$somekey] === null) { ?> hello <?php $_cache[$somekey]->save($somekey); } else { echo $_cacheKey[$somekey]; } ?>');
+		$this->assertEquals($compilation, '<?php $__viewCache = $this->di->get(\'viewCache\'); $__viewFragments = array(); ?>'."\n".'<?php $_cacheKey[$somekey] = $__viewCache->get($somekey); if ($_cacheKey[$somekey] === null) { ob_start(); ?> hello <?php $_cacheKey[$somekey] = ob_get_clean(); $__viewCache->save($somekey, $_cacheKey[$somekey], null, false); } echo $_cacheKey[$somekey]; ?>');
 
 		$compilation = $volt->compileString('{% cache somekey 500 %} hello {% endcache %}');
-		$this->assertEquals($compilation, '<?php $_cache[$somekey] = $this->di->get(\'viewCache\'); $_cacheKey[$somekey] = $_cache[$somekey]->start($somekey, 500); if ($_cacheKey[$somekey] === null) { ?> hello <?php $_cache[$somekey]->save($somekey, null, 500); } else { echo $_cacheKey[$somekey]; } ?>');
+		$this->assertEquals($compilation, '<?php $__viewCache = $this->di->get(\'viewCache\'); $__viewFragments = array(); ?>'."\n".'<?php $_cacheKey[$somekey] = $__viewCache->get($somekey, 500); if ($_cacheKey[$somekey] === null) { ob_start(); ?> hello <?php $_cacheKey[$somekey] = ob_get_clean(); $__viewCache->save($somekey, $_cacheKey[$somekey], 500, false); } echo $_cacheKey[$somekey]; ?>');
 
 		//Autoescape mode
 		$compilation = $volt->compileString('{{ "hello" }}{% autoescape true %}{{ "hello" }}{% autoescape false %}{{ "hello" }}{% endautoescape %}{{ "hello" }}{% endautoescape %}{{ "hello" }}');
-		$this->assertEquals($compilation, "<?php echo 'hello'; ?><?php echo \$this->escaper->escapeHtml('hello'); ?><?php echo 'hello'; ?><?php echo \$this->escaper->escapeHtml('hello'); ?><?php echo 'hello'; ?>");
+		$this->assertEquals($compilation, "<?php \$__escaper = \$this->escaper; ?>\n<?php echo 'hello'; ?><?php echo \$__escaper->escapeHtml('hello'); ?><?php echo 'hello'; ?><?php echo \$__escaper->escapeHtml('hello'); ?><?php echo 'hello'; ?>");
 
 		//Mixed
 		$compilation = $volt->compileString('{# some comment #}{{ "hello" }}{# other comment }}');
@@ -1061,6 +1070,106 @@ class ViewEnginesVoltTest extends PHPUnit_Framework_TestCase
 
 	}
 
+	public function testVoltCompilerNativeEscape()
+	{
+
+		$volt = new \Phalcon\Mvc\View\Engine\Volt\Compiler();
+		$volt->setOptions(array(
+			'nativeEscape' => true
+		));
+
+		$compilation = $volt->compileString('{{ "hello"|e }}');
+		$this->assertEquals($compilation, "<?php echo htmlspecialchars('hello', ENT_QUOTES, 'utf-8'); ?>");
+
+		$compilation = $volt->compileString('{% autoescape true %}{{ "hello" }}{% endautoescape %}');
+		$this->assertEquals($compilation, "<?php echo htmlspecialchars('hello', ENT_QUOTES, 'utf-8'); ?>");
+
+		//Other escapers still need the escaper service
+		$compilation = $volt->compileString('{{ "hello"|escape_css }}');
+		$this->assertEquals($compilation, "<?php \$__escaper = \$this->escaper; ?>\n<?php echo \$__escaper->escapeCss('hello'); ?>");
+	}
+
+	public function testVoltCompilerFolding()
+	{
+
+		$volt = new \Phalcon\Mvc\View\Engine\Volt\Compiler();
+
+		$compilation = $volt->compileString('{{ (2 + 3) * 4 - -1 }}');
+		$this->assertEquals($compilation, "<?php echo 21; ?>");
+
+		$compilation = $volt->compileString('{{ "a" ~ "b\'c" ~ 1 }}');
+		$this->assertEquals($compilation, "<?php echo 'ab\\'c1'; ?>");
+
+		$compilation = $volt->compileString('{{ ("hello" ~ " world")|length }}');
+		$this->assertEquals($compilation, "<?php echo 11; ?>");
+
+		$compilation = $volt->compileString('{{ [1, 2, 3]|length }}');
+		$this->assertEquals($compilation, "<?php echo count(array(1, 2, 3)); ?>");
+
+		//Literals with escape sequences and lengths depending on the encoding are left to PHP
+		$compilation = $volt->compileString('{{ "a\\\\b"|length }}');
+		$this->assertEquals($compilation, "<?php echo \$this->length('a\\\\b'); ?>");
+
+		$compilation = $volt->compileString("{{ \"caf\xc3\xa9\"|length }}");
+		$this->assertEquals($compilation, "<?php echo \$this->length('caf\xc3\xa9'); ?>");
+
+		//Expressions with variables or divisions are left to PHP
+		$compilation = $volt->compileString('{{ a + 2 * 3 }}');
+		$this->assertEquals($compilation, "<?php echo \$a + 6; ?>");
+
+		$compilation = $volt->compileString('{{ 10 / 4 }}');
+		$this->assertEquals($compilation, "<?php echo 10 / 4; ?>");
+	}
+
+	public function testVoltCompilerCacheFragments()
+	{
+
+		$volt = new \Phalcon\Mvc\View\Engine\Volt\Compiler();
+
+		//Literal keys are fetched at the beginning of the template grouped by lifetime
+		$compilation = $volt->compileString('{% cache "header" 300 %}a{% endcache %}{% cache "footer" 300 %}b{% endcache %}{% cache "menu" %}c{% endcache %}');
+		$this->assertEquals($compilation, '<?php $__viewCache = $this->di->get(\'viewCache\'); $__viewFragments = (method_exists($__viewCache, \'getMany\') ? $__viewCache->getMany(array(\'header\', \'footer\'), 300) + $__viewCache->getMany(array(\'menu\')) : array()); ?>'."\n".
+			'<?php $_cacheKey[\'header\'] = (array_key_exists(\'header\', $__viewFragments) ? $__viewFragments[\'header\'] : $__viewCache->get(\'header\', 300)); if ($_cacheKey[\'header\'] === null) { ob_start(); ?>a<?php $_cacheKey[\'header\'] = ob_get_clean(); $__viewCache->save(\'header\', $_cacheKey[\'header\'], 300, false); } echo $_cacheKey[\'header\']; ?>'.
+			'<?php $_cacheKey[\'footer\'] = (array_key_exists(\'footer\', $__viewFragments) ? $__viewFragments[\'footer\'] : $__viewCache->get(\'footer\', 300)); if ($_cacheKey[\'footer\'] === null) { ob_start(); ?>b<?php $_cacheKey[\'footer\'] = ob_get_clean(); $__viewCache->save(\'footer\', $_cacheKey[\'footer\'], 300, false); } echo $_cacheKey[\'footer\']; ?>'.
+			'<?php $_cacheKey[\'menu\'] = (array_key_exists(\'menu\', $__viewFragments) ? $__viewFragments[\'menu\'] : $__viewCache->get(\'menu\')); if ($_cacheKey[\'menu\'] === null) { ob_start(); ?>c<?php $_cacheKey[\'menu\'] = ob_get_clean(); $__viewCache->save(\'menu\', $_cacheKey[\'menu\'], null, false); } echo $_cacheKey[\'menu\']; ?>');
+
+		//The fragments of a template aren't fetched by the next one
+		$compilation = $volt->compileString('{% cache key %}a{% endcache %}');
+		$this->assertEquals($compilation, '<?php $__viewCache = $this->di->get(\'viewCache\'); $__viewFragments = array(); ?>'."\n".'<?php $_cacheKey[$key] = $__viewCache->get($key); if ($_cacheKey[$key] === null) { ob_start(); ?>a<?php $_cacheKey[$key] = ob_get_clean(); $__viewCache->save($key, $_cacheKey[$key], null, false); } echo $_cacheKey[$key]; ?>');
+	}
+
+	public function testVoltCompilerLoopContext()
+	{
+
+		$volt = new \Phalcon\Mvc\View\Engine\Volt\Compiler();
+		$volt->setOptions(array(
+			'prefix' => 'p'
+		));
+
+		//Without 'loop' a plain foreach is generated
+		$compilation = $volt->compileString('{% for a in b %}{{ a }}{% endfor %}');
+		$this->assertEquals($compilation, '<?php foreach ($b as $a) { ?><?php echo $a; ?><?php } ?>');
+
+		//Only the index doesn't need to count the iterator
+		$compilation = $volt->compileString('{% for a in b %}{{ loop.index }}{% endfor %}');
+		$this->assertEquals($compilation, '<?php $p1incr = 0; $p1loop = new stdClass(); ?><?php foreach ($b as $a) { $p1loop->index = $p1incr + 1; ?><?php echo $p1loop->index; ?><?php $p1incr++; } ?>');
+
+		$compilation = $volt->compileString('{% for a in b %}{% if loop.last %}x{% endif %}{% endfor %}');
+		$this->assertEquals($compilation, '<?php $p1iterator = $b; $p1incr = 0; $p1loop = new stdClass(); $p1loop->length = count($p1iterator); ?><?php foreach ($p1iterator as $a) { $p1loop->last = ($p1incr == ($p1loop->length - 1)); ?><?php if ($p1loop->last) { ?>x<?php } ?><?php $p1incr++; } ?>');
+
+		//The loop context of a foreach doesn't leak into the next one
+		$compilation = $volt->compileString('{% for a in b %}{{ loop.first }}{% endfor %}{% for c in d %}{{ c }}{% endfor %}');
+		$this->assertEquals($compilation, '<?php $p1incr = 0; $p1loop = new stdClass(); ?><?php foreach ($b as $a) { $p1loop->first = ($p1incr == 0); ?><?php echo $p1loop->first; ?><?php $p1incr++; } ?><?php foreach ($d as $c) { ?><?php echo $c; ?><?php } ?>');
+
+		//The 'if' expr can use the loop context too
+		$compilation = $volt->compileString('{% for a in b if loop.index0 > 1 %}{{ a }}{% endfor %}');
+		$this->assertEquals($compilation, '<?php $p1incr = 0; $p1loop = new stdClass(); ?><?php foreach ($b as $a) { $p1loop->index0 = $p1incr; if ($p1loop->index0 > 1) { ?><?php echo $a; ?><?php } ?><?php $p1incr++; } ?>');
+
+		//The 'else' of a loop with an 'if' expr closes the expr and keeps counting the iterations
+		$compilation = $volt->compileString('{% for a in b if loop.index0 > 1 %}{{ a }}{% else %}none{% endfor %}');
+		$this->assertEquals($compilation, '<?php $p1iterated = false; ?><?php $p1incr = 0; $p1loop = new stdClass(); ?><?php foreach ($b as $a) { $p1loop->index0 = $p1incr; if ($p1loop->index0 > 1) { ?><?php $p1iterated = true; ?><?php echo $a; ?><?php } $p1incr++; } if (!$p1iterated) { ?>none<?php } ?>');
+	}
+
 	public function testVoltUsersFunctions()
 	{
 
@@ -1244,6 +1353,116 @@ Clearly, the song is: <?php echo $this->getContent(); ?>.
 
 	}
 
+	public function testVoltCompileFileCleanup()
+	{
+
+		@rmdir('unit-tests/cache/cleanup.volt.php');
+		file_put_contents('unit-tests/cache/cleanup.volt', 'Hello {{ name }}');
+
+		//The compiled path is a directory so the temporary file can't replace it
+		mkdir('unit-tests/cache/cleanup.volt.php');
+
+		$volt = new Phalcon\Mvc\View\Engine\Volt\Compiler();
+		try {
+			@$volt->compileFile('unit-tests/cache/cleanup.volt', 'unit-tests/cache/cleanup.volt.php');
+			$this->assertTrue(false);
+		} catch (Phalcon\Mvc\View\Exception $e) {
+			$this->assertEquals($e->getMessage(), "Volt directory can't be written");
+		}
+
+		$this->assertEquals(glob('unit-tests/cache/cleanup.volt.php.*'), array());
+
+		rmdir('unit-tests/cache/cleanup.volt.php');
+		unlink('unit-tests/cache/cleanup.volt');
+	}
+
+	public function testVoltCompilerRegistry()
+	{
+
+		Phalcon\Mvc\View\Engine\Volt\Compiler::clearRegistry();
+
+		@unlink('unit-tests/cache/registry.volt');
+		@unlink('unit-tests/cache/registry.volt.php');
+
+		file_put_contents('unit-tests/cache/registry.volt', 'Hello {{ name }}');
+
+		$volt = new Phalcon\Mvc\View\Engine\Volt\Compiler();
+		$volt->setOptions(array(
+			'revalidate' => 3600
+		));
+
+		$volt->compile('unit-tests/cache/registry.volt');
+		$this->assertEquals(file_get_contents('unit-tests/cache/registry.volt.php'), 'Hello <?php echo $name; ?>');
+
+		//A compiled file removed while its template is registered is compiled again
+		unlink('unit-tests/cache/registry.volt.php');
+
+		$volt->compile('unit-tests/cache/registry.volt');
+		$this->assertEquals(file_get_contents('unit-tests/cache/registry.volt.php'), 'Hello <?php echo $name; ?>');
+
+		//The template is trusted until the revalidation interval expires
+		file_put_contents('unit-tests/cache/registry.volt', 'Bye {{ name }}');
+		touch('unit-tests/cache/registry.volt', time() + 10);
+
+		$volt->compile('unit-tests/cache/registry.volt');
+		$this->assertEquals(file_get_contents('unit-tests/cache/registry.volt.php'), 'Hello <?php echo $name; ?>');
+
+		Phalcon\Mvc\View\Engine\Volt\Compiler::clearRegistry();
+
+		$volt->compile('unit-tests/cache/registry.volt');
+		$this->assertEquals(file_get_contents('unit-tests/cache/registry.volt.php'), 'Bye <?php echo $name; ?>');
+
+		@unlink('unit-tests/cache/registry.volt');
+		@unlink('unit-tests/cache/registry.volt.php');
+
+		Phalcon\Mvc\View\Engine\Volt\Compiler::clearRegistry();
+	}
+
+	public function testVoltCompileDirectory()
+	{
+
+		@mkdir('unit-tests/cache/aot');
+		@mkdir('unit-tests/cache/aot/partials');
+
+		file_put_contents('unit-tests/cache/aot/index.volt', 'Hello {{ name }}');
+		file_put_contents('unit-tests/cache/aot/other.volt', '{% for item in items %}{{ item }}{% endfor %}');
+		file_put_contents('unit-tests/cache/aot/broken.volt', '{% if %}');
+		file_put_contents('unit-tests/cache/aot/partials/header.volt', '<h1>{{ title }}</h1>');
+
+		foreach (array(1, 3) as $workers) {
+
+			@unlink('unit-tests/cache/aot/index.volt.php');
+			@unlink('unit-tests/cache/aot/other.volt.php');
+			@unlink('unit-tests/cache/aot/partials/header.volt.php');
+
+			$volt = new Phalcon\Mvc\View\Engine\Volt\Compiler();
+			$timings = $volt->compileDirectory('unit-tests/cache/aot', array('workers' => $workers));
+
+			ksort($timings);
+			$this->assertEquals(array_keys($timings), array(
+				'unit-tests/cache/aot/broken.volt',
+				'unit-tests/cache/aot/index.volt',
+				'unit-tests/cache/aot/other.volt',
+				'unit-tests/cache/aot/partials/header.volt'
+			));
+
+			$this->assertTrue(isset($timings['unit-tests/cache/aot/broken.volt']['error']));
+			$this->assertFalse(isset($timings['unit-tests/cache/aot/index.volt']['error']));
+			$this->assertTrue(is_float($timings['unit-tests/cache/aot/index.volt']['time']));
+
+			$this->assertEquals(file_get_contents('unit-tests/cache/aot/index.volt.php'), 'Hello <?php echo $name; ?>');
+			$this->assertEquals(file_get_contents('unit-tests/cache/aot/partials/header.volt.php'), '<h1><?php echo $title; ?></h1>');
+			$this->assertTrue(file_exists('unit-tests/cache/aot/other.volt.php'));
+		}
+
+		foreach (array('index', 'other', 'broken', 'partials/header') as $name) {
+			@unlink('unit-tests/cache/aot/' . $name . '.volt');
+			@unlink('unit-tests/cache/aot/' . $name . '.volt.php');
+		}
+		@rmdir('unit-tests/cache/aot/partials');
+		@rmdir('unit-tests/cache/aot');
+	}
+
 	public function testVoltEngine()
 	{
 
@@ -1332,4 +1551,37 @@ Clearly, the song is: <?php echo $this->getContent(); ?>.
 		$this->assertEquals($view->getContent(), 'Length Array: 4Length Object: 4Length String: 5Length No String: 4Slice Array: 1,2,3,4Slice Array: 2,3Slice Array: 1,2,3Slice Object: 2,3,4Slice Object: 2,3Slice Object: 1,2Slice String: helSlice String: elSlice String: lloSlice No String: 123Slice No String: 23Slice No String: 34');
 	}
 
+	public function testVoltEngineHelpers()
+	{
+
+		$di = new Phalcon\DI();
+
+		$view = new Phalcon\Mvc\View();
+		$view->setDI($di);
+
+		$volt = new Phalcon\Mvc\View\Engine\Volt($view, $di);
+
+		$this->assertEquals($volt->length('hello'), 5);
+		$this->assertEquals($volt->length(1234), 4);
+		$this->assertEquals($volt->length(array(1, 2)), 2);
+
+		$this->assertTrue($volt->isIncluded('h', 'hello'));
+		$this->assertTrue($volt->isIncluded('llo', 'hello'));
+		$this->assertFalse($volt->isIncluded('x', 'hello'));
+		$this->assertTrue($volt->isIncluded('2', array(1, 2, 3)));
+		$this->assertFalse($volt->isIncluded(4, array(1, 2, 3)));
+
+		$this->assertEquals($volt->slice(array('a' => 1, 2, 3, 4), 1, 2), array(2, 3));
+		$this->assertEquals($volt->slice(array('a' => 1, 'b' => 2, 3), 0, 1), array('a' => 1, 'b' => 2));
+		$this->assertEquals($volt->slice(array(1, 2, 3, 4), -2), array(3, 4));
+		$this->assertEquals($volt->slice('hello', -3), 'llo');
+		$this->assertEquals($volt->slice('hello', 10, 12), '');
+
+		$this->assertEquals($volt->convertEncoding('hello', 'utf-8', 'latin1'), 'hello');
+		$this->assertEquals($volt->convertEncoding("caf\xe9", 'utf-8', 'latin1'), "caf\xc3\xa9");
+
+		//The misspelled name is kept as a deprecated alias
+		$this->assertEquals(@$volt->converEncoding("caf\xe9", 'utf-8', 'latin1'), "caf\xc3\xa9");
+	}
+
 }
@@ -209,4 +209,127 @@ class ViewTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($view->getContent(), '<div class="action">Action</div>');
 	}
 
+	public function testPathCache()
+	{
+
+		$viewsDir = sys_get_temp_dir() . '/phalcon-view-cache-' . getmypid() . '/';
+		@mkdir($viewsDir);
+		@unlink($viewsDir . 'partial.phtml');
+
+		View::clearPathCache();
+
+		$view = new View();
+		$view->setViewsDir($viewsDir);
+		$view->setPartialsDir('');
+		$view->usePathCache(true);
+
+		//Views not found are cached but revalidated
+		try {
+			$view->partial('partial');
+			$this->assertTrue(false);
+		} catch (Phalcon\Mvc\View\Exception $e) {
+			$this->assertTrue(true);
+		}
+
+		file_put_contents($viewsDir . 'partial.phtml', 'found');
+
+		ob_start();
+		$view->partial('partial');
+		$view->partial('partial');
+		$this->assertEquals(ob_get_clean(), 'foundfound');
+
+		//Without revalidation the cached negative entry is trusted until the cache is cleared
+		unlink($viewsDir . 'partial.phtml');
+		View::clearPathCache();
+
+		$view->usePathCache(true, false);
+
+		try {
+			$view->partial('partial');
+			$this->assertTrue(false);
+		} catch (Phalcon\Mvc\View\Exception $e) {
+			$this->assertTrue(true);
+		}
+
+		file_put_contents($viewsDir . 'partial.phtml', 'found');
+
+		try {
+			$view->partial('partial');
+			$this->assertTrue(false);
+		} catch (Phalcon\Mvc\View\Exception $e) {
+			$this->assertTrue(true);
+		}
+
+		View::clearPathCache();
+
+		ob_start();
+		$view->partial('partial');
+		$this->assertEquals(ob_get_clean(), 'found');
+
+		//Relative views directories are resolved and cached as absolute paths
+		$paths = array();
+		$eventsManager = new Phalcon\Events\Manager();
+		$eventsManager->attach('view:beforeRenderView', function($event, $view, $path) use (&$paths) {
+			$paths[] = $path;
+		});
+		$view->setEventsManager($eventsManager);
+
+		$cwd = getcwd();
+		chdir(sys_get_temp_dir());
+		$view->setViewsDir('phalcon-view-cache-' . getmypid() . '/');
+
+		ob_start();
+		$view->partial('partial');
+		$view->partial('partial');
+		$this->assertEquals(ob_get_clean(), 'foundfound');
+
+		$absolutePath = getcwd() . '/phalcon-view-cache-' . getmypid() . '/partial.phtml';
+		$this->assertEquals($paths, array($absolutePath, $absolutePath));
+		chdir($cwd);
+
+		unlink($viewsDir . 'partial.phtml');
+		rmdir($viewsDir);
+		View::clearPathCache();
+	}
+
+	public function testStreamingRender()
+	{
+
+		$view = new View();
+		$view->setBasePath(__DIR__.'/../');
+		$view->setViewsDir('unit-tests/views/');
+
+		$this->assertFalse($view->isStreaming());
+		$view->setStreaming(true);
+		$this->assertTrue($view->isStreaming());
+
+		//The page is written to the output instead of the content
+		ob_start();
+		$view->start();
+		$view->render('test3', 'other');
+		$view->finish();
+		$this->assertEquals(ob_get_clean(), '<html>lolhere</html>'.PHP_EOL);
+		$this->assertEquals($view->getContent(), '');
+
+		$view->setParamToView('a_cool_var', 'le-this');
+		$view->setTemplateAfter('test');
+
+		ob_start();
+		$view->start();
+		$view->render('test3', 'another');
+		$view->finish();
+		$this->assertEquals(ob_get_clean(), '<html>zuplol<p>le-this</p></html>'.PHP_EOL);
+
+		$view->cleanTemplateAfter();
+
+		//Levels without a view pass the inner content through
+		$view->setRenderLevel(View::LEVEL_LAYOUT);
+
+		ob_start();
+		$view->start();
+		$view->render('test2', 'index');
+		$view->finish();
+		$this->assertEquals(ob_get_clean(), 'here');
+	}
+
 }
@@ -0,0 +1,51 @@
+<?php
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2013 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+/**
+ * Timing helper shared by the benchmark scripts of this directory
+ */
+class Benchmark
+{
+
+	/**
+	 * Runs a callback the given number of times after a warm-up call and prints the time
+	 * spent on every run
+	 *
+	 * @param string $name
+	 * @param int $iterations
+	 * @param callable $callback
+	 * @return float
+	 */
+	public static function run($name, $iterations, $callback)
+	{
+		call_user_func($callback);
+
+		$start = microtime(true);
+		for ($i = 0; $i < $iterations; $i++) {
+			call_user_func($callback);
+		}
+		$elapsed = microtime(true) - $start;
+
+		printf("  %-56s %6d runs %10.3f ms/run" . PHP_EOL, $name, $iterations, $elapsed * 1000 / $iterations);
+
+		return $elapsed;
+	}
+
+}
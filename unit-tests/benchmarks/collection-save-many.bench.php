@@ -0,0 +1,64 @@
+<?php
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2013 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+/**
+ * Inserts 1000 documents saving them one by one and with saveMany, which sends them with
+ * MongoCollection::batchInsert, needs a local MongoDB server
+ */
+
+require_once __DIR__ . '/Benchmark.php';
+require 'unit-tests/collections/Songs.php';
+
+$di = new Phalcon\DI();
+
+$di->set('mongo', function(){
+	$mongo = new Mongo();
+	return $mongo->phalcon_test;
+}, true);
+
+$di->set('collectionManager', function(){
+	return new Phalcon\Mvc\Collection\Manager();
+}, true);
+
+function benchmarkSongs()
+{
+	$songs = array();
+	for ($i = 0; $i < 1000; $i++) {
+		$song = new Songs();
+		$song->artist = 'Benchmark';
+		$song->name = 'Song ' . $i;
+		$songs[] = $song;
+	}
+	return $songs;
+}
+
+Benchmark::run('save 1000 documents one by one', 5, function() {
+	foreach (benchmarkSongs() as $song) {
+		$song->save();
+	}
+});
+
+Benchmark::run('saveMany 1000 documents (batchSize 100)', 5, function() {
+	Songs::saveMany(benchmarkSongs(), array('batchSize' => 100));
+});
+
+foreach (Songs::find(array(array('artist' => 'Benchmark'))) as $song) {
+	$song->delete();
+}
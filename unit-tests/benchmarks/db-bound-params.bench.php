@@ -0,0 +1,81 @@
+<?php
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2013 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+/**
+ * Rewrites the placeholders of statements with 10, 20 and 40 bound parameters, the rewrite of a
+ * statement is cached so a second statement is changed on every run to measure the scanner. The
+ * preg-based rewrite used before the scanner is run as a baseline
+ */
+
+require_once __DIR__ . '/Benchmark.php';
+require 'unit-tests/config.db.php';
+
+/**
+ * Previous implementation of Phalcon\Db\Adapter\Pdo::convertBoundParams
+ */
+function benchmarkPregBoundParams($sql, $params)
+{
+	$placeholders = array();
+	$bindPattern = '/\?([0-9]+)|:([a-zA-Z0-9_]+):/';
+	if (preg_match_all($bindPattern, $sql, $matches, 2)) {
+		foreach ($matches as $placeMatch) {
+			if (isset($params[$placeMatch[1]])) {
+				$value = $params[$placeMatch[1]];
+			} else {
+				if (!isset($placeMatch[2]) || !isset($params[$placeMatch[2]])) {
+					throw new Phalcon\Db\Exception("Matched parameter wasn't found in parameters list");
+				}
+				$value = $params[$placeMatch[2]];
+			}
+			$placeholders[] = $value;
+		}
+		$boundSql = preg_replace($bindPattern, '?', $sql);
+	} else {
+		$boundSql = $sql;
+	}
+	return array('sql' => $boundSql, 'params' => $placeholders);
+}
+
+$connection = new Phalcon\Db\Adapter\Pdo\Sqlite($configSqlite);
+
+foreach (array(10, 20, 40) as $binds) {
+
+	$conditions = array();
+	$params = array('comment' => '', 'x' => '');
+	for ($i = 0; $i < $binds; $i++) {
+		$conditions[] = 'c' . $i . ' = :p' . $i . ': AND d' . $i . ' <> \'literal :x:\'';
+		$params['p' . $i] = $i;
+	}
+	$sql = 'SELECT * FROM robots /* :comment: */ WHERE ' . join(' AND ', $conditions);
+
+	$number = 0;
+	Benchmark::run('rewrite ' . $binds . ' placeholders (preg baseline)', 100000, function() use ($sql, $params, &$number) {
+		benchmarkPregBoundParams($sql . ' LIMIT ' . $number++, $params);
+	});
+
+	Benchmark::run('rewrite ' . $binds . ' placeholders (cached)', 100000, function() use ($connection, $sql, $params) {
+		$connection->convertBoundParams($sql, $params);
+	});
+
+	$number = 0;
+	Benchmark::run('rewrite ' . $binds . ' placeholders (scanned)', 100000, function() use ($connection, $sql, $params, &$number) {
+		$connection->convertBoundParams($sql . ' LIMIT ' . $number++, $params);
+	});
+}
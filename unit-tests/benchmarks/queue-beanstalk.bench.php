@@ -0,0 +1,66 @@
+<?php
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2013 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+/**
+ * Puts and deletes 1000 jobs one command at a time and in windows of 100 commands, the server
+ * side of a socket pair stands in for beanstalkd so only the client is measured
+ */
+
+require_once __DIR__ . '/Benchmark.php';
+
+class BeanstalkBenchmark extends Phalcon\Queue\Beanstalk
+{
+
+	public function setConnection($connection)
+	{
+		$this->_connection = $connection;
+	}
+
+}
+
+$pair = stream_socket_pair(STREAM_PF_UNIX, STREAM_SOCK_STREAM, STREAM_IPPROTO_IP);
+stream_set_blocking($pair[1], 0);
+
+$queue = new BeanstalkBenchmark(array('encoder' => Phalcon\Queue\Beanstalk::ENCODER_RAW));
+$queue->setConnection($pair[0]);
+
+$server = $pair[1];
+$jobs = array_fill(0, 1000, 'payload');
+
+$inserted = '';
+$deleted = str_repeat("DELETED\r\n", 1000);
+for ($i = 1; $i <= 1000; $i++) {
+	$inserted .= "INSERTED " . $i . "\r\n";
+}
+
+foreach (array(1, 100) as $batchSize) {
+
+	Benchmark::run('putMany 1000 jobs (batchSize ' . $batchSize . ')', 100, function() use ($queue, $server, $jobs, $inserted, $batchSize) {
+		fwrite($server, $inserted);
+		$queue->putMany($jobs, array('batchSize' => $batchSize));
+		while (fread($server, 65536) != '');
+	});
+
+	Benchmark::run('deleteMany 1000 jobs (batchSize ' . $batchSize . ')', 100, function() use ($queue, $server, $deleted, $batchSize) {
+		fwrite($server, $deleted);
+		$queue->deleteMany(range(1, 1000), array('batchSize' => $batchSize));
+		while (fread($server, 65536) != '');
+	});
+}
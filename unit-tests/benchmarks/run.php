@@ -0,0 +1,50 @@
+<?php
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2013 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+/**
+ * Runs the benchmarks of this directory, every *.bench.php script is a benchmark. The scripts
+ * use paths relative to the root of the repository like the unit tests do
+ *
+ *   php unit-tests/benchmarks/run.php
+ *   php unit-tests/benchmarks/run.php volt-escape
+ */
+
+error_reporting(E_ALL | E_NOTICE | E_STRICT);
+
+if (!extension_loaded('phalcon')) {
+	die('The phalcon extension must be loaded to run the benchmarks' . PHP_EOL);
+}
+
+chdir(__DIR__ . '/../..');
+
+require_once __DIR__ . '/Benchmark.php';
+
+$benchmarks = array_slice($argv, 1);
+if (!count($benchmarks)) {
+	foreach (glob(__DIR__ . '/*.bench.php') as $file) {
+		$benchmarks[] = basename($file, '.bench.php');
+	}
+}
+
+foreach ($benchmarks as $benchmark) {
+	echo $benchmark, PHP_EOL;
+	require __DIR__ . '/' . $benchmark . '.bench.php';
+	echo PHP_EOL;
+}
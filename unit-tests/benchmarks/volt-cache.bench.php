@@ -0,0 +1,76 @@
+<?php
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2013 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+/**
+ * Renders a template with 50 'cache' blocks with literal keys once the fragments are stored,
+ * the fragments are fetched at the beginning of the template with getMany when the backend
+ * supports it
+ */
+
+require_once __DIR__ . '/Benchmark.php';
+
+$template = sys_get_temp_dir() . '/volt-cache.volt';
+
+$source = '';
+for ($i = 0; $i < 50; $i++) {
+	$source .= '{% cache "fragment-' . $i . '" 300 %}<p>fragment ' . $i . '</p>{% endcache %}' . PHP_EOL;
+}
+file_put_contents($template, $source);
+
+$backends = array(
+	'file' => function() {
+		$frontend = new Phalcon\Cache\Frontend\Output(array('lifetime' => 300));
+		return new Phalcon\Cache\Backend\File($frontend, array('cacheDir' => 'unit-tests/cache/'));
+	}
+);
+
+if (extension_loaded('memcache')) {
+	$backends['memcache'] = function() {
+		$frontend = new Phalcon\Cache\Frontend\Output(array('lifetime' => 300));
+		return new Phalcon\Cache\Backend\Memcache($frontend, array('host' => 'localhost', 'port' => '11211'));
+	};
+}
+
+foreach ($backends as $name => $backend) {
+
+	$di = new Phalcon\DI\FactoryDefault();
+	$di->set('viewCache', $backend, true);
+
+	$view = new Phalcon\Mvc\View();
+	$view->setDI($di);
+
+	$volt = new Phalcon\Mvc\View\Engine\Volt($view, $di);
+	$volt->setOptions(array(
+		'compiledPath' => sys_get_temp_dir() . '/',
+		'compiledSeparator' => '_'
+	));
+
+	Benchmark::run('render 50 cached fragments (' . $name . ')', 200, function() use ($view, $volt, $template) {
+		$view->start();
+		$volt->render($template, array(), true);
+		$view->finish();
+	});
+
+	for ($i = 0; $i < 50; $i++) {
+		$di->get('viewCache')->delete('fragment-' . $i);
+	}
+}
+
+unlink($template);
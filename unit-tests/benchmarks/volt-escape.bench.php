@@ -0,0 +1,57 @@
+<?php
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2013 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+/**
+ * Compiles and renders a template with 10000 escaped echoes, escaping through the escaper
+ * service and with the 'nativeEscape' option
+ */
+
+require_once __DIR__ . '/Benchmark.php';
+
+$template = 'unit-tests/benchmarks/templates/escape.volt';
+
+$compiler = new Phalcon\Mvc\View\Engine\Volt\Compiler();
+Benchmark::run('compile 10k escaped echoes', 20, function() use ($compiler, $template) {
+	$compiler->compileString(file_get_contents($template));
+});
+
+foreach (array('escaper' => false, 'native' => true) as $mode => $nativeEscape) {
+
+	$di = new Phalcon\DI\FactoryDefault();
+
+	$view = new Phalcon\Mvc\View();
+	$view->setDI($di);
+
+	$volt = new Phalcon\Mvc\View\Engine\Volt($view, $di);
+	$volt->setOptions(array(
+		'compiledPath' => sys_get_temp_dir() . '/',
+		'compiledSeparator' => '_',
+		'compiledExtension' => '.' . $mode . '.php',
+		'nativeEscape' => $nativeEscape
+	));
+
+	$params = array('name' => '<b>Phalcon</b> & "Volt"');
+
+	Benchmark::run('render 10k escaped echoes (' . $mode . ')', 200, function() use ($view, $volt, $template, $params) {
+		$view->start();
+		$volt->render($template, $params, true);
+		$view->finish();
+	});
+}
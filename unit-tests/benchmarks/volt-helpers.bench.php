@@ -0,0 +1,130 @@
+<?php
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2013 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+/**
+ * Calls the 'length', 'in', 'slice' and 'convert_encoding' helpers on ASCII strings and
+ * arrays, which don't need mbstring, and converts a latin1 string to utf-8. The helpers
+ * are compared with their previous implementation, which dispatched every call to the
+ * mbstring, iconv and array functions
+ */
+
+require_once __DIR__ . '/Benchmark.php';
+
+/**
+ * Previous implementation of the helpers of Phalcon\Mvc\View\Engine\Volt
+ */
+class BenchmarkVoltHelpers
+{
+
+	public static function length($item)
+	{
+		if (is_object($item) || is_array($item)) {
+			return count($item);
+		}
+		if (function_exists('mb_strlen')) {
+			return mb_strlen($item);
+		}
+		return strlen($item);
+	}
+
+	public static function isIncluded($needle, $haystack)
+	{
+		if (is_array($haystack)) {
+			return in_array($needle, $haystack);
+		}
+		if (function_exists('mb_strpos')) {
+			return mb_strpos($haystack, $needle);
+		}
+		return strpos($haystack, $needle);
+	}
+
+	public static function convertEncoding($text, $from, $to)
+	{
+		if (function_exists('mb_convert_encoding')) {
+			return mb_convert_encoding($text, $from, $to);
+		}
+		return iconv($from, $to, $text);
+	}
+
+	public static function slice($value, $start, $end = null)
+	{
+		$length = $end !== null ? $end - $start + 1 : null;
+		if (is_array($value)) {
+			return array_slice($value, $start, $length);
+		}
+		if (function_exists('mb_substr')) {
+			return $length !== null ? mb_substr($value, $start, $length) : mb_substr($value, $start);
+		}
+		return $length !== null ? substr($value, $start, $length) : substr($value, $start);
+	}
+
+}
+
+$volt = new Phalcon\Mvc\View\Engine\Volt(new Phalcon\Mvc\View());
+
+$ascii = str_repeat('hello world ', 100);
+$latin1 = str_repeat("caf\xe9 ", 100);
+$items = range(1, 1000);
+
+Benchmark::run('length of an ascii string and an array (baseline)', 100000, function() use ($ascii, $items) {
+	BenchmarkVoltHelpers::length($ascii);
+	BenchmarkVoltHelpers::length($items);
+});
+
+Benchmark::run('length of an ascii string and an array', 100000, function() use ($volt, $ascii, $items) {
+	$volt->length($ascii);
+	$volt->length($items);
+});
+
+Benchmark::run('in on an ascii string and an array (baseline)', 100000, function() use ($ascii, $items) {
+	BenchmarkVoltHelpers::isIncluded('world', $ascii);
+	BenchmarkVoltHelpers::isIncluded(500, $items);
+});
+
+Benchmark::run('in on an ascii string and an array', 100000, function() use ($volt, $ascii, $items) {
+	$volt->isIncluded('world', $ascii);
+	$volt->isIncluded(500, $items);
+});
+
+Benchmark::run('slice of an ascii string and an array (baseline)', 100000, function() use ($ascii, $items) {
+	BenchmarkVoltHelpers::slice($ascii, 10, 20);
+	BenchmarkVoltHelpers::slice($items, 10, 20);
+});
+
+Benchmark::run('slice of an ascii string and an array', 100000, function() use ($volt, $ascii, $items) {
+	$volt->slice($ascii, 10, 20);
+	$volt->slice($items, 10, 20);
+});
+
+Benchmark::run('convert_encoding of an ascii string (baseline)', 100000, function() use ($ascii) {
+	BenchmarkVoltHelpers::convertEncoding($ascii, 'utf-8', 'latin1');
+});
+
+Benchmark::run('convert_encoding of an ascii string', 100000, function() use ($volt, $ascii) {
+	$volt->convertEncoding($ascii, 'utf-8', 'latin1');
+});
+
+Benchmark::run('convert_encoding of a latin1 string (baseline)', 100000, function() use ($latin1) {
+	BenchmarkVoltHelpers::convertEncoding($latin1, 'utf-8', 'latin1');
+});
+
+Benchmark::run('convert_encoding of a latin1 string', 100000, function() use ($volt, $latin1) {
+	$volt->convertEncoding($latin1, 'utf-8', 'latin1');
+});
@@ -0,0 +1,50 @@
+<?php
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2013 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+/**
+ * Renders loops over 10000 items without the loop context, reading only loop.index and
+ * reading loop.last, which also needs the length of the iterator
+ */
+
+require_once __DIR__ . '/Benchmark.php';
+
+$compiler = new Phalcon\Mvc\View\Engine\Volt\Compiler();
+
+$templates = array(
+	'plain' => '{% for item in items %}{{ item }}{% endfor %}',
+	'index' => '{% for item in items %}{{ loop.index }}{{ item }}{% endfor %}',
+	'last' => '{% for item in items %}{{ item }}{% if loop.last %}.{% endif %}{% endfor %}'
+);
+
+$items = range(1, 10000);
+
+foreach ($templates as $name => $template) {
+
+	$compiledPath = sys_get_temp_dir() . '/volt-loop-' . $name . '.php';
+	file_put_contents($compiledPath, $compiler->compileString($template));
+
+	Benchmark::run('render a loop over 10k items (' . $name . ')', 200, function() use ($compiledPath, $items) {
+		ob_start();
+		require $compiledPath;
+		ob_end_clean();
+	});
+
+	unlink($compiledPath);
+}
@@ -0,0 +1,41 @@
+<?php
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2013 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+/**
+ * Parses and compiles a template with 5000 statements, the lists of the AST used to be
+ * copied on every item
+ */
+
+require_once __DIR__ . '/Benchmark.php';
+
+$source = '';
+for ($i = 0; $i < 1000; $i++) {
+	$source .= '<div>{{ item.name }}</div>{% if item.active %}{{ item.value|e }}{% endif %}{% set total = total + ' . $i . ' %}' . PHP_EOL;
+}
+
+$compiler = new Phalcon\Mvc\View\Engine\Volt\Compiler();
+
+Benchmark::run('parse 5k statements', 20, function() use ($compiler, $source) {
+	$compiler->parse($source);
+});
+
+Benchmark::run('compile 5k statements', 20, function() use ($compiler, $source) {
+	$compiler->compileString($source);
+});